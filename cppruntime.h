@@ -0,0 +1,189 @@
+"#ifndef YY_CPP_RUNTIME\n"
+"#define YY_CPP_RUNTIME\n"
+"\n"
+"struct yythunk { int begin, end;  unsigned short action; };\n"
+"\n"
+"enum { yyThunkPush= 0, yyThunkPop, yyThunkSet, yyThunkActions };\n"
+"\n"
+"/* Input policy for text that is already in memory.  The parser reads it\n"
+" * in place and never asks for more.\n"
+" */\n"
+"struct yymemory\n"
+"{\n"
+"  const char *_buf;\n"
+"  int	      _limit;\n"
+"\n"
+"  yymemory(const char *text, size_t length) : _buf(text), _limit((int)length) {}\n"
+"  explicit yymemory(const char *text) : _buf(text), _limit((int)strlen(text)) {}\n"
+"\n"
+"  bool refill()		{ return false; }\n"
+"  void discard(int n)	{ _buf += n;  _limit -= n; }\n"
+"};\n"
+"\n"
+"/* Input policy for text that arrives a piece at a time.  source(buf, size)\n"
+" * stores at most size bytes in buf and answers how many, or 0 at the end\n"
+" * of the input.\n"
+" */\n"
+"template <class Source>\n"
+"struct yystream\n"
+"{\n"
+"  char  *_buf;\n"
+"  int	 _buflen;\n"
+"  int	 _limit;\n"
+"  Source _source;\n"
+"\n"
+"  explicit yystream(Source source)\n"
+"    : _buf((char *)malloc(YY_BUFFER_SIZE)), _buflen(YY_BUFFER_SIZE), _limit(0), _source(source) {}\n"
+"  ~yystream()	{ free(_buf); }\n"
+"  yystream(const yystream &)= delete;\n"
+"  yystream &operator=(const yystream &)= delete;\n"
+"\n"
+"  bool refill()\n"
+"  {\n"
+"    int n;\n"
+"    while (_buflen - _limit < 512)\n"
+"      _buf= (char *)realloc(_buf, _buflen *= 2);\n"
+"    if ((n= _source(_buf + _limit, _buflen - _limit)) <= 0)\n"
+"      return false;\n"
+"    _limit += n;\n"
+"    return true;\n"
+"  }\n"
+"\n"
+"  void discard(int n)	{ memmove(_buf, _buf + n, _limit -= n); }\n"
+"};\n"
+"\n"
+"#ifndef yyprintf\n"
+"# ifdef YY_DEBUG\n"
+"#  define yyprintf(args)	fprintf args\n"
+"# else\n"
+"#  define yyprintf(args)\n"
+"# endif\n"
+"#endif\n"
+"\n"
+"/* The primitives that matching is made of, for a Context that is also\n"
+" * an input policy.  The parsers of leg -C and peg::parser derive from\n"
+" * this, and leg copies everything from YY_CPP_RUNTIME to here into each\n"
+" * parser it writes with -C.\n"
+" */\n"
+"template <class Context>\n"
+"struct yymatcher\n"
+"{\n"
+"  typedef Context yycontext;\n"
+"\n"
+"  static void yyrecordMaxPos(yycontext *yy)\n"
+"  {\n"
+"    if (yy->_pos > yy->_maxpos)\n"
+"      yy->_maxpos= yy->_pos;\n"
+"  }\n"
+"\n"
+"  static int yymatchDot(yycontext *yy)\n"
+"  {\n"
+"    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;\n"
+"    ++yy->_pos;\n"
+"    yyrecordMaxPos(yy);\n"
+"    return 1;\n"
+"  }\n"
+"\n"
+"  static int yymatchChar(yycontext *yy, int c)\n"
+"  {\n"
+"    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;\n"
+"    if ((unsigned char)yy->_buf[yy->_pos] == c)\n"
+"      {\n"
+"	++yy->_pos;\n"
+"	yyrecordMaxPos(yy);\n"
+"	yyprintf((stderr, \"  ok   yymatchChar(yy, %c) @ %s\\n\", c, yy->_buf+yy->_pos));\n"
+"	return 1;\n"
+"      }\n"
+"    yyprintf((stderr, \"  fail yymatchChar(yy, %c) @ %s\\n\", c, yy->_buf+yy->_pos));\n"
+"    return 0;\n"
+"  }\n"
+"\n"
+"  static int yymatchString(yycontext *yy, const char *s)\n"
+"  {\n"
+"    int yysav= yy->_pos;\n"
+"    while (*s)\n"
+"      {\n"
+"	if (yy->_pos >= yy->_limit && !yy->refill()) return 0;\n"
+"	if (yy->_buf[yy->_pos] != *s)\n"
+"	  {\n"
+"	    yy->_pos= yysav;\n"
+"	    return 0;\n"
+"	  }\n"
+"	++s;\n"
+"	++yy->_pos;\n"
+"      }\n"
+"    yyrecordMaxPos(yy);\n"
+"    return 1;\n"
+"  }\n"
+"\n"
+"  static int yymatchIString(yycontext *yy, const char *s)\n"
+"  {\n"
+"    int yysav= yy->_pos;\n"
+"    while (*s)\n"
+"      {\n"
+"	if (yy->_pos >= yy->_limit && !yy->refill()) return 0;\n"
+"	if (tolower(yy->_buf[yy->_pos]) != *s)\n"
+"	  {\n"
+"	    yy->_pos= yysav;\n"
+"	    return 0;\n"
+"	  }\n"
+"	++s;\n"
+"	++yy->_pos;\n"
+"      }\n"
+"    yyrecordMaxPos(yy);\n"
+"    return 1;\n"
+"  }\n"
+"\n"
+"  static int yymatchClass(yycontext *yy, const unsigned char *bits)\n"
+"  {\n"
+"    int c;\n"
+"    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;\n"
+"    c= (unsigned char)yy->_buf[yy->_pos];\n"
+"    if (bits[c >> 3] & (1 << (c & 7)))\n"
+"      {\n"
+"	++yy->_pos;\n"
+"	yyrecordMaxPos(yy);\n"
+"	yyprintf((stderr, \"  ok   yymatchClass @ %s\\n\", yy->_buf+yy->_pos));\n"
+"	return 1;\n"
+"      }\n"
+"    yyprintf((stderr, \"  fail yymatchClass @ %s\\n\", yy->_buf+yy->_pos));\n"
+"    return 0;\n"
+"  }\n"
+"\n"
+"  static int yyText(yycontext *yy, int begin, int end)\n"
+"  {\n"
+"    int yyleng= end - begin;\n"
+"    if (yyleng < 0)\n"
+"      yyleng= 0;\n"
+"    if (yy->_textlen < yyleng + 1)\n"
+"      {\n"
+"	while (yy->_textlen < yyleng + 1)\n"
+"	  yy->_textlen= yy->_textlen ? 2 * yy->_textlen : YY_BUFFER_SIZE;\n"
+"	yy->_text= (char *)realloc(yy->_text, yy->_textlen);\n"
+"      }\n"
+"    memcpy(yy->_text, yy->_buf + begin, yyleng);\n"
+"    yy->_text[yyleng]= '\\0';\n"
+"    return yyleng;\n"
+"  }\n"
+"\n"
+"  static void yyCommit(yycontext *yy)\n"
+"  {\n"
+"    yy->discard(yy->_pos);\n"
+"    yy->_begin -= yy->_pos;\n"
+"    yy->_end -= yy->_pos;\n"
+"    yy->_offset += yy->_pos;\n"
+"    yy->_pos= yy->_thunkpos= 0;\n"
+"  }\n"
+"};\n"
+"\n"
+"#define YY_MATCHER(C)					\\\n"
+"  using yymatcher<C>::yyrecordMaxPos;			\\\n"
+"  using yymatcher<C>::yymatchDot;			\\\n"
+"  using yymatcher<C>::yymatchChar;			\\\n"
+"  using yymatcher<C>::yymatchString;			\\\n"
+"  using yymatcher<C>::yymatchIString;			\\\n"
+"  using yymatcher<C>::yymatchClass;			\\\n"
+"  using yymatcher<C>::yyText;				\\\n"
+"  using yymatcher<C>::yyCommit\n"
+"\n"
+"#endif /* YY_CPP_RUNTIME */\n"
@@ -0,0 +1,1196 @@
+/* A recursive-descent parser generated by peg 0.1.18 */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __cplusplus
+  #include <vector>
+#endif
+#define YYRULECOUNT 4
+#ifndef YY_MALLOC
+#define YY_MALLOC(C, N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(C, P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(C, P)		free(P)
+#endif
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YY_UNUSED
+# ifdef __GNUC__
+#  define YY_UNUSED	__attribute__((unused))
+# else
+#  define YY_UNUSED
+# endif
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YYRESET
+#define YYRESET		yyreset
+#endif
+#if defined(YY_LAZY) && !defined(YYPARSESPAN)
+#define YYPARSESPAN	yyparsespan
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( yy->_begin= yy->_pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( yy->_end= yy->_pos, 1)
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+#ifndef YY_STACK_SIZE
+#define YY_STACK_SIZE 128
+#endif
+
+#ifndef YY_BUFFER_SIZE
+#define YY_BUFFER_SIZE 1024
+#endif
+
+#if defined(YY_PUSH) || defined(YY_QUOTA)
+#define YY_COROUTINE
+#if defined(__has_include)
+#if !__has_include(<ucontext.h>)
+#error "YY_PUSH needs ucontext, which this platform does not provide"
+#endif
+#elif defined(_WIN32)
+#error "YY_PUSH needs ucontext, which this platform does not provide"
+#endif
+#include <stdint.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#if !defined(YY_COROUTINE_STACK_SIZE) && defined(YY_PUSH_STACK_SIZE)
+#define YY_COROUTINE_STACK_SIZE YY_PUSH_STACK_SIZE
+#endif
+#ifndef YY_COROUTINE_STACK_SIZE
+#define YY_COROUTINE_STACK_SIZE (256 * 1024)
+#endif
+enum { YYPARSE_NEED_MORE= 0, YYPARSE_ACCEPT, YYPARSE_REJECT, YYPARSE_YIELD };
+#define YYPUSH_NEED_MORE	YYPARSE_NEED_MORE	/* the names used before YY_QUOTA */
+#define YYPUSH_ACCEPT		YYPARSE_ACCEPT
+#define YYPUSH_REJECT		YYPARSE_REJECT
+#endif
+#ifdef YY_PUSH
+#ifndef YYPUSH
+#define YYPUSH		yypush
+#endif
+#endif
+#ifdef YY_QUOTA
+#ifndef YYPARSEQUOTA
+#define YYPARSEQUOTA	yyparsequota
+#endif
+#endif
+#ifdef YY_STRUCTURAL
+#include <stdint.h>
+#endif
+#define yyEventEnter(yy, rule)
+#define yyEventLeave(yy, rule)
+#ifdef YY_LIMITS
+#include <setjmp.h>
+#ifndef YYCANCEL
+#define YYCANCEL	yycancel
+#endif
+enum { YYLIMIT_NONE= 0, YYLIMIT_STEPS, YYLIMIT_DEPTH, YYLIMIT_BUFFER, YYLIMIT_THUNKS, YYLIMIT_CANCEL };
+#endif
+
+#ifndef YY_PART
+
+typedef struct _yycontext yycontext;
+typedef struct _yythunk { int begin, end;  unsigned short action; } yythunk;
+#ifdef YY_TOKENS
+typedef struct _yytoken { int kind;  size_t begin, end; } yytoken;
+#endif
+#ifdef YY_LAZY
+typedef struct _yyspan { int rule;  size_t begin, end; } yyspan;
+#endif
+
+enum { yyThunkPush= 0, yyThunkPop, yyThunkSet, yyThunkActions };
+
+struct _yycontext {
+  char     *_buf;
+  int       _buflen;
+  int       _pos;
+  int       _limit;
+  int       _maxpos;
+  char     *_text;
+  int       _textlen;
+  int       _begin;
+  int       _end;
+  int       _textmax;
+  yythunk  *_thunks;
+  int       _thunkslen;
+  int       _thunkpos;
+  int       _choices;
+  size_t    _offset;
+  YYSTYPE   _;
+  YYSTYPE  *_val;
+#ifdef __cplusplus
+  std::vector<YYSTYPE>* _vals;
+#else
+  YYSTYPE  *_vals;
+  int       _valslen;
+#endif
+  int      *_frames;
+  int       _frameslen;
+  int       _frametop;
+#ifdef YY_COROUTINE
+  int       _final;
+  int       _status;
+  char     *_stack;
+  ucontext_t _parser;
+  ucontext_t _caller;
+#endif
+#ifdef YY_QUOTA
+  int       _quota;
+  int       _steps;
+#endif
+#ifdef YY_LIMITS
+  long      _maxsteps;
+  int       _maxdepth;
+  int       _maxbuf;
+  int       _maxthunks;
+  int       _cancel;
+  int       _error;
+  long      _stepcount;
+  int       _depth;
+  jmp_buf   _abort;
+#endif
+#ifdef YY_TOKENS
+  yytoken  *_tokens;
+  int       _tokenslen;
+  int       _tokencount;
+  int       _token;
+#endif
+#ifdef YY_STRUCTURAL
+  uint64_t *_index;
+  int       _indexlen;
+  int       _indexed;
+#endif
+#ifdef YY_LAZY
+  yyspan   *_spans;
+  int       _spanslen;
+  int       _spancount;
+  int       _spanning;
+#endif
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+};
+
+#ifdef YY_CTX_LOCAL
+#define YY_CTX_PARAM_	yycontext *yyctx,
+#define YY_CTX_PARAM	yycontext *yyctx
+#define YY_CTX_ARG_	yyctx,
+#define YY_CTX_ARG	yyctx
+#ifndef YY_INPUT
+#define YY_INPUT(yy, buf, result, max_size)		\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#else
+#define YY_CTX_PARAM_
+#define YY_CTX_PARAM
+#define YY_CTX_ARG_
+#define YY_CTX_ARG
+yycontext yyctx_= { 0, 0 };
+yycontext *yyctx= &yyctx_;
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#endif
+
+#ifdef YY_LIMITS
+#ifdef __GNUC__
+#define yyCancelled(yy)	__atomic_load_n(&yy->_cancel, __ATOMIC_RELAXED)
+#else
+#define yyCancelled(yy)	(*(volatile int *)&yy->_cancel)
+#endif
+YY_LOCAL(void) yyAbort(yycontext *yy, int error)
+{
+  yyprintf((stderr, "limit: abort %d\n", error));
+  yy->_error= error;
+  longjmp(yy->_abort, 1);
+}
+#define yyEnter(yy)	do { if (++yy->_depth > yy->_maxdepth && yy->_maxdepth) yyAbort(yy, YYLIMIT_DEPTH); } while (0)
+#define yyLeave(yy)	--yy->_depth
+#define yyPoll(yy)	do { if (yyCancelled(yy)) yyAbort(yy, YYLIMIT_CANCEL); } while (0)
+#define yyGrow(yy, size, max, error)	do { if ((max) && (size) > (max)) yyAbort(yy, error); } while (0)
+#else
+#define yyEnter(yy)
+#define yyLeave(yy)
+#define yyPoll(yy)
+#define yyGrow(yy, size, max, error)
+#endif
+
+
+
+YY_LOCAL(int) yyrefill(yycontext *yy)
+{
+  int yyn;
+#ifdef YY_LAZY
+  if (yy->_spanning) return 0;
+#endif
+#ifdef YY_PUSH
+  while (yy->_pos >= yy->_limit && !yy->_final)
+    {
+      yyprintf((stderr, "push: need more\n"));
+      yy->_status= YYPARSE_NEED_MORE;
+      swapcontext(&yy->_parser, &yy->_caller);
+    }
+  return yy->_pos < yy->_limit;
+#endif
+  while (yy->_buflen - yy->_pos < 512)
+    {
+      int yylen= yy->_buflen * 2;
+#ifdef YY_LIMITS
+      if (yy->_maxbuf && yylen > yy->_maxbuf)
+	{
+	  if (yy->_buflen >= yy->_maxbuf && yy->_buflen > yy->_pos)
+	    break;					/* read into what room is left */
+	  yyGrow(yy, yy->_pos + 1, yy->_maxbuf, YYLIMIT_BUFFER);
+	  yylen= yy->_maxbuf;
+	}
+#endif
+      yy->_buflen= yylen;
+      yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);
+    }
+#ifdef YY_CTX_LOCAL
+  YY_INPUT(yy, (yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));
+#else
+  YY_INPUT((yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));
+#endif
+  if (!yyn) return 0;
+  yy->_limit += yyn;
+  return 1;
+}
+
+YY_LOCAL(void) yyrecordMaxPos(yycontext *yy)
+{
+  if (yy->_pos > yy->_maxpos) {
+    yy->_maxpos = yy->_pos;
+    yyprintf((stderr, "       maxpos=%d [after '%c']\n", yy->_maxpos, yy->_buf[yy->_maxpos-1]));
+  }
+}
+
+#if defined(YY_QUOTA) || defined(YY_LIMITS)
+YY_LOCAL(void) yyStep(yycontext *yy)
+{
+#ifdef YY_LIMITS
+  if (yy->_maxsteps && ++yy->_stepcount > yy->_maxsteps)
+    yyAbort(yy, YYLIMIT_STEPS);
+#endif
+#ifdef YY_QUOTA
+  if (yy->_quota && --yy->_steps < 0)
+    {
+      yyprintf((stderr, "quota: yield\n"));
+      yy->_status= YYPARSE_YIELD;
+      swapcontext(&yy->_parser, &yy->_caller);
+    }
+#endif
+}
+#else
+#define yyStep(yy)
+#endif
+
+/* Scanners match most terminals in place, so any of these may go unused. */
+YY_LOCAL(int) YY_UNUSED yymatchDot(yycontext *yy)
+{
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  ++yy->_pos;
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchChar(yycontext *yy, int c)
+{
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  if ((unsigned char)yy->_buf[yy->_pos] == c)
+    {
+      ++yy->_pos;
+      yyrecordMaxPos(yy);
+      yyprintf((stderr, "  ok   yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+  return 0;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchString(yycontext *yy, const char *s)
+{
+  int yysav= yy->_pos;
+  yyStep(yy);
+  while (*s)
+    {
+      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+      if (yy->_buf[yy->_pos] != *s)
+	{
+	  yy->_pos= yysav;
+	  return 0;
+	}
+      ++s;
+      ++yy->_pos;
+    }
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchIString(yycontext *yy, const char *s)
+{
+  int yysav= yy->_pos;
+  yyStep(yy);
+  while (*s)
+    {
+      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+      if (tolower(yy->_buf[yy->_pos]) != *s)
+        {
+          yy->_pos= yysav;
+          return 0;
+        }
+      ++s;
+      ++yy->_pos;
+    }
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchClass(yycontext *yy, unsigned char *bits)
+{
+  int c;
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  c= (unsigned char)yy->_buf[yy->_pos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++yy->_pos;
+      yyrecordMaxPos(yy);
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", yy->_buf+yy->_pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", yy->_buf+yy->_pos));
+  return 0;
+}
+
+#define yyAvail(yy, p)		((p) < (yy)->_limit || ((yy)->_pos= (p), yyrefill(yy)))
+#define yyByte(yy, p)		((unsigned char)(yy)->_buf[p])
+#define yyInClass(bits, c)	((bits)[(c) >> 3] & (1 << ((c) & 7)))
+
+#ifdef YY_FRAMES
+YY_LOCAL(int *) yyGrowFrames(yycontext *yy, int size)
+{
+  if (!yy->_frameslen)
+    {
+      yy->_frameslen= YY_STACK_SIZE;
+      yy->_frames= (int *)YY_MALLOC(yy, sizeof(int) * yy->_frameslen);
+    }
+  while (yy->_frameslen < size)
+    {
+      yy->_frameslen *= 2;
+      yy->_frames= (int *)YY_REALLOC(yy, yy->_frames, sizeof(int) * yy->_frameslen);
+    }
+  return yy->_frames;
+}
+#endif
+
+YY_LOCAL(void) yyDo(yycontext *yy, int action, int begin, int end)
+{
+  yyGrow(yy, yy->_thunkpos + 1, yy->_maxthunks, YYLIMIT_THUNKS);
+  while (yy->_thunkpos >= yy->_thunkslen)
+    {
+      yy->_thunkslen *= 2;
+#ifdef YY_LIMITS
+      if (yy->_maxthunks && yy->_thunkslen > yy->_maxthunks)
+	yy->_thunkslen= yy->_maxthunks;
+#endif
+      yy->_thunks= (yythunk *)YY_REALLOC(yy, yy->_thunks, sizeof(yythunk) * yy->_thunkslen);
+    }
+  yy->_thunks[yy->_thunkpos].begin=  begin;
+  yy->_thunks[yy->_thunkpos].end=    end;
+  yy->_thunks[yy->_thunkpos].action= action;
+  ++yy->_thunkpos;
+}
+
+YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (yy->_textlen < (yyleng + 1))
+	{
+	  yy->_textlen *= 2;
+	  yy->_text= (char *)YY_REALLOC(yy, yy->_text, yy->_textlen);
+	}
+      memcpy(yy->_text, yy->_buf + begin, yyleng);
+    }
+  yy->_text[yyleng]= '\0';
+  return yyleng;
+}
+
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng);
+
+#ifdef YY_LAZY
+YY_LOCAL(void) yySpan(yycontext *yy, int rule, int begin, int end)
+{
+  yyspan *span;
+  if (yy->_spancount == yy->_spanslen)
+    {
+      yy->_spanslen= yy->_spanslen ? 2 * yy->_spanslen : YY_STACK_SIZE;
+      yy->_spans= (yyspan *)YY_REALLOC(yy, yy->_spans, sizeof(yyspan) * yy->_spanslen);
+    }
+  span= yy->_spans + yy->_spancount++;
+  span->rule=  rule;
+  span->begin= yy->_offset + begin;
+  span->end=   yy->_offset + end;
+}
+#endif
+
+
+YY_LOCAL(void) yyDone(yycontext *yy)
+{
+  int pos;
+  for (pos= 0;  pos < yy->_thunkpos;  ++pos)
+    {
+      yythunk *thunk= &yy->_thunks[pos];
+      int yyleng;
+#ifdef YY_LAZY
+      if (thunk->action >= YY_LAZY)
+	{
+	  yySpan(yy, thunk->action - YY_LAZY, thunk->begin, thunk->end);
+	  continue;
+	}
+#endif
+      yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %d %s\n", pos, thunk->action, yy->_text));
+      yyDispatch(yy, thunk->action, yy->_text, yyleng);
+    }
+  yy->_thunkpos= 0;
+}
+
+#ifdef YY_TOKENS
+/* Forget the tokens that begin before the buffer, which can no longer
+ * be matched again.
+ */
+YY_LOCAL(void) yyDropTokens(yycontext *yy)
+{
+  int n= 0;
+  while (n < yy->_tokencount && yy->_tokens[n].begin < yy->_offset) ++n;
+  if (n) memmove(yy->_tokens, yy->_tokens + n, sizeof(yytoken) * (yy->_tokencount -= n));
+  yy->_token= 0;
+}
+#endif
+
+YY_LOCAL(void) yyCommit(yycontext *yy)
+{
+  yy->_limit -= yy->_pos;
+  if (yy->_limit)
+    memmove(yy->_buf, yy->_buf + yy->_pos, yy->_limit);
+  yy->_begin -= yy->_pos;
+  yy->_end -= yy->_pos;
+  yy->_offset += yy->_pos;
+  yy->_pos= yy->_thunkpos= 0;
+#ifdef YY_STRUCTURAL
+  yy->_indexed= 0;
+#endif
+#ifdef YY_TOKENS
+  yyDropTokens(yy);
+#endif
+}
+
+#ifdef YY_STREAM
+YY_LOCAL(void) yyStream(yycontext *yy)
+{
+  int keep= yy->_pos;
+  if (yy->_begin >= 0 && yy->_begin < keep) keep= yy->_begin;
+  if (yy->_end   >= 0 && yy->_end   < keep) keep= yy->_end;
+  yyDone(yy);
+  if (keep > 0 && keep >= yy->_limit - keep)
+    {
+      yyprintf((stderr, "stream %d of %d\n", keep, yy->_limit));
+      yy->_limit -= keep;
+      memmove(yy->_buf, yy->_buf + keep, yy->_limit);
+      yy->_pos -= keep;
+      yy->_begin -= keep;
+      yy->_end -= keep;
+      yy->_maxpos= (yy->_maxpos > keep) ? yy->_maxpos - keep : 0;
+      yy->_offset += keep;
+#ifdef YY_STRUCTURAL
+      yy->_indexed= 0;
+#endif
+#ifdef YY_TOKENS
+      yyDropTokens(yy);
+#endif
+    }
+}
+#endif
+
+YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(yy);
+      yyCommit(yy);
+    }
+  return 1;
+}
+
+YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)
+{
+#ifdef __cplusplus
+  yy->_vals->resize(yy->_vals->size() + count);
+  yy->_val = &yy->_vals->back();
+#else
+  yy->_val += count;
+  while (yy->_valslen <= yy->_val - yy->_vals)
+    {
+      long offset= yy->_val - yy->_vals;
+      size_t oldlen = yy->_valslen;
+      yy->_valslen *= 2;
+      yy->_vals= (YYSTYPE *)YY_REALLOC(yy, yy->_vals, sizeof(YYSTYPE) * yy->_valslen);
+      memset(&yy->_vals[oldlen], 0, sizeof(YYSTYPE) * oldlen);
+      yy->_val= yy->_vals + offset;
+    }
+#endif
+}
+YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)
+{
+#ifdef __cplusplus
+  yy->_vals->resize(yy->_vals->size() - count);
+  yy->_val = &yy->_vals->back();
+#else
+  yy->_val -= count;
+#endif
+}
+YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)   { yy->_val[count]= yy->_; }
+
+#ifdef YY_LAZY
+#ifndef YY_LAZY_QUOTE
+#define YY_LAZY_QUOTE(c)	('"' == (c) || '\'' == (c))
+#define YY_LAZY_WORDS		/* the quotes are known, so eight bytes can be tested at once */
+#endif
+#ifndef YY_LAZY_COMMENTS
+#define YY_LAZY_COMMENTS	1
+#endif
+#ifdef YY_LAZY_WORDS
+#define yyLazyHas(w, c)	((((w) ^ 0x0101010101010101ULL * (c)) - 0x0101010101010101ULL) & ~((w) ^ 0x0101010101010101ULL * (c)) & 0x8080808080808080ULL)
+#endif
+/* Move over a balanced region without parsing it, and remember where
+ * it was so that it can be parsed later.  Brackets within quotes or
+ * C comments are not counted.  Unless the program has its own quotes,
+ * text between the bytes that matter is passed over a word at a time.
+ */
+YY_LOCAL(int) yyskipLazy(yycontext *yy, int rule, int open, int close)
+{
+  int pos= yy->_pos, p= pos, depth= 0, c;
+  yyStep(yy);
+  if (!yyAvail(yy, p) || yyByte(yy, p) != open)
+    {
+      yy->_pos= pos;
+      return 0;
+    }
+  for (;;)
+    {
+#ifdef YY_LAZY_WORDS
+      for (;  p + 8 <= yy->_limit;  p += 8)
+	{
+	  unsigned long long w;
+	  memcpy(&w, yy->_buf + p, 8);
+	  if (yyLazyHas(w, open) | yyLazyHas(w, close) | yyLazyHas(w, '"') | yyLazyHas(w, '\'') | yyLazyHas(w, '/'))
+	    break;
+	}
+#endif
+      while (p < yy->_limit && (c= yyByte(yy, p)) != open && c != close && !YY_LAZY_QUOTE(c) && '/' != c)
+	++p;
+      if (!yyAvail(yy, p))
+	{
+	  yy->_pos= pos;
+	  return 0;
+	}
+      c= yyByte(yy, p++);
+      if (c == open)
+	++depth;
+      else if (c == close)
+	{
+	  if (!--depth) break;
+	}
+      else if (YY_LAZY_QUOTE(c))
+	{
+	  int d;
+	  while (yyAvail(yy, p) && (d= yyByte(yy, p++)) != c)
+	    if ('\\' == d && yyAvail(yy, p)) ++p;
+	}
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '/' == yyByte(yy, p))
+	{
+	  while (yyAvail(yy, p) && '\n' != yyByte(yy, p)) ++p;
+	}
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '*' == yyByte(yy, p))
+	{
+	  for (++p;  yyAvail(yy, p) && !('*' == yyByte(yy, p) && yyAvail(yy, p + 1) && '/' == yyByte(yy, p + 1));  ++p);
+	  if (yyAvail(yy, p)) p += 2;
+	}
+    }
+  yy->_pos= p;
+  yyrecordMaxPos(yy);
+  yyDo(yy, YY_LAZY + rule, pos, p);
+  return 1;
+}
+#endif
+
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)
+
+YY_RULE(int) yyrcd(yycontext *yy); /* 4 */
+YY_RULE(int) yyrbc(yycontext *yy); /* 3 */
+YY_RULE(int) yyrabcd(yycontext *yy); /* 2 */
+YY_RULE(int) yyrstart(yycontext *yy); /* 1 */
+
+enum {
+  yy_2_cd= yyThunkActions + 7,
+  yy_1_cd= yyThunkActions + 6,
+  yy_2_bc= yyThunkActions + 5,
+  yy_1_bc= yyThunkActions + 4,
+  yy_4_abcd= yyThunkActions + 3,
+  yy_3_abcd= yyThunkActions + 2,
+  yy_2_abcd= yyThunkActions + 1,
+  yy_1_abcd= yyThunkActions + 0,
+};
+
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng)
+{
+  switch (yyaction)
+    {
+    case yyThunkPush:	yyPush(yy, yytext, yyleng);	break;
+    case yyThunkPop:	yyPop(yy, yytext, yyleng);	break;
+    case yyThunkSet:	yySet(yy, yytext, yyleng);	break;
+    case yy_2_cd:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_cd\n"));
+  {
+#line 0
+   printf("D %d\n", yypos); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_cd:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_cd\n"));
+  {
+#line 0
+   printf("C %d\n", yypos); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_2_bc:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_bc\n"));
+  {
+#line 0
+   printf("C %d\n", yypos); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_bc:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_bc\n"));
+  {
+#line 0
+   printf("B %d\n", yypos); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_4_abcd:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_abcd\n"));
+  {
+#line 0
+   printf("BCD %d\n", yypos); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_3_abcd:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_abcd\n"));
+  {
+#line 0
+   printf("B %d\n", yypos); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_2_abcd:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_abcd\n"));
+  {
+#line 0
+   printf("ABC %d\n", yypos); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_abcd:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_abcd\n"));
+  {
+#line 0
+   printf("A %d\n", yypos); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    }
+}
+
+YY_RULE(int) yyrcd(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "cd"));  if (!yymatchChar(yy, 'c')) goto l1;  yyDo(yy, yy_1_cd, yy->_begin, yy->_end);  if (!yymatchChar(yy, 'd')) goto l1;  yyDo(yy, yy_2_cd, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "cd", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l1:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "cd", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrbc(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "bc"));  if (!yymatchChar(yy, 'b')) goto l2;  yyDo(yy, yy_1_bc, yy->_begin, yy->_end);  if (!yymatchChar(yy, 'c')) goto l2;  yyDo(yy, yy_2_bc, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "bc", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l2:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "bc", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrabcd(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "abcd"));
+  {  int yypos4= yy->_pos, yythunkpos4= yy->_thunkpos;  if (!yymatchChar(yy, 'a')) goto l5;  yyDo(yy, yy_1_abcd, yy->_begin, yy->_end);  if (!yyrbc(yy)) goto l5;  yyDo(yy, yy_2_abcd, yy->_begin, yy->_end);  yyText(yy, yy->_begin, yy->_end);  {
+#define yytext yy->_text
+#define yyleng yy->_textlen
+if (!(YYACCEPT)) goto l5;
+#undef yytext
+#undef yyleng
+  }  goto l4;
+  l5:;	  yy->_pos= yypos4; yy->_thunkpos= yythunkpos4;  if (!yymatchChar(yy, 'b')) goto l3;  yyDo(yy, yy_3_abcd, yy->_begin, yy->_end);  if (!yyrcd(yy)) goto l3;  yyDo(yy, yy_4_abcd, yy->_begin, yy->_end);  yyText(yy, yy->_begin, yy->_end);  {
+#define yytext yy->_text
+#define yyleng yy->_textlen
+if (!(YYACCEPT)) goto l3;
+#undef yytext
+#undef yyleng
+  }
+  }
+  l4:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "abcd", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l3:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "abcd", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrstart(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "start"));  if (!yyrabcd(yy)) goto l6;
+  l7:;	  yyPoll(yy);
+  {  int yypos8= yy->_pos, yythunkpos8= yy->_thunkpos;  if (!yyrabcd(yy)) goto l8;  goto l7;
+  l8:;	  yy->_pos= yypos8; yy->_thunkpos= yythunkpos8;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "start", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l6:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "start", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+
+#ifndef YY_PART
+
+typedef int (*yyrule)(yycontext *yy);
+
+YY_LOCAL(void) yyInit(yycontext *yy)
+{
+  yy->_buflen= YY_BUFFER_SIZE;
+  yy->_buf= (char *)YY_MALLOC(yy, yy->_buflen);
+  yy->_textlen= YY_BUFFER_SIZE;
+  yy->_text= (char *)YY_MALLOC(yy, yy->_textlen);
+  yy->_thunkslen= YY_STACK_SIZE;
+  yy->_thunks= (yythunk *)YY_MALLOC(yy, sizeof(yythunk) * yy->_thunkslen);
+#ifdef __cplusplus
+  yy->_vals = new std::vector<YYSTYPE>();
+  yy->_vals->reserve(YY_STACK_SIZE);
+#else
+  yy->_valslen= YY_STACK_SIZE;
+  yy->_vals= (YYSTYPE *)YY_MALLOC(yy, sizeof(YYSTYPE) * yy->_valslen);
+  memset(yy->_vals, 0, sizeof(YYSTYPE) * yy->_valslen);
+#endif
+  yy->_begin= yy->_end= yy->_pos= yy->_limit= yy->_maxpos= yy->_thunkpos= 0;
+}
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok, yystartthunk= 0;
+  size_t yyoffset;
+#ifdef YY_LIMITS
+  int yystartpos;
+#endif
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yyctx->_begin= yyctx->_end= -1;		/* no text yet */
+  yyctx->_thunkpos= yystartthunk;
+  yyctx->_choices= 0;
+  yyctx->_frametop= 0;
+  yyoffset= yyctx->_offset;
+#ifdef YY_STRUCTURAL
+  yyctx->_indexed= 0;
+#endif
+#ifdef YY_LIMITS
+  yyctx->_error= yyctx->_depth= 0;
+  yyctx->_stepcount= 0;
+  yystartpos= yyctx->_pos;
+  if (setjmp(yyctx->_abort))
+    {
+      if (YYLIMIT_CANCEL == yyctx->_error) yyctx->_cancel= 0;
+      yyctx->_pos= (yyctx->_offset != yyoffset) ? 0 : yystartpos;
+      yyctx->_thunkpos= yystartthunk;
+      yyCommit(yyctx);
+      return 0;
+    }
+#endif
+#ifdef __cplusplus
+  yyctx->_vals->resize(1);
+  yyctx->_val = &yyctx->_vals->back();
+#else
+  yyctx->_val= yyctx->_vals;
+#endif
+  yyok= yystart(yyctx);
+  if (yyok) yyDone(yyctx);
+  else if (yyctx->_offset != yyoffset) yyctx->_pos= 0;	/* start of parse already discarded */
+  yyCommit(yyctx);
+  return yyok;
+}
+
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
+{
+  return YYPARSEFROM(YY_CTX_ARG_ yyrstart);
+}
+
+#ifdef YY_LAZY
+
+/* Parse the text of a span that was skipped with the rule that it
+ * belongs to.  Spans within it are recorded with their offsets in the
+ * whole input.  Input that the parser has buffered is left alone.
+ */
+YY_PARSE(int) YYPARSESPAN(YY_CTX_PARAM_ const yyspan *yyspan, const char *yytext)
+{
+  char *yybuf;
+  int yybuflen, yypos, yylimit, yymaxpos, yyok;
+  size_t yyoffset;
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yybuf= yyctx->_buf;  yybuflen= yyctx->_buflen;  yypos= yyctx->_pos;  yylimit= yyctx->_limit;
+  yymaxpos= yyctx->_maxpos;  yyoffset= yyctx->_offset;
+  yyctx->_limit= yyspan->end - yyspan->begin;
+  yyctx->_buflen= yyctx->_limit + 1;
+  yyctx->_buf= (char *)YY_MALLOC(yyctx, yyctx->_buflen);
+  memcpy(yyctx->_buf, yytext, yyctx->_limit);
+  yyctx->_pos= yyctx->_maxpos= 0;
+  yyctx->_offset= yyspan->begin;
+  yyctx->_spanning= 1;
+  yyok= YYPARSEFROM(YY_CTX_ARG_ yylazyrules[yyspan->rule]) && !yyctx->_limit;
+  yyctx->_spanning= 0;
+  YY_FREE(yyctx, yyctx->_buf);
+  yyctx->_buf= yybuf;  yyctx->_buflen= yybuflen;  yyctx->_pos= yypos;  yyctx->_limit= yylimit;
+  yyctx->_maxpos= yymaxpos;  yyctx->_offset= yyoffset;
+  return yyok;
+}
+
+#endif
+
+
+#ifdef YY_COROUTINE
+
+/* The parser's stack.  Where anonymous mappings are available it sits
+ * above a page that cannot be touched, so that a parse recursing too
+ * deeply faults, as it would on the thread's own stack, instead of
+ * writing over the heap.
+ */
+#ifdef MAP_ANONYMOUS
+#define yyStackGuard()	((size_t)sysconf(_SC_PAGESIZE))
+#define yyStackSize()	((YY_COROUTINE_STACK_SIZE + yyStackGuard() - 1) / yyStackGuard() * yyStackGuard())
+
+YY_LOCAL(char *) yyStackAlloc(yycontext *yy)
+{
+  char *stack= (char *)mmap(0, yyStackGuard() + yyStackSize(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == stack) return 0;
+  if (mprotect(stack, yyStackGuard(), PROT_NONE))
+    {
+      munmap(stack, yyStackGuard() + yyStackSize());
+      return 0;
+    }
+  return stack;
+}
+
+#define yyStackFree(yy, stack)	munmap((stack), yyStackGuard() + yyStackSize())
+#else
+#define yyStackGuard()		0
+#define yyStackSize()		YY_COROUTINE_STACK_SIZE
+#define yyStackAlloc(yy)	(char *)YY_MALLOC((yy), YY_COROUTINE_STACK_SIZE)
+#define yyStackFree(yy, stack)	YY_FREE((yy), (stack))
+#endif
+
+static void yyCoroutine(unsigned int yyhi, unsigned int yylo)
+{
+  yycontext *yyctx= (yycontext *)((((uintptr_t)yyhi << 16) << 16) | (uintptr_t)yylo);
+  for (;;)
+    {
+      yyctx->_status= YYPARSEFROM(YY_CTX_ARG_ yyrstart) ? YYPARSE_ACCEPT : YYPARSE_REJECT;
+      swapcontext(&yyctx->_parser, &yyctx->_caller);
+    }
+}
+
+YY_LOCAL(int) yyResume(yycontext *yy)
+{
+  if (!yy->_stack)
+    {
+      uintptr_t yyarg= (uintptr_t)yy;
+      if (!(yy->_stack= yyStackAlloc(yy)))
+	return YYPARSE_REJECT;
+      getcontext(&yy->_parser);
+      yy->_parser.uc_stack.ss_sp= yy->_stack + yyStackGuard();
+      yy->_parser.uc_stack.ss_size= yyStackSize();
+      yy->_parser.uc_link= 0;
+      makecontext(&yy->_parser, (void (*)(void))yyCoroutine, 2, (unsigned int)((yyarg >> 16) >> 16), (unsigned int)yyarg);
+    }
+#ifdef YY_QUOTA
+  yy->_steps= yy->_quota;
+#endif
+  swapcontext(&yy->_caller, &yy->_parser);
+  return yy->_status;
+}
+
+#endif
+
+#ifdef YY_PUSH
+
+YY_PARSE(int) YYPUSH(YY_CTX_PARAM_ const char *yychunk, int yylen, int yyfinal)
+{
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+#ifdef YY_LIMITS
+  if (yyctx->_maxbuf && yyctx->_limit + yylen >= yyctx->_maxbuf)
+    {
+      yyctx->_error= YYLIMIT_BUFFER;
+      return YYPARSE_REJECT;
+    }
+#endif
+  while (yyctx->_buflen - yyctx->_limit <= yylen)
+    {
+      yyctx->_buflen *= 2;
+#ifdef YY_LIMITS
+      if (yyctx->_maxbuf && yyctx->_buflen > yyctx->_maxbuf)
+	yyctx->_buflen= yyctx->_maxbuf;
+#endif
+      yyctx->_buf= (char *)YY_REALLOC(yyctx, yyctx->_buf, yyctx->_buflen);
+    }
+  memcpy(yyctx->_buf + yyctx->_limit, yychunk, yylen);
+  yyctx->_limit += yylen;
+  yyctx->_final= yyfinal;
+  return yyResume(yyctx);
+}
+
+#endif
+
+#ifdef YY_LIMITS
+
+YY_PARSE(void) YYCANCEL(YY_CTX_PARAM)
+{
+#ifdef __GNUC__
+  __atomic_store_n(&yyctx->_cancel, 1, __ATOMIC_RELAXED);
+#else
+  *(volatile int *)&yyctx->_cancel= 1;
+#endif
+}
+
+#endif
+
+#ifdef YY_QUOTA
+
+YY_PARSE(int) YYPARSEQUOTA(YY_CTX_PARAM_ int yysteps)
+{
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yyctx->_quota= yysteps;
+  return yyResume(yyctx);
+}
+
+#endif
+
+/* Forget the last parse and any input left in the buffer, keeping the
+ * storage that the context has grown, so that the next parse starts
+ * afresh without allocating.
+ */
+YY_PARSE(void) YYRESET(YY_CTX_PARAM)
+{
+  yyctx->_begin= yyctx->_end= yyctx->_pos= yyctx->_limit= yyctx->_maxpos= yyctx->_thunkpos= yyctx->_choices= 0;
+  yyctx->_offset= 0;
+#ifdef YY_PUSH
+  yyctx->_final= 0;
+#endif
+#ifdef YY_LIMITS
+  yyctx->_error= yyctx->_cancel= 0;
+#endif
+#ifdef YY_TOKENS
+  yyctx->_tokencount= yyctx->_token= 0;
+#endif
+#ifdef YY_LAZY
+  yyctx->_spancount= 0;
+#endif
+#ifdef YY_STRUCTURAL
+  yyctx->_indexed= 0;
+#endif
+}
+
+YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)
+{
+  if (yyctx->_buflen)
+    {
+      yyctx->_buflen= 0;
+      YY_FREE(yyctx, yyctx->_buf);
+      YY_FREE(yyctx, yyctx->_text);
+      YY_FREE(yyctx, yyctx->_thunks);
+#ifdef __cplusplus
+      delete yyctx->_vals;
+#else
+      YY_FREE(yyctx, yyctx->_vals);
+#endif
+    }
+  if (yyctx->_frames)
+    {
+      YY_FREE(yyctx, yyctx->_frames);
+      yyctx->_frames= 0;
+      yyctx->_frameslen= 0;
+    }
+#ifdef YY_COROUTINE
+  if (yyctx->_stack)
+    {
+      yyStackFree(yyctx, yyctx->_stack);
+      yyctx->_stack= 0;
+    }
+#endif
+#ifdef YY_STRUCTURAL
+  if (yyctx->_index)
+    {
+      YY_FREE(yyctx, yyctx->_index);
+      yyctx->_index= 0;
+      yyctx->_indexlen= yyctx->_indexed= 0;
+    }
+#endif
+#ifdef YY_LAZY
+  if (yyctx->_spans)
+    {
+      YY_FREE(yyctx, yyctx->_spans);
+      yyctx->_spans= 0;
+      yyctx->_spanslen= yyctx->_spancount= 0;
+    }
+#endif
+#ifdef YY_TOKENS
+  if (yyctx->_tokens)
+    {
+      YY_FREE(yyctx, yyctx->_tokens);
+      yyctx->_tokens= 0;
+      yyctx->_tokenslen= yyctx->_tokencount= yyctx->_token= 0;
+    }
+#endif
+  return yyctx;
+}
+
+
+
+
+
+
+
+#endif
@@ -0,0 +1,3141 @@
+/* A recursive-descent parser generated by peg 0.1.18 */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __cplusplus
+  #include <vector>
+#endif
+#define YYRULECOUNT 22
+#line 21 "basic.leg"
+
+# include <stdio.h>
+
+  typedef struct line line;
+
+  struct line
+  {
+    int	  number;
+    int	  length;
+    char *text;
+  };
+
+  line *lines= 0;
+  int   numLines= 0;
+  int   pc= -1, epc= -1;
+  int   batch= 0;
+
+  int nextline(char *buf, int max);
+
+# define min(x, y) ((x) < (y) ? (x) : (y))
+
+# define YY_INPUT(buf, result, max_size)	\
+  {						\
+    if ((pc >= 0) && (pc < numLines))		\
+      {						\
+        line *linep= lines+pc++;		\
+        result= min(max_size, linep->length);	\
+        memcpy(buf, linep->text, result);	\
+      }						\
+    else					\
+      result= nextline(buf, max_size);		\
+  }
+
+  union value {
+    int		  number;
+    char	 *string;
+    int		(*binop)(int lhs, int rhs);
+  };
+
+# define YYSTYPE union value
+
+  int variables[26];
+
+  void accept(int number, char *line);
+
+  void save(char *name);
+  void load(char *name);
+  void type(char *name);
+
+  int lessThan(int lhs, int rhs)	{ return lhs <  rhs; }
+  int lessEqual(int lhs, int rhs)	{ return lhs <= rhs; }
+  int notEqual(int lhs, int rhs)	{ return lhs != rhs; }
+  int equalTo(int lhs, int rhs)		{ return lhs == rhs; }
+  int greaterEqual(int lhs, int rhs)	{ return lhs >= rhs; }
+  int greaterThan(int lhs, int rhs)	{ return lhs >  rhs; }
+
+  int input(void);
+
+  int stack[1024], sp= 0;
+
+  char *help;
+
+  void error(char *fmt, ...);
+  int findLine(int n, int create);
+
+#ifndef YY_MALLOC
+#define YY_MALLOC(C, N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(C, P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(C, P)		free(P)
+#endif
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YY_UNUSED
+# ifdef __GNUC__
+#  define YY_UNUSED	__attribute__((unused))
+# else
+#  define YY_UNUSED
+# endif
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YYRESET
+#define YYRESET		yyreset
+#endif
+#if defined(YY_LAZY) && !defined(YYPARSESPAN)
+#define YYPARSESPAN	yyparsespan
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( yy->_begin= yy->_pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( yy->_end= yy->_pos, 1)
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+#ifndef YY_STACK_SIZE
+#define YY_STACK_SIZE 128
+#endif
+
+#ifndef YY_BUFFER_SIZE
+#define YY_BUFFER_SIZE 1024
+#endif
+
+#if defined(YY_PUSH) || defined(YY_QUOTA)
+#define YY_COROUTINE
+#if defined(__has_include)
+#if !__has_include(<ucontext.h>)
+#error "YY_PUSH needs ucontext, which this platform does not provide"
+#endif
+#elif defined(_WIN32)
+#error "YY_PUSH needs ucontext, which this platform does not provide"
+#endif
+#include <stdint.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#if !defined(YY_COROUTINE_STACK_SIZE) && defined(YY_PUSH_STACK_SIZE)
+#define YY_COROUTINE_STACK_SIZE YY_PUSH_STACK_SIZE
+#endif
+#ifndef YY_COROUTINE_STACK_SIZE
+#define YY_COROUTINE_STACK_SIZE (256 * 1024)
+#endif
+enum { YYPARSE_NEED_MORE= 0, YYPARSE_ACCEPT, YYPARSE_REJECT, YYPARSE_YIELD };
+#define YYPUSH_NEED_MORE	YYPARSE_NEED_MORE	/* the names used before YY_QUOTA */
+#define YYPUSH_ACCEPT		YYPARSE_ACCEPT
+#define YYPUSH_REJECT		YYPARSE_REJECT
+#endif
+#ifdef YY_PUSH
+#ifndef YYPUSH
+#define YYPUSH		yypush
+#endif
+#endif
+#ifdef YY_QUOTA
+#ifndef YYPARSEQUOTA
+#define YYPARSEQUOTA	yyparsequota
+#endif
+#endif
+#ifdef YY_STRUCTURAL
+#include <stdint.h>
+#endif
+#define yyEventEnter(yy, rule)
+#define yyEventLeave(yy, rule)
+#ifdef YY_LIMITS
+#include <setjmp.h>
+#ifndef YYCANCEL
+#define YYCANCEL	yycancel
+#endif
+enum { YYLIMIT_NONE= 0, YYLIMIT_STEPS, YYLIMIT_DEPTH, YYLIMIT_BUFFER, YYLIMIT_THUNKS, YYLIMIT_CANCEL };
+#endif
+
+#ifndef YY_PART
+
+typedef struct _yycontext yycontext;
+typedef struct _yythunk { int begin, end;  unsigned short action; } yythunk;
+#ifdef YY_TOKENS
+typedef struct _yytoken { int kind;  size_t begin, end; } yytoken;
+#endif
+#ifdef YY_LAZY
+typedef struct _yyspan { int rule;  size_t begin, end; } yyspan;
+#endif
+
+enum { yyThunkPush= 0, yyThunkPop, yyThunkSet, yyThunkActions };
+
+struct _yycontext {
+  char     *_buf;
+  int       _buflen;
+  int       _pos;
+  int       _limit;
+  int       _maxpos;
+  char     *_text;
+  int       _textlen;
+  int       _begin;
+  int       _end;
+  int       _textmax;
+  yythunk  *_thunks;
+  int       _thunkslen;
+  int       _thunkpos;
+  int       _choices;
+  size_t    _offset;
+  YYSTYPE   _;
+  YYSTYPE  *_val;
+#ifdef __cplusplus
+  std::vector<YYSTYPE>* _vals;
+#else
+  YYSTYPE  *_vals;
+  int       _valslen;
+#endif
+  int      *_frames;
+  int       _frameslen;
+  int       _frametop;
+#ifdef YY_COROUTINE
+  int       _final;
+  int       _status;
+  char     *_stack;
+  ucontext_t _parser;
+  ucontext_t _caller;
+#endif
+#ifdef YY_QUOTA
+  int       _quota;
+  int       _steps;
+#endif
+#ifdef YY_LIMITS
+  long      _maxsteps;
+  int       _maxdepth;
+  int       _maxbuf;
+  int       _maxthunks;
+  int       _cancel;
+  int       _error;
+  long      _stepcount;
+  int       _depth;
+  jmp_buf   _abort;
+#endif
+#ifdef YY_TOKENS
+  yytoken  *_tokens;
+  int       _tokenslen;
+  int       _tokencount;
+  int       _token;
+#endif
+#ifdef YY_STRUCTURAL
+  uint64_t *_index;
+  int       _indexlen;
+  int       _indexed;
+#endif
+#ifdef YY_LAZY
+  yyspan   *_spans;
+  int       _spanslen;
+  int       _spancount;
+  int       _spanning;
+#endif
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+};
+
+#ifdef YY_CTX_LOCAL
+#define YY_CTX_PARAM_	yycontext *yyctx,
+#define YY_CTX_PARAM	yycontext *yyctx
+#define YY_CTX_ARG_	yyctx,
+#define YY_CTX_ARG	yyctx
+#ifndef YY_INPUT
+#define YY_INPUT(yy, buf, result, max_size)		\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#else
+#define YY_CTX_PARAM_
+#define YY_CTX_PARAM
+#define YY_CTX_ARG_
+#define YY_CTX_ARG
+yycontext yyctx_= { 0, 0 };
+yycontext *yyctx= &yyctx_;
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#endif
+
+#ifdef YY_LIMITS
+#ifdef __GNUC__
+#define yyCancelled(yy)	__atomic_load_n(&yy->_cancel, __ATOMIC_RELAXED)
+#else
+#define yyCancelled(yy)	(*(volatile int *)&yy->_cancel)
+#endif
+YY_LOCAL(void) yyAbort(yycontext *yy, int error)
+{
+  yyprintf((stderr, "limit: abort %d\n", error));
+  yy->_error= error;
+  longjmp(yy->_abort, 1);
+}
+#define yyEnter(yy)	do { if (++yy->_depth > yy->_maxdepth && yy->_maxdepth) yyAbort(yy, YYLIMIT_DEPTH); } while (0)
+#define yyLeave(yy)	--yy->_depth
+#define yyPoll(yy)	do { if (yyCancelled(yy)) yyAbort(yy, YYLIMIT_CANCEL); } while (0)
+#define yyGrow(yy, size, max, error)	do { if ((max) && (size) > (max)) yyAbort(yy, error); } while (0)
+#else
+#define yyEnter(yy)
+#define yyLeave(yy)
+#define yyPoll(yy)
+#define yyGrow(yy, size, max, error)
+#endif
+
+
+
+YY_LOCAL(int) yyrefill(yycontext *yy)
+{
+  int yyn;
+#ifdef YY_LAZY
+  if (yy->_spanning) return 0;
+#endif
+#ifdef YY_PUSH
+  while (yy->_pos >= yy->_limit && !yy->_final)
+    {
+      yyprintf((stderr, "push: need more\n"));
+      yy->_status= YYPARSE_NEED_MORE;
+      swapcontext(&yy->_parser, &yy->_caller);
+    }
+  return yy->_pos < yy->_limit;
+#endif
+  while (yy->_buflen - yy->_pos < 512)
+    {
+      int yylen= yy->_buflen * 2;
+#ifdef YY_LIMITS
+      if (yy->_maxbuf && yylen > yy->_maxbuf)
+	{
+	  if (yy->_buflen >= yy->_maxbuf && yy->_buflen > yy->_pos)
+	    break;					/* read into what room is left */
+	  yyGrow(yy, yy->_pos + 1, yy->_maxbuf, YYLIMIT_BUFFER);
+	  yylen= yy->_maxbuf;
+	}
+#endif
+      yy->_buflen= yylen;
+      yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);
+    }
+#ifdef YY_CTX_LOCAL
+  YY_INPUT(yy, (yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));
+#else
+  YY_INPUT((yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));
+#endif
+  if (!yyn) return 0;
+  yy->_limit += yyn;
+  return 1;
+}
+
+YY_LOCAL(void) yyrecordMaxPos(yycontext *yy)
+{
+  if (yy->_pos > yy->_maxpos) {
+    yy->_maxpos = yy->_pos;
+    yyprintf((stderr, "       maxpos=%d [after '%c']\n", yy->_maxpos, yy->_buf[yy->_maxpos-1]));
+  }
+}
+
+#if defined(YY_QUOTA) || defined(YY_LIMITS)
+YY_LOCAL(void) yyStep(yycontext *yy)
+{
+#ifdef YY_LIMITS
+  if (yy->_maxsteps && ++yy->_stepcount > yy->_maxsteps)
+    yyAbort(yy, YYLIMIT_STEPS);
+#endif
+#ifdef YY_QUOTA
+  if (yy->_quota && --yy->_steps < 0)
+    {
+      yyprintf((stderr, "quota: yield\n"));
+      yy->_status= YYPARSE_YIELD;
+      swapcontext(&yy->_parser, &yy->_caller);
+    }
+#endif
+}
+#else
+#define yyStep(yy)
+#endif
+
+/* Scanners match most terminals in place, so any of these may go unused. */
+YY_LOCAL(int) YY_UNUSED yymatchDot(yycontext *yy)
+{
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  ++yy->_pos;
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchChar(yycontext *yy, int c)
+{
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  if ((unsigned char)yy->_buf[yy->_pos] == c)
+    {
+      ++yy->_pos;
+      yyrecordMaxPos(yy);
+      yyprintf((stderr, "  ok   yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+  return 0;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchString(yycontext *yy, const char *s)
+{
+  int yysav= yy->_pos;
+  yyStep(yy);
+  while (*s)
+    {
+      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+      if (yy->_buf[yy->_pos] != *s)
+	{
+	  yy->_pos= yysav;
+	  return 0;
+	}
+      ++s;
+      ++yy->_pos;
+    }
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchIString(yycontext *yy, const char *s)
+{
+  int yysav= yy->_pos;
+  yyStep(yy);
+  while (*s)
+    {
+      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+      if (tolower(yy->_buf[yy->_pos]) != *s)
+        {
+          yy->_pos= yysav;
+          return 0;
+        }
+      ++s;
+      ++yy->_pos;
+    }
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchClass(yycontext *yy, unsigned char *bits)
+{
+  int c;
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  c= (unsigned char)yy->_buf[yy->_pos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++yy->_pos;
+      yyrecordMaxPos(yy);
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", yy->_buf+yy->_pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", yy->_buf+yy->_pos));
+  return 0;
+}
+
+#define yyAvail(yy, p)		((p) < (yy)->_limit || ((yy)->_pos= (p), yyrefill(yy)))
+#define yyByte(yy, p)		((unsigned char)(yy)->_buf[p])
+#define yyInClass(bits, c)	((bits)[(c) >> 3] & (1 << ((c) & 7)))
+
+#ifdef YY_FRAMES
+YY_LOCAL(int *) yyGrowFrames(yycontext *yy, int size)
+{
+  if (!yy->_frameslen)
+    {
+      yy->_frameslen= YY_STACK_SIZE;
+      yy->_frames= (int *)YY_MALLOC(yy, sizeof(int) * yy->_frameslen);
+    }
+  while (yy->_frameslen < size)
+    {
+      yy->_frameslen *= 2;
+      yy->_frames= (int *)YY_REALLOC(yy, yy->_frames, sizeof(int) * yy->_frameslen);
+    }
+  return yy->_frames;
+}
+#endif
+
+YY_LOCAL(void) yyDo(yycontext *yy, int action, int begin, int end)
+{
+  yyGrow(yy, yy->_thunkpos + 1, yy->_maxthunks, YYLIMIT_THUNKS);
+  while (yy->_thunkpos >= yy->_thunkslen)
+    {
+      yy->_thunkslen *= 2;
+#ifdef YY_LIMITS
+      if (yy->_maxthunks && yy->_thunkslen > yy->_maxthunks)
+	yy->_thunkslen= yy->_maxthunks;
+#endif
+      yy->_thunks= (yythunk *)YY_REALLOC(yy, yy->_thunks, sizeof(yythunk) * yy->_thunkslen);
+    }
+  yy->_thunks[yy->_thunkpos].begin=  begin;
+  yy->_thunks[yy->_thunkpos].end=    end;
+  yy->_thunks[yy->_thunkpos].action= action;
+  ++yy->_thunkpos;
+}
+
+YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (yy->_textlen < (yyleng + 1))
+	{
+	  yy->_textlen *= 2;
+	  yy->_text= (char *)YY_REALLOC(yy, yy->_text, yy->_textlen);
+	}
+      memcpy(yy->_text, yy->_buf + begin, yyleng);
+    }
+  yy->_text[yyleng]= '\0';
+  return yyleng;
+}
+
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng);
+
+#ifdef YY_LAZY
+YY_LOCAL(void) yySpan(yycontext *yy, int rule, int begin, int end)
+{
+  yyspan *span;
+  if (yy->_spancount == yy->_spanslen)
+    {
+      yy->_spanslen= yy->_spanslen ? 2 * yy->_spanslen : YY_STACK_SIZE;
+      yy->_spans= (yyspan *)YY_REALLOC(yy, yy->_spans, sizeof(yyspan) * yy->_spanslen);
+    }
+  span= yy->_spans + yy->_spancount++;
+  span->rule=  rule;
+  span->begin= yy->_offset + begin;
+  span->end=   yy->_offset + end;
+}
+#endif
+
+
+YY_LOCAL(void) yyDone(yycontext *yy)
+{
+  int pos;
+  for (pos= 0;  pos < yy->_thunkpos;  ++pos)
+    {
+      yythunk *thunk= &yy->_thunks[pos];
+      int yyleng;
+#ifdef YY_LAZY
+      if (thunk->action >= YY_LAZY)
+	{
+	  yySpan(yy, thunk->action - YY_LAZY, thunk->begin, thunk->end);
+	  continue;
+	}
+#endif
+      yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %d %s\n", pos, thunk->action, yy->_text));
+      yyDispatch(yy, thunk->action, yy->_text, yyleng);
+    }
+  yy->_thunkpos= 0;
+}
+
+#ifdef YY_TOKENS
+/* Forget the tokens that begin before the buffer, which can no longer
+ * be matched again.
+ */
+YY_LOCAL(void) yyDropTokens(yycontext *yy)
+{
+  int n= 0;
+  while (n < yy->_tokencount && yy->_tokens[n].begin < yy->_offset) ++n;
+  if (n) memmove(yy->_tokens, yy->_tokens + n, sizeof(yytoken) * (yy->_tokencount -= n));
+  yy->_token= 0;
+}
+#endif
+
+YY_LOCAL(void) yyCommit(yycontext *yy)
+{
+  yy->_limit -= yy->_pos;
+  if (yy->_limit)
+    memmove(yy->_buf, yy->_buf + yy->_pos, yy->_limit);
+  yy->_begin -= yy->_pos;
+  yy->_end -= yy->_pos;
+  yy->_offset += yy->_pos;
+  yy->_pos= yy->_thunkpos= 0;
+#ifdef YY_STRUCTURAL
+  yy->_indexed= 0;
+#endif
+#ifdef YY_TOKENS
+  yyDropTokens(yy);
+#endif
+}
+
+#ifdef YY_STREAM
+YY_LOCAL(void) yyStream(yycontext *yy)
+{
+  int keep= yy->_pos;
+  if (yy->_begin >= 0 && yy->_begin < keep) keep= yy->_begin;
+  if (yy->_end   >= 0 && yy->_end   < keep) keep= yy->_end;
+  yyDone(yy);
+  if (keep > 0 && keep >= yy->_limit - keep)
+    {
+      yyprintf((stderr, "stream %d of %d\n", keep, yy->_limit));
+      yy->_limit -= keep;
+      memmove(yy->_buf, yy->_buf + keep, yy->_limit);
+      yy->_pos -= keep;
+      yy->_begin -= keep;
+      yy->_end -= keep;
+      yy->_maxpos= (yy->_maxpos > keep) ? yy->_maxpos - keep : 0;
+      yy->_offset += keep;
+#ifdef YY_STRUCTURAL
+      yy->_indexed= 0;
+#endif
+#ifdef YY_TOKENS
+      yyDropTokens(yy);
+#endif
+    }
+}
+#endif
+
+YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(yy);
+      yyCommit(yy);
+    }
+  return 1;
+}
+
+YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)
+{
+#ifdef __cplusplus
+  yy->_vals->resize(yy->_vals->size() + count);
+  yy->_val = &yy->_vals->back();
+#else
+  yy->_val += count;
+  while (yy->_valslen <= yy->_val - yy->_vals)
+    {
+      long offset= yy->_val - yy->_vals;
+      size_t oldlen = yy->_valslen;
+      yy->_valslen *= 2;
+      yy->_vals= (YYSTYPE *)YY_REALLOC(yy, yy->_vals, sizeof(YYSTYPE) * yy->_valslen);
+      memset(&yy->_vals[oldlen], 0, sizeof(YYSTYPE) * oldlen);
+      yy->_val= yy->_vals + offset;
+    }
+#endif
+}
+YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)
+{
+#ifdef __cplusplus
+  yy->_vals->resize(yy->_vals->size() - count);
+  yy->_val = &yy->_vals->back();
+#else
+  yy->_val -= count;
+#endif
+}
+YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)   { yy->_val[count]= yy->_; }
+
+#ifdef YY_LAZY
+#ifndef YY_LAZY_QUOTE
+#define YY_LAZY_QUOTE(c)	('"' == (c) || '\'' == (c))
+#define YY_LAZY_WORDS		/* the quotes are known, so eight bytes can be tested at once */
+#endif
+#ifndef YY_LAZY_COMMENTS
+#define YY_LAZY_COMMENTS	1
+#endif
+#ifdef YY_LAZY_WORDS
+#define yyLazyHas(w, c)	((((w) ^ 0x0101010101010101ULL * (c)) - 0x0101010101010101ULL) & ~((w) ^ 0x0101010101010101ULL * (c)) & 0x8080808080808080ULL)
+#endif
+/* Move over a balanced region without parsing it, and remember where
+ * it was so that it can be parsed later.  Brackets within quotes or
+ * C comments are not counted.  Unless the program has its own quotes,
+ * text between the bytes that matter is passed over a word at a time.
+ */
+YY_LOCAL(int) yyskipLazy(yycontext *yy, int rule, int open, int close)
+{
+  int pos= yy->_pos, p= pos, depth= 0, c;
+  yyStep(yy);
+  if (!yyAvail(yy, p) || yyByte(yy, p) != open)
+    {
+      yy->_pos= pos;
+      return 0;
+    }
+  for (;;)
+    {
+#ifdef YY_LAZY_WORDS
+      for (;  p + 8 <= yy->_limit;  p += 8)
+	{
+	  unsigned long long w;
+	  memcpy(&w, yy->_buf + p, 8);
+	  if (yyLazyHas(w, open) | yyLazyHas(w, close) | yyLazyHas(w, '"') | yyLazyHas(w, '\'') | yyLazyHas(w, '/'))
+	    break;
+	}
+#endif
+      while (p < yy->_limit && (c= yyByte(yy, p)) != open && c != close && !YY_LAZY_QUOTE(c) && '/' != c)
+	++p;
+      if (!yyAvail(yy, p))
+	{
+	  yy->_pos= pos;
+	  return 0;
+	}
+      c= yyByte(yy, p++);
+      if (c == open)
+	++depth;
+      else if (c == close)
+	{
+	  if (!--depth) break;
+	}
+      else if (YY_LAZY_QUOTE(c))
+	{
+	  int d;
+	  while (yyAvail(yy, p) && (d= yyByte(yy, p++)) != c)
+	    if ('\\' == d && yyAvail(yy, p)) ++p;
+	}
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '/' == yyByte(yy, p))
+	{
+	  while (yyAvail(yy, p) && '\n' != yyByte(yy, p)) ++p;
+	}
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '*' == yyByte(yy, p))
+	{
+	  for (++p;  yyAvail(yy, p) && !('*' == yyByte(yy, p) && yyAvail(yy, p + 1) && '/' == yyByte(yy, p + 1));  ++p);
+	  if (yyAvail(yy, p)) p += 2;
+	}
+    }
+  yy->_pos= p;
+  yyrecordMaxPos(yy);
+  yyDo(yy, YY_LAZY + rule, pos, p);
+  return 1;
+}
+#endif
+
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)
+
+YY_RULE(int) yyrdigit(yycontext *yy); /* 22 */
+YY_RULE(int) yyrCLOSE(yycontext *yy); /* 21 */
+YY_RULE(int) yyrOPEN(yycontext *yy); /* 20 */
+YY_RULE(int) yyrSLASH(yycontext *yy); /* 19 */
+YY_RULE(int) yyrSTAR(yycontext *yy); /* 18 */
+YY_RULE(int) yyrfactor(yycontext *yy); /* 17 */
+YY_RULE(int) yyrMINUS(yycontext *yy); /* 16 */
+YY_RULE(int) yyrterm(yycontext *yy); /* 15 */
+YY_RULE(int) yyrPLUS(yycontext *yy); /* 14 */
+YY_RULE(int) yyrCOMMA(yycontext *yy); /* 13 */
+YY_RULE(int) yyrstring(yycontext *yy); /* 12 */
+YY_RULE(int) yyrEQUAL(yycontext *yy); /* 11 */
+YY_RULE(int) yyrvar(yycontext *yy); /* 10 */
+YY_RULE(int) yyrvar_list(yycontext *yy); /* 9 */
+YY_RULE(int) yyrrelop(yycontext *yy); /* 8 */
+YY_RULE(int) yyrexpression(yycontext *yy); /* 7 */
+YY_RULE(int) yyrexpr_list(yycontext *yy); /* 6 */
+YY_RULE(int) yyrnumber(yycontext *yy); /* 5 */
+YY_RULE(int) yyrCR(yycontext *yy); /* 4 */
+YY_RULE(int) yyrstatement(yycontext *yy); /* 3 */
+YY_RULE(int) yyr_(yycontext *yy); /* 2 */
+YY_RULE(int) yyrline(yycontext *yy); /* 1 */
+
+enum {
+  yy_6_relop= yyThunkActions + 42,
+  yy_5_relop= yyThunkActions + 41,
+  yy_4_relop= yyThunkActions + 40,
+  yy_3_relop= yyThunkActions + 39,
+  yy_2_relop= yyThunkActions + 38,
+  yy_1_relop= yyThunkActions + 37,
+  yy_1_string= yyThunkActions + 36,
+  yy_1_number= yyThunkActions + 35,
+  yy_1_var= yyThunkActions + 34,
+  yy_1_factor= yyThunkActions + 33,
+  yy_3_term= yyThunkActions + 32,
+  yy_2_term= yyThunkActions + 31,
+  yy_1_term= yyThunkActions + 30,
+  yy_4_expression= yyThunkActions + 29,
+  yy_3_expression= yyThunkActions + 28,
+  yy_2_expression= yyThunkActions + 27,
+  yy_1_expression= yyThunkActions + 26,
+  yy_2_var_list= yyThunkActions + 25,
+  yy_1_var_list= yyThunkActions + 24,
+  yy_5_expr_list= yyThunkActions + 23,
+  yy_4_expr_list= yyThunkActions + 22,
+  yy_3_expr_list= yyThunkActions + 21,
+  yy_2_expr_list= yyThunkActions + 20,
+  yy_1_expr_list= yyThunkActions + 19,
+  yy_16_statement= yyThunkActions + 18,
+  yy_15_statement= yyThunkActions + 17,
+  yy_14_statement= yyThunkActions + 16,
+  yy_13_statement= yyThunkActions + 15,
+  yy_12_statement= yyThunkActions + 14,
+  yy_11_statement= yyThunkActions + 13,
+  yy_10_statement= yyThunkActions + 12,
+  yy_9_statement= yyThunkActions + 11,
+  yy_8_statement= yyThunkActions + 10,
+  yy_7_statement= yyThunkActions + 9,
+  yy_6_statement= yyThunkActions + 8,
+  yy_5_statement= yyThunkActions + 7,
+  yy_4_statement= yyThunkActions + 6,
+  yy_3_statement= yyThunkActions + 5,
+  yy_2_statement= yyThunkActions + 4,
+  yy_1_statement= yyThunkActions + 3,
+  yy_3_line= yyThunkActions + 2,
+  yy_2_line= yyThunkActions + 1,
+  yy_1_line= yyThunkActions + 0,
+};
+
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng)
+{
+  switch (yyaction)
+    {
+    case yyThunkPush:	yyPush(yy, yytext, yyleng);	break;
+    case yyThunkPop:	yyPop(yy, yytext, yyleng);	break;
+    case yyThunkSet:	yySet(yy, yytext, yyleng);	break;
+    case yy_6_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_6_relop\n"));
+  {
+#line 155
+   y_.binop= equalTo; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_5_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_5_relop\n"));
+  {
+#line 154
+   y_.binop= greaterThan; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_4_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_relop\n"));
+  {
+#line 153
+   y_.binop= greaterEqual; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_3_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_relop\n"));
+  {
+#line 152
+   y_.binop= lessThan; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_2_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_relop\n"));
+  {
+#line 151
+   y_.binop= notEqual; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_relop\n"));
+  {
+#line 150
+   y_.binop= lessEqual; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_string:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_string\n"));
+  {
+#line 148
+   y_.string = yytext; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_number:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_number\n"));
+  {
+#line 144
+   y_.number = atoi(yytext); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_var:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_var\n"));
+  {
+#line 142
+   y_.number = yytext[0] - 'a' ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_factor:
+      {
+#define n yy->_val[-1]
+#define v yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_factor\n"));
+  {
+#line 138
+   y_.number = variables[v.number] ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef n
+#undef v
+      }
+      break;
+    case yy_3_term:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_term\n"));
+  {
+#line 136
+   y_.number = l.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_term:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_term\n"));
+  {
+#line 135
+   l.number /= r.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_1_term:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_term\n"));
+  {
+#line 134
+   l.number *= r.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_4_expression:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_expression\n"));
+  {
+#line 132
+   y_.number = l.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_3_expression:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_expression\n"));
+  {
+#line 131
+   l.number -= r.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_expression:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_expression\n"));
+  {
+#line 130
+   l.number += r.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_1_expression:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_expression\n"));
+  {
+#line 129
+   l.number = -l.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_var_list:
+      {
+#define v yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_var_list\n"));
+  {
+#line 125
+   variables[v.number]= input(); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef v
+      }
+      break;
+    case yy_1_var_list:
+      {
+#define v yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_var_list\n"));
+  {
+#line 124
+   variables[v.number]= input(); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef v
+      }
+      break;
+    case yy_5_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_5_expr_list\n"));
+  {
+#line 121
+   printf("\n"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_4_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_expr_list\n"));
+  {
+#line 118
+   printf("%d", e.number); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_3_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_expr_list\n"));
+  {
+#line 117
+   printf("%s", e.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_2_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_expr_list\n"));
+  {
+#line 116
+   printf("%d", e.number); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_1_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_expr_list\n"));
+  {
+#line 115
+   printf("%s", e.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_16_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_16_statement\n"));
+  {
+#line 113
+   fprintf(stderr, "%s", help); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_15_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_15_statement\n"));
+  {
+#line 112
+   system("ls *.bas"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_14_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_14_statement\n"));
+  {
+#line 111
+   type(s.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_13_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_13_statement\n"));
+  {
+#line 110
+   load(s.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_12_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_12_statement\n"));
+  {
+#line 109
+   save(s.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_11_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_11_statement\n"));
+  {
+#line 108
+   exit(0); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_10_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_10_statement\n"));
+  {
+#line 106
+   pc= -1;  if (batch) exit(0); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_9_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_9_statement\n"));
+  {
+#line 105
+   pc= 0; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_8_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_8_statement\n"));
+  {
+#line 104
+   load(s.string);  pc= 0; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_7_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_7_statement\n"));
+  {
+#line 103
+   int i;  for (i= 0;  i < numLines;  ++i) printf("%5d %s", lines[i].number, lines[i].text); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_6_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_6_statement\n"));
+  {
+#line 102
+   while (numLines) accept(lines->number, "\n"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_5_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_5_statement\n"));
+  {
+#line 101
+   epc= pc;  if ((pc= sp ? stack[--sp] : -1) < 0) error("no gosub"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_4_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_statement\n"));
+  {
+#line 99
+   epc= pc;  if (sp < 1024) stack[sp++]= pc, pc= findLine(e.number, 0); else error("too many gosubs");
+							  if (pc < 0) error("no such line"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_3_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_statement\n"));
+  {
+#line 98
+   variables[v.number]= e.number; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_2_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_statement\n"));
+  {
+#line 96
+   epc= pc;  if ((pc= findLine(e.number, 0)) < 0) error("no such line"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_1_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_statement\n"));
+  {
+#line 94
+   if (!r.binop(e1.number, e2.number)) yythunkpos= 0; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_3_line:
+      {
+#define n yy->_val[-1]
+#define s yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_line\n"));
+  {
+#line 91
+   exit(0); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef n
+#undef s
+      }
+      break;
+    case yy_2_line:
+      {
+#define n yy->_val[-1]
+#define s yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_line\n"));
+  {
+#line 90
+   epc= pc;  error("syntax error"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef n
+#undef s
+      }
+      break;
+    case yy_1_line:
+      {
+#define n yy->_val[-1]
+#define s yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_line\n"));
+  {
+#line 88
+   accept(n.number, yytext); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef n
+#undef s
+      }
+      break;
+    }
+}
+
+
+YY_LOCAL(int) yyscan0(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 41) goto l1;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l1:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan1(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 40) goto l2;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l2:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan2(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 47) goto l3;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l3:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan3(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 42) goto l4;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l4:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan4(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 45) goto l5;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l5:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan5(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 43) goto l6;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l6:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan6(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 44) goto l7;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l7:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan7(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 34) goto l8;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l8;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\377\377\377\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_END)) goto l8;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 34) goto l8;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l8:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan8(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 61) goto l9;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l9:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan9(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l10;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l10;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_END)) goto l10;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l10:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan10(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 60) goto l11;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 61) goto l11;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l11:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan11(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 60) goto l12;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 62) goto l12;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l12:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan12(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 60) goto l13;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l13:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan13(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 62) goto l14;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 61) goto l14;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l14:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan14(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 62) goto l15;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l15:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan15(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 61) goto l16;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l16:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan16(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq18= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 43) goto l18;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;  goto l19;
+  l18:;	  yyp= yyq18;
+  l19:;	  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+}
+
+YY_LOCAL(int) yyscan17(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq21= yyp, yym21= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 44) goto l21;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;  yym= yym21;  goto l20;
+  l21:;	  yyp= yyq21;  yym= yym21;  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l20:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan18(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l22;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l22;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq24;
+  l23:;	  yyPoll(yy);  yyq24= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l24;  ++yyp;  if (yyp > yym) yym= yyp;  goto l23;
+  l24:;	  yyp= yyq24;  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l22;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l22:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan19(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq27= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l28;  ++yyp;  if (yyp > yym) yym= yyp;  goto l26;
+  l28:;	  yyp= yyq27;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l29;  ++yyp;  if (yyp > yym) yym= yyp;  goto l26;
+  l29:;	  yyp= yyq27;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l25;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l25;  ++yyp;  if (yyp > yym) yym= yyp;
+  l26:;	  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l25:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan20(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 112) goto l30;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 114) goto l30;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 105) goto l30;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 110) goto l30;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l30;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l30:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan21(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 105) goto l31;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 102) goto l31;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l31:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan22(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l32;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 104) goto l32;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l32;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 110) goto l32;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l32:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan23(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 103) goto l33;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 111) goto l33;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l33;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 111) goto l33;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l33:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan24(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 105) goto l34;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 110) goto l34;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 112) goto l34;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 117) goto l34;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l34;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l34:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan25(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 108) goto l35;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l35;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l35;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l35:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan26(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 103) goto l36;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 111) goto l36;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 115) goto l36;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 117) goto l36;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 98) goto l36;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l36:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan27(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 114) goto l37;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l37;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l37;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 117) goto l37;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 114) goto l37;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 110) goto l37;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l37:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan28(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 99) goto l38;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 108) goto l38;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l38;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 97) goto l38;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 114) goto l38;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l38:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan29(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 108) goto l39;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 105) goto l39;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 115) goto l39;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l39;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l39:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan30(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 114) goto l40;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 117) goto l40;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 110) goto l40;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l40:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan31(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 114) goto l41;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 117) goto l41;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 110) goto l41;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l41:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan32(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l42;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 110) goto l42;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 100) goto l42;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l42:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan33(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 114) goto l43;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l43;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 109) goto l43;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  { int yyq45;
+  l44:;	  yyPoll(yy);  yyq45= yyp;
+  { int yyq46= yyp, yym46= yym;
+  { int yyq48= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l49;  ++yyp;  if (yyp > yym) yym= yyp;  goto l47;
+  l49:;	  yyp= yyq48;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l50;  ++yyp;  if (yyp > yym) yym= yyp;  goto l47;
+  l50:;	  yyp= yyq48;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l46;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l46;  ++yyp;  if (yyp > yym) yym= yyp;
+  l47:;	  }  yym= yym46;  goto l45;
+  l46:;	  yyp= yyq46;  yym= yym46;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l45;  ++yyp;  if (yyp > yym) yym= yyp;  goto l44;
+  l45:;	  yyp= yyq45;  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l43:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan34(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq53= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 98) goto l54;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 121) goto l54;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l54;  ++yyp;  if (yyp > yym) yym= yyp;  goto l52;
+  l54:;	  yyp= yyq53;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 113) goto l55;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 117) goto l55;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 105) goto l55;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l55;  ++yyp;  if (yyp > yym) yym= yyp;  goto l52;
+  l55:;	  yyp= yyq53;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l51;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l51;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 105) goto l51;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l51;  ++yyp;  if (yyp > yym) yym= yyp;
+  l52:;	  }
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l51:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan35(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 115) goto l56;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 97) goto l56;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 118) goto l56;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l56;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l56:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan36(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 108) goto l57;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 111) goto l57;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 97) goto l57;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 100) goto l57;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l57:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan37(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 116) goto l58;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 121) goto l58;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 112) goto l58;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l58;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l58:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan38(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 100) goto l59;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 105) goto l59;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 114) goto l59;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l59:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan39(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 104) goto l60;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 101) goto l60;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 108) goto l60;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 112) goto l60;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l60:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan40(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+}
+
+YY_LOCAL(int) yyscan41(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l62;
+  { int yyq64;
+  l63:;	  yyPoll(yy);  yyq64= yyp;
+  { int yyq65= yyp, yym65= yym;
+  { int yyq67= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l68;  ++yyp;  if (yyp > yym) yym= yyp;  goto l66;
+  l68:;	  yyp= yyq67;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l69;  ++yyp;  if (yyp > yym) yym= yyp;  goto l66;
+  l69:;	  yyp= yyq67;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l65;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l65;  ++yyp;  if (yyp > yym) yym= yyp;
+  l66:;	  }  yym= yym65;  goto l64;
+  l65:;	  yyp= yyq65;  yym= yym65;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l64;  ++yyp;  if (yyp > yym) yym= yyp;  goto l63;
+  l64:;	  yyp= yyq64;  }
+  { int yyq71= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l72;  ++yyp;  if (yyp > yym) yym= yyp;  goto l70;
+  l72:;	  yyp= yyq71;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l73;  ++yyp;  if (yyp > yym) yym= yyp;  goto l70;
+  l73:;	  yyp= yyq71;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l62;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l62;  ++yyp;  if (yyp > yym) yym= yyp;
+  l70:;	  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l62;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l62:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan42(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  { int yyq76= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l77;  ++yyp;  if (yyp > yym) yym= yyp;  goto l75;
+  l77:;	  yyp= yyq76;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l78;  ++yyp;  if (yyp > yym) yym= yyp;  goto l75;
+  l78:;	  yyp= yyq76;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l74;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l74;  ++yyp;  if (yyp > yym) yym= yyp;
+  l75:;	  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l74:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan43(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l79;
+  { int yyq81;
+  l80:;	  yyPoll(yy);  yyq81= yyp;
+  { int yyq82= yyp, yym82= yym;
+  { int yyq84= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l85;  ++yyp;  if (yyp > yym) yym= yyp;  goto l83;
+  l85:;	  yyp= yyq84;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l86;  ++yyp;  if (yyp > yym) yym= yyp;  goto l83;
+  l86:;	  yyp= yyq84;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l82;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l82;  ++yyp;  if (yyp > yym) yym= yyp;
+  l83:;	  }  yym= yym82;  goto l81;
+  l82:;	  yyp= yyq82;  yym= yym82;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l81;  ++yyp;  if (yyp > yym) yym= yyp;  goto l80;
+  l81:;	  yyp= yyq81;  }
+  { int yyq88= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l89;  ++yyp;  if (yyp > yym) yym= yyp;  goto l87;
+  l89:;	  yyp= yyq88;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l90;  ++yyp;  if (yyp > yym) yym= yyp;  goto l87;
+  l90:;	  yyp= yyq88;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l79;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l79;  ++yyp;  if (yyp > yym) yym= yyp;
+  l87:;	  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l79;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l79:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan44(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  { int yyq92= yyp, yym92= yym;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l92;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym92;  goto l91;
+  l92:;	  yyp= yyq92;  yym= yym92;  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l91:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_RULE(int) YY_UNUSED yyrdigit(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "digit"));  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l93;
+  yyprintf((stderr, "  ok   %s @ %s\n", "digit", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l93:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "digit", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrCLOSE(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yyscan0(yy)) goto l94;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CLOSE", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l94:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CLOSE", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrOPEN(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "OPEN"));  if (!yyscan1(yy)) goto l95;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPEN", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l95:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPEN", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrSLASH(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "SLASH"));  if (!yyscan2(yy)) goto l96;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SLASH", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l96:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SLASH", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrSTAR(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "STAR"));  if (!yyscan3(yy)) goto l97;
+  yyprintf((stderr, "  ok   %s @ %s\n", "STAR", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l97:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "STAR", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrfactor(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 2, 0);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "factor"));
+  {  int yypos99= yy->_pos, yythunkpos99= yy->_thunkpos;  if (!yyrvar(yy)) goto l100;  yyDo(yy, yyThunkSet, -2, 0);  yyDo(yy, yy_1_factor, yy->_begin, yy->_end);  goto l99;
+  l100:;	  yy->_pos= yypos99; yy->_thunkpos= yythunkpos99;  if (!yyrnumber(yy)) goto l101;  yyDo(yy, yyThunkSet, -1, 0);  goto l99;
+  l101:;	  yy->_pos= yypos99; yy->_thunkpos= yythunkpos99;  if (!yyrOPEN(yy)) goto l98;  if (!yyrexpression(yy)) goto l98;  if (!yyrCLOSE(yy)) goto l98;
+  }
+  l99:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "factor", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 2, 0);
+  yyLeave(yy);  return 1;
+  l98:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "factor", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrMINUS(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "MINUS"));  if (!yyscan4(yy)) goto l102;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MINUS", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l102:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MINUS", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrterm(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 2, 0);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "term"));  if (!yyrfactor(yy)) goto l103;  yyDo(yy, yyThunkSet, -2, 0);
+  l104:;	  yyPoll(yy);
+  {  int yypos105= yy->_pos, yythunkpos105= yy->_thunkpos;
+  {  int yypos106= yy->_pos, yythunkpos106= yy->_thunkpos;  if (!yyrSTAR(yy)) goto l107;  if (!yyrfactor(yy)) goto l107;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_1_term, yy->_begin, yy->_end);  goto l106;
+  l107:;	  yy->_pos= yypos106; yy->_thunkpos= yythunkpos106;  if (!yyrSLASH(yy)) goto l105;  if (!yyrfactor(yy)) goto l105;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_2_term, yy->_begin, yy->_end);
+  }
+  l106:;	  goto l104;
+  l105:;	  yy->_pos= yypos105; yy->_thunkpos= yythunkpos105;
+  }  yyDo(yy, yy_3_term, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "term", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 2, 0);
+  yyLeave(yy);  return 1;
+  l103:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "term", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrPLUS(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "PLUS"));  if (!yyscan5(yy)) goto l108;
+  yyprintf((stderr, "  ok   %s @ %s\n", "PLUS", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l108:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "PLUS", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrCOMMA(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "COMMA"));  if (!yyscan6(yy)) goto l109;
+  yyprintf((stderr, "  ok   %s @ %s\n", "COMMA", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l109:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "COMMA", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrstring(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "string"));  if (!yyscan7(yy)) goto l110;  yyDo(yy, yy_1_string, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "string", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l110:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "string", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrEQUAL(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yyscan8(yy)) goto l111;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EQUAL", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l111:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EQUAL", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrvar(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "var"));  if (!yyscan9(yy)) goto l112;  yyDo(yy, yy_1_var, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "var", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l112:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "var", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrvar_list(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 1, 0);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "var_list"));  if (!yyrvar(yy)) goto l113;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_1_var_list, yy->_begin, yy->_end);
+  l114:;	  yyPoll(yy);
+  {  int yypos115= yy->_pos, yythunkpos115= yy->_thunkpos;  if (!yyrCOMMA(yy)) goto l115;  if (!yyrvar(yy)) goto l115;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_2_var_list, yy->_begin, yy->_end);  goto l114;
+  l115:;	  yy->_pos= yypos115; yy->_thunkpos= yythunkpos115;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "var_list", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 1, 0);
+  yyLeave(yy);  return 1;
+  l113:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "var_list", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrrelop(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "relop"));
+  {  int yypos117= yy->_pos, yythunkpos117= yy->_thunkpos;  if (!yyscan10(yy)) goto l118;  yyDo(yy, yy_1_relop, yy->_begin, yy->_end);  goto l117;
+  l118:;	  yy->_pos= yypos117; yy->_thunkpos= yythunkpos117;  if (!yyscan11(yy)) goto l119;  yyDo(yy, yy_2_relop, yy->_begin, yy->_end);  goto l117;
+  l119:;	  yy->_pos= yypos117; yy->_thunkpos= yythunkpos117;  if (!yyscan12(yy)) goto l120;  yyDo(yy, yy_3_relop, yy->_begin, yy->_end);  goto l117;
+  l120:;	  yy->_pos= yypos117; yy->_thunkpos= yythunkpos117;  if (!yyscan13(yy)) goto l121;  yyDo(yy, yy_4_relop, yy->_begin, yy->_end);  goto l117;
+  l121:;	  yy->_pos= yypos117; yy->_thunkpos= yythunkpos117;  if (!yyscan14(yy)) goto l122;  yyDo(yy, yy_5_relop, yy->_begin, yy->_end);  goto l117;
+  l122:;	  yy->_pos= yypos117; yy->_thunkpos= yythunkpos117;  if (!yyscan15(yy)) goto l116;  yyDo(yy, yy_6_relop, yy->_begin, yy->_end);
+  }
+  l117:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "relop", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l116:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "relop", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrexpression(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 2, 0);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "expression"));
+  {  int yypos124= yy->_pos, yythunkpos124= yy->_thunkpos;  yyscan16(yy);  if (!yyrterm(yy)) goto l125;  yyDo(yy, yyThunkSet, -2, 0);  goto l124;
+  l125:;	  yy->_pos= yypos124; yy->_thunkpos= yythunkpos124;  if (!yyrMINUS(yy)) goto l123;  if (!yyrterm(yy)) goto l123;  yyDo(yy, yyThunkSet, -2, 0);  yyDo(yy, yy_1_expression, yy->_begin, yy->_end);
+  }
+  l124:;	
+  l126:;	  yyPoll(yy);
+  {  int yypos127= yy->_pos, yythunkpos127= yy->_thunkpos;
+  {  int yypos128= yy->_pos, yythunkpos128= yy->_thunkpos;  if (!yyrPLUS(yy)) goto l129;  if (!yyrterm(yy)) goto l129;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_2_expression, yy->_begin, yy->_end);  goto l128;
+  l129:;	  yy->_pos= yypos128; yy->_thunkpos= yythunkpos128;  if (!yyrMINUS(yy)) goto l127;  if (!yyrterm(yy)) goto l127;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_3_expression, yy->_begin, yy->_end);
+  }
+  l128:;	  goto l126;
+  l127:;	  yy->_pos= yypos127; yy->_thunkpos= yythunkpos127;
+  }  yyDo(yy, yy_4_expression, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "expression", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 2, 0);
+  yyLeave(yy);  return 1;
+  l123:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "expression", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrexpr_list(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 1, 0);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "expr_list"));
+  {  int yypos131= yy->_pos, yythunkpos131= yy->_thunkpos;
+  {  int yypos133= yy->_pos, yythunkpos133= yy->_thunkpos;  if (!yyrstring(yy)) goto l134;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_1_expr_list, yy->_begin, yy->_end);  goto l133;
+  l134:;	  yy->_pos= yypos133; yy->_thunkpos= yythunkpos133;  if (!yyrexpression(yy)) goto l131;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_2_expr_list, yy->_begin, yy->_end);
+  }
+  l133:;	  goto l132;
+  l131:;	  yy->_pos= yypos131; yy->_thunkpos= yythunkpos131;
+  }
+  l132:;	
+  l135:;	  yyPoll(yy);
+  {  int yypos136= yy->_pos, yythunkpos136= yy->_thunkpos;  if (!yyrCOMMA(yy)) goto l136;
+  {  int yypos137= yy->_pos, yythunkpos137= yy->_thunkpos;  if (!yyrstring(yy)) goto l138;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_3_expr_list, yy->_begin, yy->_end);  goto l137;
+  l138:;	  yy->_pos= yypos137; yy->_thunkpos= yythunkpos137;  if (!yyrexpression(yy)) goto l136;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_4_expr_list, yy->_begin, yy->_end);
+  }
+  l137:;	  goto l135;
+  l136:;	  yy->_pos= yypos136; yy->_thunkpos= yythunkpos136;
+  }
+  {  int yypos139= yy->_pos, yythunkpos139= yy->_thunkpos;  if (!yyrCOMMA(yy)) goto l140;  goto l139;
+  l140:;	  yy->_pos= yypos139; yy->_thunkpos= yythunkpos139;  if (!yyscan17(yy)) goto l130;  yyDo(yy, yy_5_expr_list, yy->_begin, yy->_end);
+  }
+  l139:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "expr_list", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 1, 0);
+  yyLeave(yy);  return 1;
+  l130:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "expr_list", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrnumber(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "number"));  if (!yyscan18(yy)) goto l141;  yyDo(yy, yy_1_number, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "number", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l141:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "number", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrCR(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "CR"));  if (!yyscan19(yy)) goto l142;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CR", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l142:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CR", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrstatement(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 6, 0);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "statement"));
+  {  int yypos144= yy->_pos, yythunkpos144= yy->_thunkpos;  if (!yyscan20(yy)) goto l145;  if (!yyrexpr_list(yy)) goto l145;  goto l144;
+  l145:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan21(yy)) goto l146;  if (!yyrexpression(yy)) goto l146;  yyDo(yy, yyThunkSet, -6, 0);  if (!yyrrelop(yy)) goto l146;  yyDo(yy, yyThunkSet, -5, 0);  if (!yyrexpression(yy)) goto l146;  yyDo(yy, yyThunkSet, -4, 0);  yyDo(yy, yy_1_statement, yy->_begin, yy->_end);  if (!yyscan22(yy)) goto l146;  if (!yyrstatement(yy)) goto l146;  goto l144;
+  l146:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan23(yy)) goto l147;  if (!yyrexpression(yy)) goto l147;  yyDo(yy, yyThunkSet, -3, 0);  yyDo(yy, yy_2_statement, yy->_begin, yy->_end);  goto l144;
+  l147:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan24(yy)) goto l148;  if (!yyrvar_list(yy)) goto l148;  goto l144;
+  l148:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan25(yy)) goto l149;  if (!yyrvar(yy)) goto l149;  yyDo(yy, yyThunkSet, -2, 0);  if (!yyrEQUAL(yy)) goto l149;  if (!yyrexpression(yy)) goto l149;  yyDo(yy, yyThunkSet, -3, 0);  yyDo(yy, yy_3_statement, yy->_begin, yy->_end);  goto l144;
+  l149:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan26(yy)) goto l150;  if (!yyrexpression(yy)) goto l150;  yyDo(yy, yyThunkSet, -3, 0);  yyDo(yy, yy_4_statement, yy->_begin, yy->_end);  goto l144;
+  l150:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan27(yy)) goto l151;  yyDo(yy, yy_5_statement, yy->_begin, yy->_end);  goto l144;
+  l151:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan28(yy)) goto l152;  yyDo(yy, yy_6_statement, yy->_begin, yy->_end);  goto l144;
+  l152:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan29(yy)) goto l153;  yyDo(yy, yy_7_statement, yy->_begin, yy->_end);  goto l144;
+  l153:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan30(yy)) goto l154;  if (!yyrstring(yy)) goto l154;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_8_statement, yy->_begin, yy->_end);  goto l144;
+  l154:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan31(yy)) goto l155;  yyDo(yy, yy_9_statement, yy->_begin, yy->_end);  goto l144;
+  l155:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan32(yy)) goto l156;  yyDo(yy, yy_10_statement, yy->_begin, yy->_end);  goto l144;
+  l156:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan33(yy)) goto l157;  goto l144;
+  l157:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan34(yy)) goto l158;  yyDo(yy, yy_11_statement, yy->_begin, yy->_end);  goto l144;
+  l158:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan35(yy)) goto l159;  if (!yyrstring(yy)) goto l159;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_12_statement, yy->_begin, yy->_end);  goto l144;
+  l159:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan36(yy)) goto l160;  if (!yyrstring(yy)) goto l160;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_13_statement, yy->_begin, yy->_end);  goto l144;
+  l160:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan37(yy)) goto l161;  if (!yyrstring(yy)) goto l161;  yyDo(yy, yyThunkSet, -1, 0);  yyDo(yy, yy_14_statement, yy->_begin, yy->_end);  goto l144;
+  l161:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan38(yy)) goto l162;  yyDo(yy, yy_15_statement, yy->_begin, yy->_end);  goto l144;
+  l162:;	  yy->_pos= yypos144; yy->_thunkpos= yythunkpos144;  if (!yyscan39(yy)) goto l143;  yyDo(yy, yy_16_statement, yy->_begin, yy->_end);
+  }
+  l144:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "statement", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 6, 0);
+  yyLeave(yy);  return 1;
+  l143:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "statement", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyr_(yycontext *yy)
+{
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "_"));  yyscan40(yy);
+  yyprintf((stderr, "  ok   %s @ %s\n", "_", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+}
+YY_RULE(int) yyrline(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 2, 0);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "line"));
+  {  int yypos165= yy->_pos, yythunkpos165= yy->_thunkpos;  if (!yyr_(yy)) goto l166;  if (!yyrstatement(yy)) goto l166;  yyDo(yy, yyThunkSet, -2, 0);  if (!yyrCR(yy)) goto l166;  goto l165;
+  l166:;	  yy->_pos= yypos165; yy->_thunkpos= yythunkpos165;  if (!yyr_(yy)) goto l167;  if (!yyrnumber(yy)) goto l167;  yyDo(yy, yyThunkSet, -1, 0);  if (!yyscan41(yy)) goto l167;  yyDo(yy, yy_1_line, yy->_begin, yy->_end);  goto l165;
+  l167:;	  yy->_pos= yypos165; yy->_thunkpos= yythunkpos165;  if (!yyscan42(yy)) goto l168;  goto l165;
+  l168:;	  yy->_pos= yypos165; yy->_thunkpos= yythunkpos165;  if (!yyscan43(yy)) goto l169;  yyDo(yy, yy_2_line, yy->_begin, yy->_end);  goto l165;
+  l169:;	  yy->_pos= yypos165; yy->_thunkpos= yythunkpos165;  if (!yyscan44(yy)) goto l164;  yyDo(yy, yy_3_line, yy->_begin, yy->_end);
+  }
+  l165:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "line", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 2, 0);
+  yyLeave(yy);  return 1;
+  l164:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "line", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+
+#ifndef YY_PART
+
+typedef int (*yyrule)(yycontext *yy);
+
+YY_LOCAL(void) yyInit(yycontext *yy)
+{
+  yy->_buflen= YY_BUFFER_SIZE;
+  yy->_buf= (char *)YY_MALLOC(yy, yy->_buflen);
+  yy->_textlen= YY_BUFFER_SIZE;
+  yy->_text= (char *)YY_MALLOC(yy, yy->_textlen);
+  yy->_thunkslen= YY_STACK_SIZE;
+  yy->_thunks= (yythunk *)YY_MALLOC(yy, sizeof(yythunk) * yy->_thunkslen);
+#ifdef __cplusplus
+  yy->_vals = new std::vector<YYSTYPE>();
+  yy->_vals->reserve(YY_STACK_SIZE);
+#else
+  yy->_valslen= YY_STACK_SIZE;
+  yy->_vals= (YYSTYPE *)YY_MALLOC(yy, sizeof(YYSTYPE) * yy->_valslen);
+  memset(yy->_vals, 0, sizeof(YYSTYPE) * yy->_valslen);
+#endif
+  yy->_begin= yy->_end= yy->_pos= yy->_limit= yy->_maxpos= yy->_thunkpos= 0;
+}
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok, yystartthunk= 0;
+  size_t yyoffset;
+#ifdef YY_LIMITS
+  int yystartpos;
+#endif
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yyctx->_begin= yyctx->_end= -1;		/* no text yet */
+  yyctx->_thunkpos= yystartthunk;
+  yyctx->_choices= 0;
+  yyctx->_frametop= 0;
+  yyoffset= yyctx->_offset;
+#ifdef YY_STRUCTURAL
+  yyctx->_indexed= 0;
+#endif
+#ifdef YY_LIMITS
+  yyctx->_error= yyctx->_depth= 0;
+  yyctx->_stepcount= 0;
+  yystartpos= yyctx->_pos;
+  if (setjmp(yyctx->_abort))
+    {
+      if (YYLIMIT_CANCEL == yyctx->_error) yyctx->_cancel= 0;
+      yyctx->_pos= (yyctx->_offset != yyoffset) ? 0 : yystartpos;
+      yyctx->_thunkpos= yystartthunk;
+      yyCommit(yyctx);
+      return 0;
+    }
+#endif
+#ifdef __cplusplus
+  yyctx->_vals->resize(1);
+  yyctx->_val = &yyctx->_vals->back();
+#else
+  yyctx->_val= yyctx->_vals;
+#endif
+  yyok= yystart(yyctx);
+  if (yyok) yyDone(yyctx);
+  else if (yyctx->_offset != yyoffset) yyctx->_pos= 0;	/* start of parse already discarded */
+  yyCommit(yyctx);
+  return yyok;
+}
+
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
+{
+  return YYPARSEFROM(YY_CTX_ARG_ yyrline);
+}
+
+#ifdef YY_LAZY
+
+/* Parse the text of a span that was skipped with the rule that it
+ * belongs to.  Spans within it are recorded with their offsets in the
+ * whole input.  Input that the parser has buffered is left alone.
+ */
+YY_PARSE(int) YYPARSESPAN(YY_CTX_PARAM_ const yyspan *yyspan, const char *yytext)
+{
+  char *yybuf;
+  int yybuflen, yypos, yylimit, yymaxpos, yyok;
+  size_t yyoffset;
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yybuf= yyctx->_buf;  yybuflen= yyctx->_buflen;  yypos= yyctx->_pos;  yylimit= yyctx->_limit;
+  yymaxpos= yyctx->_maxpos;  yyoffset= yyctx->_offset;
+  yyctx->_limit= yyspan->end - yyspan->begin;
+  yyctx->_buflen= yyctx->_limit + 1;
+  yyctx->_buf= (char *)YY_MALLOC(yyctx, yyctx->_buflen);
+  memcpy(yyctx->_buf, yytext, yyctx->_limit);
+  yyctx->_pos= yyctx->_maxpos= 0;
+  yyctx->_offset= yyspan->begin;
+  yyctx->_spanning= 1;
+  yyok= YYPARSEFROM(YY_CTX_ARG_ yylazyrules[yyspan->rule]) && !yyctx->_limit;
+  yyctx->_spanning= 0;
+  YY_FREE(yyctx, yyctx->_buf);
+  yyctx->_buf= yybuf;  yyctx->_buflen= yybuflen;  yyctx->_pos= yypos;  yyctx->_limit= yylimit;
+  yyctx->_maxpos= yymaxpos;  yyctx->_offset= yyoffset;
+  return yyok;
+}
+
+#endif
+
+
+#ifdef YY_COROUTINE
+
+/* The parser's stack.  Where anonymous mappings are available it sits
+ * above a page that cannot be touched, so that a parse recursing too
+ * deeply faults, as it would on the thread's own stack, instead of
+ * writing over the heap.
+ */
+#ifdef MAP_ANONYMOUS
+#define yyStackGuard()	((size_t)sysconf(_SC_PAGESIZE))
+#define yyStackSize()	((YY_COROUTINE_STACK_SIZE + yyStackGuard() - 1) / yyStackGuard() * yyStackGuard())
+
+YY_LOCAL(char *) yyStackAlloc(yycontext *yy)
+{
+  char *stack= (char *)mmap(0, yyStackGuard() + yyStackSize(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == stack) return 0;
+  if (mprotect(stack, yyStackGuard(), PROT_NONE))
+    {
+      munmap(stack, yyStackGuard() + yyStackSize());
+      return 0;
+    }
+  return stack;
+}
+
+#define yyStackFree(yy, stack)	munmap((stack), yyStackGuard() + yyStackSize())
+#else
+#define yyStackGuard()		0
+#define yyStackSize()		YY_COROUTINE_STACK_SIZE
+#define yyStackAlloc(yy)	(char *)YY_MALLOC((yy), YY_COROUTINE_STACK_SIZE)
+#define yyStackFree(yy, stack)	YY_FREE((yy), (stack))
+#endif
+
+static void yyCoroutine(unsigned int yyhi, unsigned int yylo)
+{
+  yycontext *yyctx= (yycontext *)((((uintptr_t)yyhi << 16) << 16) | (uintptr_t)yylo);
+  for (;;)
+    {
+      yyctx->_status= YYPARSEFROM(YY_CTX_ARG_ yyrline) ? YYPARSE_ACCEPT : YYPARSE_REJECT;
+      swapcontext(&yyctx->_parser, &yyctx->_caller);
+    }
+}
+
+YY_LOCAL(int) yyResume(yycontext *yy)
+{
+  if (!yy->_stack)
+    {
+      uintptr_t yyarg= (uintptr_t)yy;
+      if (!(yy->_stack= yyStackAlloc(yy)))
+	return YYPARSE_REJECT;
+      getcontext(&yy->_parser);
+      yy->_parser.uc_stack.ss_sp= yy->_stack + yyStackGuard();
+      yy->_parser.uc_stack.ss_size= yyStackSize();
+      yy->_parser.uc_link= 0;
+      makecontext(&yy->_parser, (void (*)(void))yyCoroutine, 2, (unsigned int)((yyarg >> 16) >> 16), (unsigned int)yyarg);
+    }
+#ifdef YY_QUOTA
+  yy->_steps= yy->_quota;
+#endif
+  swapcontext(&yy->_caller, &yy->_parser);
+  return yy->_status;
+}
+
+#endif
+
+#ifdef YY_PUSH
+
+YY_PARSE(int) YYPUSH(YY_CTX_PARAM_ const char *yychunk, int yylen, int yyfinal)
+{
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+#ifdef YY_LIMITS
+  if (yyctx->_maxbuf && yyctx->_limit + yylen >= yyctx->_maxbuf)
+    {
+      yyctx->_error= YYLIMIT_BUFFER;
+      return YYPARSE_REJECT;
+    }
+#endif
+  while (yyctx->_buflen - yyctx->_limit <= yylen)
+    {
+      yyctx->_buflen *= 2;
+#ifdef YY_LIMITS
+      if (yyctx->_maxbuf && yyctx->_buflen > yyctx->_maxbuf)
+	yyctx->_buflen= yyctx->_maxbuf;
+#endif
+      yyctx->_buf= (char *)YY_REALLOC(yyctx, yyctx->_buf, yyctx->_buflen);
+    }
+  memcpy(yyctx->_buf + yyctx->_limit, yychunk, yylen);
+  yyctx->_limit += yylen;
+  yyctx->_final= yyfinal;
+  return yyResume(yyctx);
+}
+
+#endif
+
+#ifdef YY_LIMITS
+
+YY_PARSE(void) YYCANCEL(YY_CTX_PARAM)
+{
+#ifdef __GNUC__
+  __atomic_store_n(&yyctx->_cancel, 1, __ATOMIC_RELAXED);
+#else
+  *(volatile int *)&yyctx->_cancel= 1;
+#endif
+}
+
+#endif
+
+#ifdef YY_QUOTA
+
+YY_PARSE(int) YYPARSEQUOTA(YY_CTX_PARAM_ int yysteps)
+{
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yyctx->_quota= yysteps;
+  return yyResume(yyctx);
+}
+
+#endif
+
+/* Forget the last parse and any input left in the buffer, keeping the
+ * storage that the context has grown, so that the next parse starts
+ * afresh without allocating.
+ */
+YY_PARSE(void) YYRESET(YY_CTX_PARAM)
+{
+  yyctx->_begin= yyctx->_end= yyctx->_pos= yyctx->_limit= yyctx->_maxpos= yyctx->_thunkpos= yyctx->_choices= 0;
+  yyctx->_offset= 0;
+#ifdef YY_PUSH
+  yyctx->_final= 0;
+#endif
+#ifdef YY_LIMITS
+  yyctx->_error= yyctx->_cancel= 0;
+#endif
+#ifdef YY_TOKENS
+  yyctx->_tokencount= yyctx->_token= 0;
+#endif
+#ifdef YY_LAZY
+  yyctx->_spancount= 0;
+#endif
+#ifdef YY_STRUCTURAL
+  yyctx->_indexed= 0;
+#endif
+}
+
+YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)
+{
+  if (yyctx->_buflen)
+    {
+      yyctx->_buflen= 0;
+      YY_FREE(yyctx, yyctx->_buf);
+      YY_FREE(yyctx, yyctx->_text);
+      YY_FREE(yyctx, yyctx->_thunks);
+#ifdef __cplusplus
+      delete yyctx->_vals;
+#else
+      YY_FREE(yyctx, yyctx->_vals);
+#endif
+    }
+  if (yyctx->_frames)
+    {
+      YY_FREE(yyctx, yyctx->_frames);
+      yyctx->_frames= 0;
+      yyctx->_frameslen= 0;
+    }
+#ifdef YY_COROUTINE
+  if (yyctx->_stack)
+    {
+      yyStackFree(yyctx, yyctx->_stack);
+      yyctx->_stack= 0;
+    }
+#endif
+#ifdef YY_STRUCTURAL
+  if (yyctx->_index)
+    {
+      YY_FREE(yyctx, yyctx->_index);
+      yyctx->_index= 0;
+      yyctx->_indexlen= yyctx->_indexed= 0;
+    }
+#endif
+#ifdef YY_LAZY
+  if (yyctx->_spans)
+    {
+      YY_FREE(yyctx, yyctx->_spans);
+      yyctx->_spans= 0;
+      yyctx->_spanslen= yyctx->_spancount= 0;
+    }
+#endif
+#ifdef YY_TOKENS
+  if (yyctx->_tokens)
+    {
+      YY_FREE(yyctx, yyctx->_tokens);
+      yyctx->_tokens= 0;
+      yyctx->_tokenslen= yyctx->_tokencount= yyctx->_token= 0;
+    }
+#endif
+  return yyctx;
+}
+
+
+
+
+
+
+
+#endif
+#line 165 "basic.leg"
+
+
+#include <unistd.h>
+#include <stdarg.h>
+
+char *help=
+  "print <num>|<string> [, <num>|<string> ...] [,]\n"
+  "if <expr> <|<=|<>|=|>=|> <expr> then <stmt>\n"
+  "input <var> [, <var> ...]     let <var> = <expr>\n"
+  "goto <expr>                   gosub <expr>\n"
+  "end                           return\n"
+  "list                          clear\n"
+  "run [\"filename\"]              rem <comment...>\n"
+  "dir                           type \"filename\"\n"
+  "save \"filename\"               load \"filename\"\n"
+  "bye|quit|exit                 help\n"
+  ;
+
+void error(char *fmt, ...)
+{
+  va_list ap;
+  va_start(ap, fmt);
+  if (epc > 0)
+    fprintf(stderr, "\nline %d: %s", lines[epc-1].number, lines[epc-1].text);
+  else
+    fprintf(stderr, "\n");
+  vfprintf(stderr, fmt, ap);
+  fprintf(stderr, "\n");
+  va_end(ap);
+  epc= pc= -1;
+}
+
+#ifdef USE_READLINE
+# include <readline/readline.h>
+# include <readline/history.h>
+#endif
+
+int nextline(char *buf, int max)
+{
+  pc= -1;
+  if (batch) exit(0);
+  if (isatty(fileno(stdin)))
+    {
+#    ifdef USE_READLINE
+      char *line= readline(">");
+      if (line)
+	{
+	  int len= strlen(line);
+	  if (len >= max) len= max - 1;
+	  strncpy(buf, line, len);
+	  (buf)[len]= '\n';
+	  add_history(line);
+	  free(line);
+	  return len + 1;
+	}
+      else
+	{
+	  printf("\n");
+	  return 0;
+	}
+#    endif
+      putchar('>');
+      fflush(stdout);
+    }
+  return fgets(buf, max, stdin) ? strlen(buf) : 0;
+}
+
+int maxLines= 0;
+
+int findLine(int n, int create)
+{
+  int lo= 0, hi= numLines - 1;
+  while (lo <= hi)
+    {
+      int mid= (lo + hi) / 2, lno= lines[mid].number;
+      if (lno > n)
+	hi= mid - 1;
+      else if (lno < n)
+	lo= mid + 1;
+      else
+	return mid;
+    }
+  if (create)
+    {
+      if (numLines == maxLines)
+	{
+	  maxLines *= 2;
+	  lines= realloc(lines, sizeof(line) * maxLines);
+	}
+      if (lo < numLines)
+	memmove(lines + lo + 1, lines + lo, sizeof(line) * (numLines - lo));
+      ++numLines;
+      lines[lo].number= n;
+      lines[lo].text= 0;
+      return lo;
+    }
+  return -1;
+}
+
+void accept(int n, char *s)
+{
+  if (s[0] < 32)	/* delete */
+    {
+      int lno= findLine(n, 0);
+      if (lno >= 0)
+	{
+	  if (lno < numLines - 1)
+	    memmove(lines + lno, lines + lno + 1, sizeof(line) * (numLines - lno - 1));
+	  --numLines;
+	}
+    }
+  else			/* insert */
+    {
+      int lno= findLine(n, 1);
+      if (lines[lno].text) free(lines[lno].text);
+      lines[lno].length= strlen(s);
+      lines[lno].text= strdup(s);
+    }
+}
+
+char *extend(char *name)
+{
+  static char path[1024];
+  int len= strlen(name);
+  sprintf(path, "%s%s", name, (((len > 4) && !strcasecmp(".bas", name + len - 4)) ? "" : ".bas"));
+  return path;
+}
+
+void save(char *name)
+{
+  FILE *f= fopen(name= extend(name), "w");
+  if (!f)
+    perror(name);
+  else
+    {
+      int i;
+      for (i= 0;  i < numLines;  ++i)
+	fprintf(f, "%d %s", lines[i].number, lines[i].text);
+      fclose(f);
+    }
+}
+
+void load(char *name)
+{
+  FILE *f= fopen(name= extend(name), "r");
+  if (!f)
+    perror(name);
+  else
+    {
+      int  lineNumber;
+      char lineText[1024];
+      while ((1 == fscanf(f, " %d ", &lineNumber)) && fgets(lineText, sizeof(lineText), f))
+	accept(lineNumber, lineText);
+      fclose(f);
+    }
+}
+
+void type(char *name)
+{
+  FILE *f= fopen(name= extend(name), "r");
+  if (!f)
+    perror(name);
+  else
+    {
+      int  c, d;
+      while ((c= getc(f)) >= 0)
+	putchar(d= c);
+      fclose(f);
+      if ('\n' != d && '\r' != d) putchar('\n');
+    }
+}
+
+int input(void)
+{
+  char line[32];
+  fgets(line, sizeof(line), stdin);
+  return atoi(line);
+}
+
+int main(int argc, char **argv)
+{
+  lines= malloc(sizeof(line) * (maxLines= 32));
+  numLines= 0;
+
+  if (argc > 1)
+    {
+      batch= 1;
+      while (argc-- > 1)
+	load(*++argv);
+      pc= 0;
+    }
+
+  while (!feof(stdin))
+    yyparse();
+
+  return 0;
+}
+
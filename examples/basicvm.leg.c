@@ -0,0 +1,2829 @@
+/* A recursive-descent parser generated by peg 0.1.18 */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __cplusplus
+  #include <vector>
+#endif
+#define YYRULECOUNT 22
+#line 21 "basic.leg"
+
+# include <stdio.h>
+
+  typedef struct line line;
+
+  struct line
+  {
+    int	  number;
+    int	  length;
+    char *text;
+  };
+
+  line *lines= 0;
+  int   numLines= 0;
+  int   pc= -1, epc= -1;
+  int   batch= 0;
+
+  int nextline(char *buf, int max);
+
+# define min(x, y) ((x) < (y) ? (x) : (y))
+
+# define YY_INPUT(buf, result, max_size)	\
+  {						\
+    if ((pc >= 0) && (pc < numLines))		\
+      {						\
+        line *linep= lines+pc++;		\
+        result= min(max_size, linep->length);	\
+        memcpy(buf, linep->text, result);	\
+      }						\
+    else					\
+      result= nextline(buf, max_size);		\
+  }
+
+  union value {
+    int		  number;
+    char	 *string;
+    int		(*binop)(int lhs, int rhs);
+  };
+
+# define YYSTYPE union value
+
+  int variables[26];
+
+  void accept(int number, char *line);
+
+  void save(char *name);
+  void load(char *name);
+  void type(char *name);
+
+  int lessThan(int lhs, int rhs)	{ return lhs <  rhs; }
+  int lessEqual(int lhs, int rhs)	{ return lhs <= rhs; }
+  int notEqual(int lhs, int rhs)	{ return lhs != rhs; }
+  int equalTo(int lhs, int rhs)		{ return lhs == rhs; }
+  int greaterEqual(int lhs, int rhs)	{ return lhs >= rhs; }
+  int greaterThan(int lhs, int rhs)	{ return lhs >  rhs; }
+
+  int input(void);
+
+  int stack[1024], sp= 0;
+
+  char *help;
+
+  void error(char *fmt, ...);
+  int findLine(int n, int create);
+
+#define YY_FRAMES
+#ifndef YY_MALLOC
+#define YY_MALLOC(C, N)		malloc(N)
+#endif
+#ifndef YY_REALLOC
+#define YY_REALLOC(C, P, N)	realloc(P, N)
+#endif
+#ifndef YY_FREE
+#define YY_FREE(C, P)		free(P)
+#endif
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YY_UNUSED
+# ifdef __GNUC__
+#  define YY_UNUSED	__attribute__((unused))
+# else
+#  define YY_UNUSED
+# endif
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YYRESET
+#define YYRESET		yyreset
+#endif
+#if defined(YY_LAZY) && !defined(YYPARSESPAN)
+#define YYPARSESPAN	yyparsespan
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( yy->_begin= yy->_pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( yy->_end= yy->_pos, 1)
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+#ifndef YY_STACK_SIZE
+#define YY_STACK_SIZE 128
+#endif
+
+#ifndef YY_BUFFER_SIZE
+#define YY_BUFFER_SIZE 1024
+#endif
+
+#if defined(YY_PUSH) || defined(YY_QUOTA)
+#define YY_COROUTINE
+#if defined(__has_include)
+#if !__has_include(<ucontext.h>)
+#error "YY_PUSH needs ucontext, which this platform does not provide"
+#endif
+#elif defined(_WIN32)
+#error "YY_PUSH needs ucontext, which this platform does not provide"
+#endif
+#include <stdint.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#if !defined(YY_COROUTINE_STACK_SIZE) && defined(YY_PUSH_STACK_SIZE)
+#define YY_COROUTINE_STACK_SIZE YY_PUSH_STACK_SIZE
+#endif
+#ifndef YY_COROUTINE_STACK_SIZE
+#define YY_COROUTINE_STACK_SIZE (256 * 1024)
+#endif
+enum { YYPARSE_NEED_MORE= 0, YYPARSE_ACCEPT, YYPARSE_REJECT, YYPARSE_YIELD };
+#define YYPUSH_NEED_MORE	YYPARSE_NEED_MORE	/* the names used before YY_QUOTA */
+#define YYPUSH_ACCEPT		YYPARSE_ACCEPT
+#define YYPUSH_REJECT		YYPARSE_REJECT
+#endif
+#ifdef YY_PUSH
+#ifndef YYPUSH
+#define YYPUSH		yypush
+#endif
+#endif
+#ifdef YY_QUOTA
+#ifndef YYPARSEQUOTA
+#define YYPARSEQUOTA	yyparsequota
+#endif
+#endif
+#ifdef YY_STRUCTURAL
+#include <stdint.h>
+#endif
+#define yyEventEnter(yy, rule)
+#define yyEventLeave(yy, rule)
+#ifdef YY_LIMITS
+#include <setjmp.h>
+#ifndef YYCANCEL
+#define YYCANCEL	yycancel
+#endif
+enum { YYLIMIT_NONE= 0, YYLIMIT_STEPS, YYLIMIT_DEPTH, YYLIMIT_BUFFER, YYLIMIT_THUNKS, YYLIMIT_CANCEL };
+#endif
+
+#ifndef YY_PART
+
+typedef struct _yycontext yycontext;
+typedef struct _yythunk { int begin, end;  unsigned short action; } yythunk;
+#ifdef YY_TOKENS
+typedef struct _yytoken { int kind;  size_t begin, end; } yytoken;
+#endif
+#ifdef YY_LAZY
+typedef struct _yyspan { int rule;  size_t begin, end; } yyspan;
+#endif
+
+enum { yyThunkPush= 0, yyThunkPop, yyThunkSet, yyThunkActions };
+
+struct _yycontext {
+  char     *_buf;
+  int       _buflen;
+  int       _pos;
+  int       _limit;
+  int       _maxpos;
+  char     *_text;
+  int       _textlen;
+  int       _begin;
+  int       _end;
+  int       _textmax;
+  yythunk  *_thunks;
+  int       _thunkslen;
+  int       _thunkpos;
+  int       _choices;
+  size_t    _offset;
+  YYSTYPE   _;
+  YYSTYPE  *_val;
+#ifdef __cplusplus
+  std::vector<YYSTYPE>* _vals;
+#else
+  YYSTYPE  *_vals;
+  int       _valslen;
+#endif
+  int      *_frames;
+  int       _frameslen;
+  int       _frametop;
+#ifdef YY_COROUTINE
+  int       _final;
+  int       _status;
+  char     *_stack;
+  ucontext_t _parser;
+  ucontext_t _caller;
+#endif
+#ifdef YY_QUOTA
+  int       _quota;
+  int       _steps;
+#endif
+#ifdef YY_LIMITS
+  long      _maxsteps;
+  int       _maxdepth;
+  int       _maxbuf;
+  int       _maxthunks;
+  int       _cancel;
+  int       _error;
+  long      _stepcount;
+  int       _depth;
+  jmp_buf   _abort;
+#endif
+#ifdef YY_TOKENS
+  yytoken  *_tokens;
+  int       _tokenslen;
+  int       _tokencount;
+  int       _token;
+#endif
+#ifdef YY_STRUCTURAL
+  uint64_t *_index;
+  int       _indexlen;
+  int       _indexed;
+#endif
+#ifdef YY_LAZY
+  yyspan   *_spans;
+  int       _spanslen;
+  int       _spancount;
+  int       _spanning;
+#endif
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+};
+
+#ifdef YY_CTX_LOCAL
+#define YY_CTX_PARAM_	yycontext *yyctx,
+#define YY_CTX_PARAM	yycontext *yyctx
+#define YY_CTX_ARG_	yyctx,
+#define YY_CTX_ARG	yyctx
+#ifndef YY_INPUT
+#define YY_INPUT(yy, buf, result, max_size)		\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#else
+#define YY_CTX_PARAM_
+#define YY_CTX_PARAM
+#define YY_CTX_ARG_
+#define YY_CTX_ARG
+yycontext yyctx_= { 0, 0 };
+yycontext *yyctx= &yyctx_;
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#endif
+
+#ifdef YY_LIMITS
+#ifdef __GNUC__
+#define yyCancelled(yy)	__atomic_load_n(&yy->_cancel, __ATOMIC_RELAXED)
+#else
+#define yyCancelled(yy)	(*(volatile int *)&yy->_cancel)
+#endif
+YY_LOCAL(void) yyAbort(yycontext *yy, int error)
+{
+  yyprintf((stderr, "limit: abort %d\n", error));
+  yy->_error= error;
+  longjmp(yy->_abort, 1);
+}
+#define yyEnter(yy)	do { if (++yy->_depth > yy->_maxdepth && yy->_maxdepth) yyAbort(yy, YYLIMIT_DEPTH); } while (0)
+#define yyLeave(yy)	--yy->_depth
+#define yyPoll(yy)	do { if (yyCancelled(yy)) yyAbort(yy, YYLIMIT_CANCEL); } while (0)
+#define yyGrow(yy, size, max, error)	do { if ((max) && (size) > (max)) yyAbort(yy, error); } while (0)
+#else
+#define yyEnter(yy)
+#define yyLeave(yy)
+#define yyPoll(yy)
+#define yyGrow(yy, size, max, error)
+#endif
+
+
+
+YY_LOCAL(int) yyrefill(yycontext *yy)
+{
+  int yyn;
+#ifdef YY_LAZY
+  if (yy->_spanning) return 0;
+#endif
+#ifdef YY_PUSH
+  while (yy->_pos >= yy->_limit && !yy->_final)
+    {
+      yyprintf((stderr, "push: need more\n"));
+      yy->_status= YYPARSE_NEED_MORE;
+      swapcontext(&yy->_parser, &yy->_caller);
+    }
+  return yy->_pos < yy->_limit;
+#endif
+  while (yy->_buflen - yy->_pos < 512)
+    {
+      int yylen= yy->_buflen * 2;
+#ifdef YY_LIMITS
+      if (yy->_maxbuf && yylen > yy->_maxbuf)
+	{
+	  if (yy->_buflen >= yy->_maxbuf && yy->_buflen > yy->_pos)
+	    break;					/* read into what room is left */
+	  yyGrow(yy, yy->_pos + 1, yy->_maxbuf, YYLIMIT_BUFFER);
+	  yylen= yy->_maxbuf;
+	}
+#endif
+      yy->_buflen= yylen;
+      yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);
+    }
+#ifdef YY_CTX_LOCAL
+  YY_INPUT(yy, (yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));
+#else
+  YY_INPUT((yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));
+#endif
+  if (!yyn) return 0;
+  yy->_limit += yyn;
+  return 1;
+}
+
+YY_LOCAL(void) yyrecordMaxPos(yycontext *yy)
+{
+  if (yy->_pos > yy->_maxpos) {
+    yy->_maxpos = yy->_pos;
+    yyprintf((stderr, "       maxpos=%d [after '%c']\n", yy->_maxpos, yy->_buf[yy->_maxpos-1]));
+  }
+}
+
+#if defined(YY_QUOTA) || defined(YY_LIMITS)
+YY_LOCAL(void) yyStep(yycontext *yy)
+{
+#ifdef YY_LIMITS
+  if (yy->_maxsteps && ++yy->_stepcount > yy->_maxsteps)
+    yyAbort(yy, YYLIMIT_STEPS);
+#endif
+#ifdef YY_QUOTA
+  if (yy->_quota && --yy->_steps < 0)
+    {
+      yyprintf((stderr, "quota: yield\n"));
+      yy->_status= YYPARSE_YIELD;
+      swapcontext(&yy->_parser, &yy->_caller);
+    }
+#endif
+}
+#else
+#define yyStep(yy)
+#endif
+
+/* Scanners match most terminals in place, so any of these may go unused. */
+YY_LOCAL(int) YY_UNUSED yymatchDot(yycontext *yy)
+{
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  ++yy->_pos;
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchChar(yycontext *yy, int c)
+{
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  if ((unsigned char)yy->_buf[yy->_pos] == c)
+    {
+      ++yy->_pos;
+      yyrecordMaxPos(yy);
+      yyprintf((stderr, "  ok   yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+  return 0;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchString(yycontext *yy, const char *s)
+{
+  int yysav= yy->_pos;
+  yyStep(yy);
+  while (*s)
+    {
+      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+      if (yy->_buf[yy->_pos] != *s)
+	{
+	  yy->_pos= yysav;
+	  return 0;
+	}
+      ++s;
+      ++yy->_pos;
+    }
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchIString(yycontext *yy, const char *s)
+{
+  int yysav= yy->_pos;
+  yyStep(yy);
+  while (*s)
+    {
+      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+      if (tolower(yy->_buf[yy->_pos]) != *s)
+        {
+          yy->_pos= yysav;
+          return 0;
+        }
+      ++s;
+      ++yy->_pos;
+    }
+  yyrecordMaxPos(yy);
+  return 1;
+}
+
+YY_LOCAL(int) YY_UNUSED yymatchClass(yycontext *yy, unsigned char *bits)
+{
+  int c;
+  yyStep(yy);
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
+  c= (unsigned char)yy->_buf[yy->_pos];
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++yy->_pos;
+      yyrecordMaxPos(yy);
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", yy->_buf+yy->_pos));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", yy->_buf+yy->_pos));
+  return 0;
+}
+
+#define yyAvail(yy, p)		((p) < (yy)->_limit || ((yy)->_pos= (p), yyrefill(yy)))
+#define yyByte(yy, p)		((unsigned char)(yy)->_buf[p])
+#define yyInClass(bits, c)	((bits)[(c) >> 3] & (1 << ((c) & 7)))
+
+#ifdef YY_FRAMES
+YY_LOCAL(int *) yyGrowFrames(yycontext *yy, int size)
+{
+  if (!yy->_frameslen)
+    {
+      yy->_frameslen= YY_STACK_SIZE;
+      yy->_frames= (int *)YY_MALLOC(yy, sizeof(int) * yy->_frameslen);
+    }
+  while (yy->_frameslen < size)
+    {
+      yy->_frameslen *= 2;
+      yy->_frames= (int *)YY_REALLOC(yy, yy->_frames, sizeof(int) * yy->_frameslen);
+    }
+  return yy->_frames;
+}
+#endif
+
+YY_LOCAL(void) yyDo(yycontext *yy, int action, int begin, int end)
+{
+  yyGrow(yy, yy->_thunkpos + 1, yy->_maxthunks, YYLIMIT_THUNKS);
+  while (yy->_thunkpos >= yy->_thunkslen)
+    {
+      yy->_thunkslen *= 2;
+#ifdef YY_LIMITS
+      if (yy->_maxthunks && yy->_thunkslen > yy->_maxthunks)
+	yy->_thunkslen= yy->_maxthunks;
+#endif
+      yy->_thunks= (yythunk *)YY_REALLOC(yy, yy->_thunks, sizeof(yythunk) * yy->_thunkslen);
+    }
+  yy->_thunks[yy->_thunkpos].begin=  begin;
+  yy->_thunks[yy->_thunkpos].end=    end;
+  yy->_thunks[yy->_thunkpos].action= action;
+  ++yy->_thunkpos;
+}
+
+YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)
+{
+  int yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (yy->_textlen < (yyleng + 1))
+	{
+	  yy->_textlen *= 2;
+	  yy->_text= (char *)YY_REALLOC(yy, yy->_text, yy->_textlen);
+	}
+      memcpy(yy->_text, yy->_buf + begin, yyleng);
+    }
+  yy->_text[yyleng]= '\0';
+  return yyleng;
+}
+
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng);
+
+#ifdef YY_LAZY
+YY_LOCAL(void) yySpan(yycontext *yy, int rule, int begin, int end)
+{
+  yyspan *span;
+  if (yy->_spancount == yy->_spanslen)
+    {
+      yy->_spanslen= yy->_spanslen ? 2 * yy->_spanslen : YY_STACK_SIZE;
+      yy->_spans= (yyspan *)YY_REALLOC(yy, yy->_spans, sizeof(yyspan) * yy->_spanslen);
+    }
+  span= yy->_spans + yy->_spancount++;
+  span->rule=  rule;
+  span->begin= yy->_offset + begin;
+  span->end=   yy->_offset + end;
+}
+#endif
+
+
+YY_LOCAL(void) yyDone(yycontext *yy)
+{
+  int pos;
+  for (pos= 0;  pos < yy->_thunkpos;  ++pos)
+    {
+      yythunk *thunk= &yy->_thunks[pos];
+      int yyleng;
+#ifdef YY_LAZY
+      if (thunk->action >= YY_LAZY)
+	{
+	  yySpan(yy, thunk->action - YY_LAZY, thunk->begin, thunk->end);
+	  continue;
+	}
+#endif
+      yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %d %s\n", pos, thunk->action, yy->_text));
+      yyDispatch(yy, thunk->action, yy->_text, yyleng);
+    }
+  yy->_thunkpos= 0;
+}
+
+#ifdef YY_TOKENS
+/* Forget the tokens that begin before the buffer, which can no longer
+ * be matched again.
+ */
+YY_LOCAL(void) yyDropTokens(yycontext *yy)
+{
+  int n= 0;
+  while (n < yy->_tokencount && yy->_tokens[n].begin < yy->_offset) ++n;
+  if (n) memmove(yy->_tokens, yy->_tokens + n, sizeof(yytoken) * (yy->_tokencount -= n));
+  yy->_token= 0;
+}
+#endif
+
+YY_LOCAL(void) yyCommit(yycontext *yy)
+{
+  yy->_limit -= yy->_pos;
+  if (yy->_limit)
+    memmove(yy->_buf, yy->_buf + yy->_pos, yy->_limit);
+  yy->_begin -= yy->_pos;
+  yy->_end -= yy->_pos;
+  yy->_offset += yy->_pos;
+  yy->_pos= yy->_thunkpos= 0;
+#ifdef YY_STRUCTURAL
+  yy->_indexed= 0;
+#endif
+#ifdef YY_TOKENS
+  yyDropTokens(yy);
+#endif
+}
+
+#ifdef YY_STREAM
+YY_LOCAL(void) yyStream(yycontext *yy)
+{
+  int keep= yy->_pos;
+  if (yy->_begin >= 0 && yy->_begin < keep) keep= yy->_begin;
+  if (yy->_end   >= 0 && yy->_end   < keep) keep= yy->_end;
+  yyDone(yy);
+  if (keep > 0 && keep >= yy->_limit - keep)
+    {
+      yyprintf((stderr, "stream %d of %d\n", keep, yy->_limit));
+      yy->_limit -= keep;
+      memmove(yy->_buf, yy->_buf + keep, yy->_limit);
+      yy->_pos -= keep;
+      yy->_begin -= keep;
+      yy->_end -= keep;
+      yy->_maxpos= (yy->_maxpos > keep) ? yy->_maxpos - keep : 0;
+      yy->_offset += keep;
+#ifdef YY_STRUCTURAL
+      yy->_indexed= 0;
+#endif
+#ifdef YY_TOKENS
+      yyDropTokens(yy);
+#endif
+    }
+}
+#endif
+
+YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(yy);
+      yyCommit(yy);
+    }
+  return 1;
+}
+
+YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)
+{
+#ifdef __cplusplus
+  yy->_vals->resize(yy->_vals->size() + count);
+  yy->_val = &yy->_vals->back();
+#else
+  yy->_val += count;
+  while (yy->_valslen <= yy->_val - yy->_vals)
+    {
+      long offset= yy->_val - yy->_vals;
+      size_t oldlen = yy->_valslen;
+      yy->_valslen *= 2;
+      yy->_vals= (YYSTYPE *)YY_REALLOC(yy, yy->_vals, sizeof(YYSTYPE) * yy->_valslen);
+      memset(&yy->_vals[oldlen], 0, sizeof(YYSTYPE) * oldlen);
+      yy->_val= yy->_vals + offset;
+    }
+#endif
+}
+YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)
+{
+#ifdef __cplusplus
+  yy->_vals->resize(yy->_vals->size() - count);
+  yy->_val = &yy->_vals->back();
+#else
+  yy->_val -= count;
+#endif
+}
+YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)   { yy->_val[count]= yy->_; }
+
+#ifdef YY_LAZY
+#ifndef YY_LAZY_QUOTE
+#define YY_LAZY_QUOTE(c)	('"' == (c) || '\'' == (c))
+#define YY_LAZY_WORDS		/* the quotes are known, so eight bytes can be tested at once */
+#endif
+#ifndef YY_LAZY_COMMENTS
+#define YY_LAZY_COMMENTS	1
+#endif
+#ifdef YY_LAZY_WORDS
+#define yyLazyHas(w, c)	((((w) ^ 0x0101010101010101ULL * (c)) - 0x0101010101010101ULL) & ~((w) ^ 0x0101010101010101ULL * (c)) & 0x8080808080808080ULL)
+#endif
+/* Move over a balanced region without parsing it, and remember where
+ * it was so that it can be parsed later.  Brackets within quotes or
+ * C comments are not counted.  Unless the program has its own quotes,
+ * text between the bytes that matter is passed over a word at a time.
+ */
+YY_LOCAL(int) yyskipLazy(yycontext *yy, int rule, int open, int close)
+{
+  int pos= yy->_pos, p= pos, depth= 0, c;
+  yyStep(yy);
+  if (!yyAvail(yy, p) || yyByte(yy, p) != open)
+    {
+      yy->_pos= pos;
+      return 0;
+    }
+  for (;;)
+    {
+#ifdef YY_LAZY_WORDS
+      for (;  p + 8 <= yy->_limit;  p += 8)
+	{
+	  unsigned long long w;
+	  memcpy(&w, yy->_buf + p, 8);
+	  if (yyLazyHas(w, open) | yyLazyHas(w, close) | yyLazyHas(w, '"') | yyLazyHas(w, '\'') | yyLazyHas(w, '/'))
+	    break;
+	}
+#endif
+      while (p < yy->_limit && (c= yyByte(yy, p)) != open && c != close && !YY_LAZY_QUOTE(c) && '/' != c)
+	++p;
+      if (!yyAvail(yy, p))
+	{
+	  yy->_pos= pos;
+	  return 0;
+	}
+      c= yyByte(yy, p++);
+      if (c == open)
+	++depth;
+      else if (c == close)
+	{
+	  if (!--depth) break;
+	}
+      else if (YY_LAZY_QUOTE(c))
+	{
+	  int d;
+	  while (yyAvail(yy, p) && (d= yyByte(yy, p++)) != c)
+	    if ('\\' == d && yyAvail(yy, p)) ++p;
+	}
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '/' == yyByte(yy, p))
+	{
+	  while (yyAvail(yy, p) && '\n' != yyByte(yy, p)) ++p;
+	}
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '*' == yyByte(yy, p))
+	{
+	  for (++p;  yyAvail(yy, p) && !('*' == yyByte(yy, p) && yyAvail(yy, p + 1) && '/' == yyByte(yy, p + 1));  ++p);
+	  if (yyAvail(yy, p)) p += 2;
+	}
+    }
+  yy->_pos= p;
+  yyrecordMaxPos(yy);
+  yyDo(yy, YY_LAZY + rule, pos, p);
+  return 1;
+}
+#endif
+
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)
+
+YY_RULE(int) yyrdigit(yycontext *yy); /* 22 */
+YY_RULE(int) yyrCLOSE(yycontext *yy); /* 21 */
+YY_RULE(int) yyrOPEN(yycontext *yy); /* 20 */
+YY_RULE(int) yyrSLASH(yycontext *yy); /* 19 */
+YY_RULE(int) yyrSTAR(yycontext *yy); /* 18 */
+YY_RULE(int) yyrfactor(yycontext *yy); /* 17 */
+YY_RULE(int) yyrMINUS(yycontext *yy); /* 16 */
+YY_RULE(int) yyrterm(yycontext *yy); /* 15 */
+YY_RULE(int) yyrPLUS(yycontext *yy); /* 14 */
+YY_RULE(int) yyrCOMMA(yycontext *yy); /* 13 */
+YY_RULE(int) yyrstring(yycontext *yy); /* 12 */
+YY_RULE(int) yyrEQUAL(yycontext *yy); /* 11 */
+YY_RULE(int) yyrvar(yycontext *yy); /* 10 */
+YY_RULE(int) yyrvar_list(yycontext *yy); /* 9 */
+YY_RULE(int) yyrrelop(yycontext *yy); /* 8 */
+YY_RULE(int) yyrexpression(yycontext *yy); /* 7 */
+YY_RULE(int) yyrexpr_list(yycontext *yy); /* 6 */
+YY_RULE(int) yyrnumber(yycontext *yy); /* 5 */
+YY_RULE(int) yyrCR(yycontext *yy); /* 4 */
+YY_RULE(int) yyrstatement(yycontext *yy); /* 3 */
+YY_RULE(int) yyr_(yycontext *yy); /* 2 */
+YY_RULE(int) yyrline(yycontext *yy); /* 1 */
+
+enum {
+  yy_6_relop= yyThunkActions + 42,
+  yy_5_relop= yyThunkActions + 41,
+  yy_4_relop= yyThunkActions + 40,
+  yy_3_relop= yyThunkActions + 39,
+  yy_2_relop= yyThunkActions + 38,
+  yy_1_relop= yyThunkActions + 37,
+  yy_1_string= yyThunkActions + 36,
+  yy_1_number= yyThunkActions + 35,
+  yy_1_var= yyThunkActions + 34,
+  yy_1_factor= yyThunkActions + 33,
+  yy_3_term= yyThunkActions + 32,
+  yy_2_term= yyThunkActions + 31,
+  yy_1_term= yyThunkActions + 30,
+  yy_4_expression= yyThunkActions + 29,
+  yy_3_expression= yyThunkActions + 28,
+  yy_2_expression= yyThunkActions + 27,
+  yy_1_expression= yyThunkActions + 26,
+  yy_2_var_list= yyThunkActions + 25,
+  yy_1_var_list= yyThunkActions + 24,
+  yy_5_expr_list= yyThunkActions + 23,
+  yy_4_expr_list= yyThunkActions + 22,
+  yy_3_expr_list= yyThunkActions + 21,
+  yy_2_expr_list= yyThunkActions + 20,
+  yy_1_expr_list= yyThunkActions + 19,
+  yy_16_statement= yyThunkActions + 18,
+  yy_15_statement= yyThunkActions + 17,
+  yy_14_statement= yyThunkActions + 16,
+  yy_13_statement= yyThunkActions + 15,
+  yy_12_statement= yyThunkActions + 14,
+  yy_11_statement= yyThunkActions + 13,
+  yy_10_statement= yyThunkActions + 12,
+  yy_9_statement= yyThunkActions + 11,
+  yy_8_statement= yyThunkActions + 10,
+  yy_7_statement= yyThunkActions + 9,
+  yy_6_statement= yyThunkActions + 8,
+  yy_5_statement= yyThunkActions + 7,
+  yy_4_statement= yyThunkActions + 6,
+  yy_3_statement= yyThunkActions + 5,
+  yy_2_statement= yyThunkActions + 4,
+  yy_1_statement= yyThunkActions + 3,
+  yy_3_line= yyThunkActions + 2,
+  yy_2_line= yyThunkActions + 1,
+  yy_1_line= yyThunkActions + 0,
+};
+
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng)
+{
+  switch (yyaction)
+    {
+    case yyThunkPush:	yyPush(yy, yytext, yyleng);	break;
+    case yyThunkPop:	yyPop(yy, yytext, yyleng);	break;
+    case yyThunkSet:	yySet(yy, yytext, yyleng);	break;
+    case yy_6_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_6_relop\n"));
+  {
+#line 155
+   y_.binop= equalTo; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_5_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_5_relop\n"));
+  {
+#line 154
+   y_.binop= greaterThan; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_4_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_relop\n"));
+  {
+#line 153
+   y_.binop= greaterEqual; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_3_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_relop\n"));
+  {
+#line 152
+   y_.binop= lessThan; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_2_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_relop\n"));
+  {
+#line 151
+   y_.binop= notEqual; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_relop:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_relop\n"));
+  {
+#line 150
+   y_.binop= lessEqual; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_string:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_string\n"));
+  {
+#line 148
+   y_.string = yytext; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_number:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_number\n"));
+  {
+#line 144
+   y_.number = atoi(yytext); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_var:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_var\n"));
+  {
+#line 142
+   y_.number = yytext[0] - 'a' ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_1_factor:
+      {
+#define n yy->_val[-1]
+#define v yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_factor\n"));
+  {
+#line 138
+   y_.number = variables[v.number] ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef n
+#undef v
+      }
+      break;
+    case yy_3_term:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_term\n"));
+  {
+#line 136
+   y_.number = l.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_term:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_term\n"));
+  {
+#line 135
+   l.number /= r.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_1_term:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_term\n"));
+  {
+#line 134
+   l.number *= r.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_4_expression:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_expression\n"));
+  {
+#line 132
+   y_.number = l.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_3_expression:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_expression\n"));
+  {
+#line 131
+   l.number -= r.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_expression:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_expression\n"));
+  {
+#line 130
+   l.number += r.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_1_expression:
+      {
+#define r yy->_val[-1]
+#define l yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_expression\n"));
+  {
+#line 129
+   l.number = -l.number ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_var_list:
+      {
+#define v yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_var_list\n"));
+  {
+#line 125
+   variables[v.number]= input(); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef v
+      }
+      break;
+    case yy_1_var_list:
+      {
+#define v yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_var_list\n"));
+  {
+#line 124
+   variables[v.number]= input(); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef v
+      }
+      break;
+    case yy_5_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_5_expr_list\n"));
+  {
+#line 121
+   printf("\n"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_4_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_expr_list\n"));
+  {
+#line 118
+   printf("%d", e.number); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_3_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_expr_list\n"));
+  {
+#line 117
+   printf("%s", e.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_2_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_expr_list\n"));
+  {
+#line 116
+   printf("%d", e.number); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_1_expr_list:
+      {
+#define e yy->_val[-1]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_expr_list\n"));
+  {
+#line 115
+   printf("%s", e.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_16_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_16_statement\n"));
+  {
+#line 113
+   fprintf(stderr, "%s", help); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_15_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_15_statement\n"));
+  {
+#line 112
+   system("ls *.bas"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_14_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_14_statement\n"));
+  {
+#line 111
+   type(s.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_13_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_13_statement\n"));
+  {
+#line 110
+   load(s.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_12_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_12_statement\n"));
+  {
+#line 109
+   save(s.string); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_11_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_11_statement\n"));
+  {
+#line 108
+   exit(0); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_10_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_10_statement\n"));
+  {
+#line 106
+   pc= -1;  if (batch) exit(0); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_9_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_9_statement\n"));
+  {
+#line 105
+   pc= 0; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_8_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_8_statement\n"));
+  {
+#line 104
+   load(s.string);  pc= 0; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_7_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_7_statement\n"));
+  {
+#line 103
+   int i;  for (i= 0;  i < numLines;  ++i) printf("%5d %s", lines[i].number, lines[i].text); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_6_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_6_statement\n"));
+  {
+#line 102
+   while (numLines) accept(lines->number, "\n"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_5_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_5_statement\n"));
+  {
+#line 101
+   epc= pc;  if ((pc= sp ? stack[--sp] : -1) < 0) error("no gosub"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_4_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_statement\n"));
+  {
+#line 99
+   epc= pc;  if (sp < 1024) stack[sp++]= pc, pc= findLine(e.number, 0); else error("too many gosubs");
+							  if (pc < 0) error("no such line"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_3_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_statement\n"));
+  {
+#line 98
+   variables[v.number]= e.number; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_2_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_statement\n"));
+  {
+#line 96
+   epc= pc;  if ((pc= findLine(e.number, 0)) < 0) error("no such line"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_1_statement:
+      {
+#define s yy->_val[-1]
+#define v yy->_val[-2]
+#define e yy->_val[-3]
+#define e2 yy->_val[-4]
+#define r yy->_val[-5]
+#define e1 yy->_val[-6]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_statement\n"));
+  {
+#line 94
+   if (!r.binop(e1.number, e2.number)) yythunkpos= 0; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef v
+#undef e
+#undef e2
+#undef r
+#undef e1
+      }
+      break;
+    case yy_3_line:
+      {
+#define n yy->_val[-1]
+#define s yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_line\n"));
+  {
+#line 91
+   exit(0); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef n
+#undef s
+      }
+      break;
+    case yy_2_line:
+      {
+#define n yy->_val[-1]
+#define s yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_line\n"));
+  {
+#line 90
+   epc= pc;  error("syntax error"); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef n
+#undef s
+      }
+      break;
+    case yy_1_line:
+      {
+#define n yy->_val[-1]
+#define s yy->_val[-2]
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_line\n"));
+  {
+#line 88
+   accept(n.number, yytext); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef n
+#undef s
+      }
+      break;
+    }
+}
+enum {
+  yyOpChar= 0, yyOpString, yyOpIString, yyOpClass, yyOpSpan, yyOpAny,
+  yyOpChoice, yyOpNotChoice, yyOpCommit, yyOpBackCommit, yyOpFail, yyOpFailTwice,
+  yyOpCut, yyOpCall, yyOpReturn, yyOpJump, yyOpBegin, yyOpEnd,
+  yyOpPush, yyOpPop, yyOpAssign, yyOpAction, yyOpEager, yyOpPredicate, yyOpCode, yyOpStream
+};
+
+static const int yybytecode[]= {
+  /* digit */
+  /* 0 */ yyOpClass, 0,
+  /* 2 */ yyOpReturn,
+  /* CLOSE */
+  /* 3 */ yyOpChar, 41,
+  /* 5 */ yyOpCall, 615,
+  /* 7 */ yyOpReturn,
+  /* OPEN */
+  /* 8 */ yyOpChar, 40,
+  /* 10 */ yyOpCall, 615,
+  /* 12 */ yyOpReturn,
+  /* SLASH */
+  /* 13 */ yyOpChar, 47,
+  /* 15 */ yyOpCall, 615,
+  /* 17 */ yyOpReturn,
+  /* STAR */
+  /* 18 */ yyOpChar, 42,
+  /* 20 */ yyOpCall, 615,
+  /* 22 */ yyOpReturn,
+  /* factor */
+  /* 23 */ yyOpPush, 2,
+  /* 25 */ yyOpChoice, 35,
+  /* 27 */ yyOpCall, 120,
+  /* 29 */ yyOpAssign, -2,
+  /* 31 */ yyOpAction, yy_1_factor,
+  /* 33 */ yyOpCommit, 49,
+  /* 35 */ yyOpChoice, 43,
+  /* 37 */ yyOpCall, 322,
+  /* 39 */ yyOpAssign, -1,
+  /* 41 */ yyOpCommit, 49,
+  /* 43 */ yyOpCall, 8,
+  /* 45 */ yyOpCall, 209,
+  /* 47 */ yyOpCall, 3,
+  /* 49 */ yyOpPop, 2,
+  /* 51 */ yyOpReturn,
+  /* MINUS */
+  /* 52 */ yyOpChar, 45,
+  /* 54 */ yyOpCall, 615,
+  /* 56 */ yyOpReturn,
+  /* term */
+  /* 57 */ yyOpPush, 2,
+  /* 59 */ yyOpCall, 23,
+  /* 61 */ yyOpAssign, -2,
+  /* 63 */ yyOpChoice, 87,
+  /* 65 */ yyOpChoice, 77,
+  /* 67 */ yyOpCall, 18,
+  /* 69 */ yyOpCall, 23,
+  /* 71 */ yyOpAssign, -1,
+  /* 73 */ yyOpAction, yy_1_term,
+  /* 75 */ yyOpCommit, 85,
+  /* 77 */ yyOpCall, 13,
+  /* 79 */ yyOpCall, 23,
+  /* 81 */ yyOpAssign, -1,
+  /* 83 */ yyOpAction, yy_2_term,
+  /* 85 */ yyOpCommit, 63,
+  /* 87 */ yyOpAction, yy_3_term,
+  /* 89 */ yyOpPop, 2,
+  /* 91 */ yyOpReturn,
+  /* PLUS */
+  /* 92 */ yyOpChar, 43,
+  /* 94 */ yyOpCall, 615,
+  /* 96 */ yyOpReturn,
+  /* COMMA */
+  /* 97 */ yyOpChar, 44,
+  /* 99 */ yyOpCall, 615,
+  /* 101 */ yyOpReturn,
+  /* string */
+  /* 102 */ yyOpChar, 34,
+  /* 104 */ yyOpBegin,
+  /* 105 */ yyOpSpan, 1,
+  /* 107 */ yyOpEnd,
+  /* 108 */ yyOpChar, 34,
+  /* 110 */ yyOpCall, 615,
+  /* 112 */ yyOpAction, yy_1_string,
+  /* 114 */ yyOpReturn,
+  /* EQUAL */
+  /* 115 */ yyOpChar, 61,
+  /* 117 */ yyOpCall, 615,
+  /* 119 */ yyOpReturn,
+  /* var */
+  /* 120 */ yyOpBegin,
+  /* 121 */ yyOpClass, 2,
+  /* 123 */ yyOpEnd,
+  /* 124 */ yyOpCall, 615,
+  /* 126 */ yyOpAction, yy_1_var,
+  /* 128 */ yyOpReturn,
+  /* var_list */
+  /* 129 */ yyOpPush, 1,
+  /* 131 */ yyOpCall, 120,
+  /* 133 */ yyOpAssign, -1,
+  /* 135 */ yyOpAction, yy_1_var_list,
+  /* 137 */ yyOpChoice, 149,
+  /* 139 */ yyOpCall, 97,
+  /* 141 */ yyOpCall, 120,
+  /* 143 */ yyOpAssign, -1,
+  /* 145 */ yyOpAction, yy_2_var_list,
+  /* 147 */ yyOpCommit, 137,
+  /* 149 */ yyOpPop, 1,
+  /* 151 */ yyOpReturn,
+  /* relop */
+  /* 152 */ yyOpChoice, 162,
+  /* 154 */ yyOpString, 0,
+  /* 156 */ yyOpCall, 615,
+  /* 158 */ yyOpAction, yy_1_relop,
+  /* 160 */ yyOpCommit, 208,
+  /* 162 */ yyOpChoice, 172,
+  /* 164 */ yyOpString, 1,
+  /* 166 */ yyOpCall, 615,
+  /* 168 */ yyOpAction, yy_2_relop,
+  /* 170 */ yyOpCommit, 208,
+  /* 172 */ yyOpChoice, 182,
+  /* 174 */ yyOpChar, 60,
+  /* 176 */ yyOpCall, 615,
+  /* 178 */ yyOpAction, yy_3_relop,
+  /* 180 */ yyOpCommit, 208,
+  /* 182 */ yyOpChoice, 192,
+  /* 184 */ yyOpString, 2,
+  /* 186 */ yyOpCall, 615,
+  /* 188 */ yyOpAction, yy_4_relop,
+  /* 190 */ yyOpCommit, 208,
+  /* 192 */ yyOpChoice, 202,
+  /* 194 */ yyOpChar, 62,
+  /* 196 */ yyOpCall, 615,
+  /* 198 */ yyOpAction, yy_5_relop,
+  /* 200 */ yyOpCommit, 208,
+  /* 202 */ yyOpChar, 61,
+  /* 204 */ yyOpCall, 615,
+  /* 206 */ yyOpAction, yy_6_relop,
+  /* 208 */ yyOpReturn,
+  /* expression */
+  /* 209 */ yyOpPush, 2,
+  /* 211 */ yyOpChoice, 225,
+  /* 213 */ yyOpChoice, 219,
+  /* 215 */ yyOpCall, 92,
+  /* 217 */ yyOpCommit, 219,
+  /* 219 */ yyOpCall, 57,
+  /* 221 */ yyOpAssign, -2,
+  /* 223 */ yyOpCommit, 233,
+  /* 225 */ yyOpCall, 52,
+  /* 227 */ yyOpCall, 57,
+  /* 229 */ yyOpAssign, -2,
+  /* 231 */ yyOpAction, yy_1_expression,
+  /* 233 */ yyOpChoice, 257,
+  /* 235 */ yyOpChoice, 247,
+  /* 237 */ yyOpCall, 92,
+  /* 239 */ yyOpCall, 57,
+  /* 241 */ yyOpAssign, -1,
+  /* 243 */ yyOpAction, yy_2_expression,
+  /* 245 */ yyOpCommit, 255,
+  /* 247 */ yyOpCall, 52,
+  /* 249 */ yyOpCall, 57,
+  /* 251 */ yyOpAssign, -1,
+  /* 253 */ yyOpAction, yy_3_expression,
+  /* 255 */ yyOpCommit, 233,
+  /* 257 */ yyOpAction, yy_4_expression,
+  /* 259 */ yyOpPop, 2,
+  /* 261 */ yyOpReturn,
+  /* expr_list */
+  /* 262 */ yyOpPush, 1,
+  /* 264 */ yyOpChoice, 284,
+  /* 266 */ yyOpChoice, 276,
+  /* 268 */ yyOpCall, 102,
+  /* 270 */ yyOpAssign, -1,
+  /* 272 */ yyOpAction, yy_1_expr_list,
+  /* 274 */ yyOpCommit, 282,
+  /* 276 */ yyOpCall, 209,
+  /* 278 */ yyOpAssign, -1,
+  /* 280 */ yyOpAction, yy_2_expr_list,
+  /* 282 */ yyOpCommit, 284,
+  /* 284 */ yyOpChoice, 306,
+  /* 286 */ yyOpCall, 97,
+  /* 288 */ yyOpChoice, 298,
+  /* 290 */ yyOpCall, 102,
+  /* 292 */ yyOpAssign, -1,
+  /* 294 */ yyOpAction, yy_3_expr_list,
+  /* 296 */ yyOpCommit, 304,
+  /* 298 */ yyOpCall, 209,
+  /* 300 */ yyOpAssign, -1,
+  /* 302 */ yyOpAction, yy_4_expr_list,
+  /* 304 */ yyOpCommit, 284,
+  /* 306 */ yyOpChoice, 312,
+  /* 308 */ yyOpCall, 97,
+  /* 310 */ yyOpCommit, 319,
+  /* 312 */ yyOpNotChoice, 317,
+  /* 314 */ yyOpCall, 97,
+  /* 316 */ yyOpFailTwice,
+  /* 317 */ yyOpAction, yy_5_expr_list,
+  /* 319 */ yyOpPop, 1,
+  /* 321 */ yyOpReturn,
+  /* number */
+  /* 322 */ yyOpBegin,
+  /* 323 */ yyOpCall, 0,
+  /* 325 */ yyOpChoice, 331,
+  /* 327 */ yyOpCall, 0,
+  /* 329 */ yyOpCommit, 325,
+  /* 331 */ yyOpEnd,
+  /* 332 */ yyOpCall, 615,
+  /* 334 */ yyOpAction, yy_1_number,
+  /* 336 */ yyOpReturn,
+  /* CR */
+  /* 337 */ yyOpChoice, 343,
+  /* 339 */ yyOpChar, 10,
+  /* 341 */ yyOpCommit, 351,
+  /* 343 */ yyOpChoice, 349,
+  /* 345 */ yyOpChar, 13,
+  /* 347 */ yyOpCommit, 351,
+  /* 349 */ yyOpString, 3,
+  /* 351 */ yyOpReturn,
+  /* statement */
+  /* 352 */ yyOpPush, 6,
+  /* 354 */ yyOpChoice, 364,
+  /* 356 */ yyOpString, 4,
+  /* 358 */ yyOpCall, 615,
+  /* 360 */ yyOpCall, 262,
+  /* 362 */ yyOpCommit, 612,
+  /* 364 */ yyOpChoice, 392,
+  /* 366 */ yyOpString, 5,
+  /* 368 */ yyOpCall, 615,
+  /* 370 */ yyOpCall, 209,
+  /* 372 */ yyOpAssign, -6,
+  /* 374 */ yyOpCall, 152,
+  /* 376 */ yyOpAssign, -5,
+  /* 378 */ yyOpCall, 209,
+  /* 380 */ yyOpAssign, -4,
+  /* 382 */ yyOpAction, yy_1_statement,
+  /* 384 */ yyOpString, 6,
+  /* 386 */ yyOpCall, 615,
+  /* 388 */ yyOpCall, 352,
+  /* 390 */ yyOpCommit, 612,
+  /* 392 */ yyOpChoice, 406,
+  /* 394 */ yyOpString, 7,
+  /* 396 */ yyOpCall, 615,
+  /* 398 */ yyOpCall, 209,
+  /* 400 */ yyOpAssign, -3,
+  /* 402 */ yyOpAction, yy_2_statement,
+  /* 404 */ yyOpCommit, 612,
+  /* 406 */ yyOpChoice, 416,
+  /* 408 */ yyOpString, 8,
+  /* 410 */ yyOpCall, 615,
+  /* 412 */ yyOpCall, 129,
+  /* 414 */ yyOpCommit, 612,
+  /* 416 */ yyOpChoice, 436,
+  /* 418 */ yyOpString, 9,
+  /* 420 */ yyOpCall, 615,
+  /* 422 */ yyOpCall, 120,
+  /* 424 */ yyOpAssign, -2,
+  /* 426 */ yyOpCall, 115,
+  /* 428 */ yyOpCall, 209,
+  /* 430 */ yyOpAssign, -3,
+  /* 432 */ yyOpAction, yy_3_statement,
+  /* 434 */ yyOpCommit, 612,
+  /* 436 */ yyOpChoice, 450,
+  /* 438 */ yyOpString, 10,
+  /* 440 */ yyOpCall, 615,
+  /* 442 */ yyOpCall, 209,
+  /* 444 */ yyOpAssign, -3,
+  /* 446 */ yyOpAction, yy_4_statement,
+  /* 448 */ yyOpCommit, 612,
+  /* 450 */ yyOpChoice, 460,
+  /* 452 */ yyOpString, 11,
+  /* 454 */ yyOpCall, 615,
+  /* 456 */ yyOpAction, yy_5_statement,
+  /* 458 */ yyOpCommit, 612,
+  /* 460 */ yyOpChoice, 470,
+  /* 462 */ yyOpString, 12,
+  /* 464 */ yyOpCall, 615,
+  /* 466 */ yyOpAction, yy_6_statement,
+  /* 468 */ yyOpCommit, 612,
+  /* 470 */ yyOpChoice, 480,
+  /* 472 */ yyOpString, 13,
+  /* 474 */ yyOpCall, 615,
+  /* 476 */ yyOpAction, yy_7_statement,
+  /* 478 */ yyOpCommit, 612,
+  /* 480 */ yyOpChoice, 494,
+  /* 482 */ yyOpString, 14,
+  /* 484 */ yyOpCall, 615,
+  /* 486 */ yyOpCall, 102,
+  /* 488 */ yyOpAssign, -1,
+  /* 490 */ yyOpAction, yy_8_statement,
+  /* 492 */ yyOpCommit, 612,
+  /* 494 */ yyOpChoice, 504,
+  /* 496 */ yyOpString, 14,
+  /* 498 */ yyOpCall, 615,
+  /* 500 */ yyOpAction, yy_9_statement,
+  /* 502 */ yyOpCommit, 612,
+  /* 504 */ yyOpChoice, 514,
+  /* 506 */ yyOpString, 15,
+  /* 508 */ yyOpCall, 615,
+  /* 510 */ yyOpAction, yy_10_statement,
+  /* 512 */ yyOpCommit, 612,
+  /* 514 */ yyOpChoice, 532,
+  /* 516 */ yyOpString, 16,
+  /* 518 */ yyOpCall, 615,
+  /* 520 */ yyOpChoice, 530,
+  /* 522 */ yyOpNotChoice, 527,
+  /* 524 */ yyOpCall, 337,
+  /* 526 */ yyOpFailTwice,
+  /* 527 */ yyOpAny,
+  /* 528 */ yyOpCommit, 520,
+  /* 530 */ yyOpCommit, 612,
+  /* 532 */ yyOpChoice, 554,
+  /* 534 */ yyOpChoice, 540,
+  /* 536 */ yyOpString, 17,
+  /* 538 */ yyOpCommit, 548,
+  /* 540 */ yyOpChoice, 546,
+  /* 542 */ yyOpString, 18,
+  /* 544 */ yyOpCommit, 548,
+  /* 546 */ yyOpString, 19,
+  /* 548 */ yyOpCall, 615,
+  /* 550 */ yyOpAction, yy_11_statement,
+  /* 552 */ yyOpCommit, 612,
+  /* 554 */ yyOpChoice, 568,
+  /* 556 */ yyOpString, 20,
+  /* 558 */ yyOpCall, 615,
+  /* 560 */ yyOpCall, 102,
+  /* 562 */ yyOpAssign, -1,
+  /* 564 */ yyOpAction, yy_12_statement,
+  /* 566 */ yyOpCommit, 612,
+  /* 568 */ yyOpChoice, 582,
+  /* 570 */ yyOpString, 21,
+  /* 572 */ yyOpCall, 615,
+  /* 574 */ yyOpCall, 102,
+  /* 576 */ yyOpAssign, -1,
+  /* 578 */ yyOpAction, yy_13_statement,
+  /* 580 */ yyOpCommit, 612,
+  /* 582 */ yyOpChoice, 596,
+  /* 584 */ yyOpString, 22,
+  /* 586 */ yyOpCall, 615,
+  /* 588 */ yyOpCall, 102,
+  /* 590 */ yyOpAssign, -1,
+  /* 592 */ yyOpAction, yy_14_statement,
+  /* 594 */ yyOpCommit, 612,
+  /* 596 */ yyOpChoice, 606,
+  /* 598 */ yyOpString, 23,
+  /* 600 */ yyOpCall, 615,
+  /* 602 */ yyOpAction, yy_15_statement,
+  /* 604 */ yyOpCommit, 612,
+  /* 606 */ yyOpString, 24,
+  /* 608 */ yyOpCall, 615,
+  /* 610 */ yyOpAction, yy_16_statement,
+  /* 612 */ yyOpPop, 6,
+  /* 614 */ yyOpReturn,
+  /* _ */
+  /* 615 */ yyOpSpan, 3,
+  /* 617 */ yyOpReturn,
+  /* line */
+  /* 618 */ yyOpPush, 2,
+  /* 620 */ yyOpChoice, 632,
+  /* 622 */ yyOpCall, 615,
+  /* 624 */ yyOpCall, 352,
+  /* 626 */ yyOpAssign, -2,
+  /* 628 */ yyOpCall, 337,
+  /* 630 */ yyOpCommit, 696,
+  /* 632 */ yyOpChoice, 658,
+  /* 634 */ yyOpCall, 615,
+  /* 636 */ yyOpCall, 322,
+  /* 638 */ yyOpAssign, -1,
+  /* 640 */ yyOpBegin,
+  /* 641 */ yyOpChoice, 651,
+  /* 643 */ yyOpNotChoice, 648,
+  /* 645 */ yyOpCall, 337,
+  /* 647 */ yyOpFailTwice,
+  /* 648 */ yyOpAny,
+  /* 649 */ yyOpCommit, 641,
+  /* 651 */ yyOpCall, 337,
+  /* 653 */ yyOpEnd,
+  /* 654 */ yyOpAction, yy_1_line,
+  /* 656 */ yyOpCommit, 696,
+  /* 658 */ yyOpChoice, 666,
+  /* 660 */ yyOpCall, 615,
+  /* 662 */ yyOpCall, 337,
+  /* 664 */ yyOpCommit, 696,
+  /* 666 */ yyOpChoice, 688,
+  /* 668 */ yyOpCall, 615,
+  /* 670 */ yyOpBegin,
+  /* 671 */ yyOpChoice, 681,
+  /* 673 */ yyOpNotChoice, 678,
+  /* 675 */ yyOpCall, 337,
+  /* 677 */ yyOpFailTwice,
+  /* 678 */ yyOpAny,
+  /* 679 */ yyOpCommit, 671,
+  /* 681 */ yyOpCall, 337,
+  /* 683 */ yyOpEnd,
+  /* 684 */ yyOpAction, yy_2_line,
+  /* 686 */ yyOpCommit, 696,
+  /* 688 */ yyOpCall, 615,
+  /* 690 */ yyOpNotChoice, 694,
+  /* 692 */ yyOpAny,
+  /* 693 */ yyOpFailTwice,
+  /* 694 */ yyOpAction, yy_3_line,
+  /* 696 */ yyOpPop, 2,
+  /* 698 */ yyOpReturn,
+};
+
+static const char *yystrings[]= {
+  "<=",
+  "<>",
+  ">=",
+  "\r\n",
+  "print",
+  "if",
+  "then",
+  "goto",
+  "input",
+  "let",
+  "gosub",
+  "return",
+  "clear",
+  "list",
+  "run",
+  "end",
+  "rem",
+  "bye",
+  "quit",
+  "exit",
+  "save",
+  "load",
+  "type",
+  "dir",
+  "help",
+  0
+};
+
+static const char *yyclasses[]= {
+  "\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\377\377\377\377\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377",
+  "\000\000\000\000\000\000\000\000\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  "\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+  0
+};
+
+YY_LOCAL(int) yyCode(yycontext *yy, int yyn, int yythunkpos0)
+{
+  yyText(yy, yy->_begin, yy->_end);
+#define yytext yy->_text
+#define yyleng yy->_textlen
+  switch (yyn)
+    {
+    }
+#undef yytext
+#undef yyleng
+  return 1;
+}
+
+#ifdef __GNUC__
+# define yyCASE(OP)	yyL##OP:
+# define yyNEXT		goto *yyops[yybytecode[yypc]]
+#else
+# define yyCASE(OP)	case OP:
+# define yyNEXT		goto yynext
+#endif
+
+#define yyPUSH(PC, POS, TP, MP)					\
+  if (yysp + 4 > yy->_frameslen) yys= yyGrowFrames(yy, yysp + 4);	\
+  yys[yysp]= (PC);  yys[yysp + 1]= (POS);  yys[yysp + 2]= (TP);  yys[yysp + 3]= (MP);  yysp += 4
+
+/* Run the parsing machine from the rule at yypc.  The stack holds
+ * four ints per entry: a choice point is {pc, pos, thunkpos, maxpos or
+ * -1} and a call is {-2 - return pc, pos, thunkpos, caller's call}.
+ * The outermost call has -1 in place of its return pc.
+ */
+YY_LOCAL(int) yyVM(yycontext *yy, int yypc)
+{
+  int *yys= yyGrowFrames(yy, 4), yysp= 4, yyfp= 0, yychoices= 0;
+#ifdef __GNUC__
+  static void *const yyops[]= {
+    &&yyLyyOpChar, &&yyLyyOpString, &&yyLyyOpIString, &&yyLyyOpClass, &&yyLyyOpSpan, &&yyLyyOpAny,
+    &&yyLyyOpChoice, &&yyLyyOpNotChoice, &&yyLyyOpCommit, &&yyLyyOpBackCommit, &&yyLyyOpFail, &&yyLyyOpFailTwice,
+    &&yyLyyOpCut, &&yyLyyOpCall, &&yyLyyOpReturn, &&yyLyyOpJump, &&yyLyyOpBegin, &&yyLyyOpEnd,
+    &&yyLyyOpPush, &&yyLyyOpPop, &&yyLyyOpAssign, &&yyLyyOpAction, &&yyLyyOpEager, &&yyLyyOpPredicate, &&yyLyyOpCode,
+    &&yyLyyOpStream,
+  };
+#endif
+  yys[0]= -1;  yys[1]= yy->_pos;  yys[2]= yy->_thunkpos;  yys[3]= -1;
+  yyEnter(yy);
+#ifdef __GNUC__
+  yyNEXT;
+#else
+ yynext:
+  switch (yybytecode[yypc])
+    {
+#endif
+    yyCASE(yyOpChar)	if (!yymatchChar(yy, yybytecode[yypc + 1])) goto yyfail;  yypc += 2;  yyNEXT;
+    yyCASE(yyOpString)	if (!yymatchString(yy, yystrings[yybytecode[yypc + 1]])) goto yyfail;  yypc += 2;  yyNEXT;
+    yyCASE(yyOpIString)	if (!yymatchIString(yy, yystrings[yybytecode[yypc + 1]])) goto yyfail;  yypc += 2;  yyNEXT;
+    yyCASE(yyOpClass)	if (!yymatchClass(yy, (unsigned char *)yyclasses[yybytecode[yypc + 1]])) goto yyfail;  yypc += 2;  yyNEXT;
+    yyCASE(yyOpSpan)	while (yymatchClass(yy, (unsigned char *)yyclasses[yybytecode[yypc + 1]])) yyPoll(yy);  yypc += 2;  yyNEXT;
+    yyCASE(yyOpAny)	if (!yymatchDot(yy)) goto yyfail;  yypc += 1;  yyNEXT;
+    yyCASE(yyOpChoice)	yyPUSH(yybytecode[yypc + 1], yy->_pos, yy->_thunkpos, -1);  ++yychoices;  yypc += 2;  yyNEXT;
+    yyCASE(yyOpNotChoice)	yyPUSH(yybytecode[yypc + 1], yy->_pos, yy->_thunkpos, yy->_maxpos);  ++yychoices;  yypc += 2;  yyNEXT;
+    yyCASE(yyOpCommit)	yysp -= 4;  --yychoices;  yypc= yybytecode[yypc + 1];  yyPoll(yy);  yyNEXT;
+    yyCASE(yyOpBackCommit)
+      yysp -= 4;
+      --yychoices;
+      yy->_pos= yys[yysp + 1];
+      yy->_thunkpos= yys[yysp + 2];
+      yypc= yybytecode[yypc + 1];
+      yyNEXT;
+    yyCASE(yyOpFail)	goto yyfail;
+    yyCASE(yyOpFailTwice)
+      yysp -= 4;
+      --yychoices;
+      yy->_maxpos= yys[yysp + 3];
+      goto yyfail;
+    yyCASE(yyOpCut)	yysp -= 4;  --yychoices;  yypc += 1;  yyNEXT;
+    yyCASE(yyOpCall)
+      yyprintf((stderr, "call %d @ %s\n", yybytecode[yypc + 1], yy->_buf+yy->_pos));
+      yyPUSH(-2 - (yypc + 2), yy->_pos, yy->_thunkpos, yyfp);
+      yyfp= yysp - 4;
+      yyEnter(yy);
+      yypc= yybytecode[yypc + 1];
+      yyNEXT;
+    yyCASE(yyOpReturn)
+      yysp -= 4;
+      yyLeave(yy);
+      if (yys[yysp] == -1) return 1;
+      yypc= -2 - yys[yysp];
+      yyfp= yys[yysp + 3];
+      yyNEXT;
+    yyCASE(yyOpJump)	yypc= yybytecode[yypc + 1];  yyNEXT;
+    yyCASE(yyOpBegin)	yy->_begin= yy->_pos;  yypc += 1;  yyNEXT;
+    yyCASE(yyOpEnd)	yy->_end= yy->_pos;  yypc += 1;  yyNEXT;
+    yyCASE(yyOpPush)	yyDo(yy, yyThunkPush, yybytecode[yypc + 1], 0);  yypc += 2;  yyNEXT;
+    yyCASE(yyOpPop)	yyDo(yy, yyThunkPop, yybytecode[yypc + 1], 0);  yypc += 2;  yyNEXT;
+    yyCASE(yyOpAssign)	yyDo(yy, yyThunkSet, yybytecode[yypc + 1], 0);  yypc += 2;  yyNEXT;
+    yyCASE(yyOpAction)	yyDo(yy, yybytecode[yypc + 1], yy->_begin, yy->_end);  yypc += 2;  yyNEXT;
+    yyCASE(yyOpEager)	yyDo(yy, yybytecode[yypc + 1], yy->_begin, yy->_end);  yyDone(yy);  yypc += 2;  yyNEXT;
+    yyCASE(yyOpPredicate)	if (!yyCode(yy, yybytecode[yypc + 1], yys[yyfp + 2])) goto yyfail;  yypc += 2;  yyNEXT;
+    yyCASE(yyOpCode)	yyCode(yy, yybytecode[yypc + 1], yys[yyfp + 2]);  yypc += 2;  yyNEXT;
+#ifdef YY_STREAM
+    yyCASE(yyOpStream)	if (!yychoices) yyStream(yy);  yypc += 1;  yyNEXT;
+#else
+    yyCASE(yyOpStream)	yypc += 1;  yyNEXT;
+#endif
+#ifndef __GNUC__
+    }
+#endif
+ yyfail:
+  yyprintf((stderr, "  fail @ %s\n", yy->_buf+yy->_pos));
+  for (;;)
+    {
+      yysp -= 4;
+      if (yys[yysp] >= 0)
+	break;
+      yyLeave(yy);
+      yy->_pos= yys[yysp + 1];
+      yy->_thunkpos= yys[yysp + 2];
+      if (yys[yysp] == -1)
+	return 0;
+      yyfp= yys[yysp + 3];
+    }
+  --yychoices;
+  yypc= yys[yysp];
+  yy->_pos= yys[yysp + 1];
+  yy->_thunkpos= yys[yysp + 2];
+  if (yys[yysp + 3] >= 0)
+    yy->_maxpos= yys[yysp + 3];
+  yyNEXT;
+}
+
+#undef yyPUSH
+#undef yyNEXT
+#undef yyCASE
+
+YY_RULE(int) yyrdigit(yycontext *yy) { return yyVM(yy, 0); }
+YY_RULE(int) yyrCLOSE(yycontext *yy) { return yyVM(yy, 3); }
+YY_RULE(int) yyrOPEN(yycontext *yy) { return yyVM(yy, 8); }
+YY_RULE(int) yyrSLASH(yycontext *yy) { return yyVM(yy, 13); }
+YY_RULE(int) yyrSTAR(yycontext *yy) { return yyVM(yy, 18); }
+YY_RULE(int) yyrfactor(yycontext *yy) { return yyVM(yy, 23); }
+YY_RULE(int) yyrMINUS(yycontext *yy) { return yyVM(yy, 52); }
+YY_RULE(int) yyrterm(yycontext *yy) { return yyVM(yy, 57); }
+YY_RULE(int) yyrPLUS(yycontext *yy) { return yyVM(yy, 92); }
+YY_RULE(int) yyrCOMMA(yycontext *yy) { return yyVM(yy, 97); }
+YY_RULE(int) yyrstring(yycontext *yy) { return yyVM(yy, 102); }
+YY_RULE(int) yyrEQUAL(yycontext *yy) { return yyVM(yy, 115); }
+YY_RULE(int) yyrvar(yycontext *yy) { return yyVM(yy, 120); }
+YY_RULE(int) yyrvar_list(yycontext *yy) { return yyVM(yy, 129); }
+YY_RULE(int) yyrrelop(yycontext *yy) { return yyVM(yy, 152); }
+YY_RULE(int) yyrexpression(yycontext *yy) { return yyVM(yy, 209); }
+YY_RULE(int) yyrexpr_list(yycontext *yy) { return yyVM(yy, 262); }
+YY_RULE(int) yyrnumber(yycontext *yy) { return yyVM(yy, 322); }
+YY_RULE(int) yyrCR(yycontext *yy) { return yyVM(yy, 337); }
+YY_RULE(int) yyrstatement(yycontext *yy) { return yyVM(yy, 352); }
+YY_RULE(int) yyr_(yycontext *yy) { return yyVM(yy, 615); }
+YY_RULE(int) yyrline(yycontext *yy) { return yyVM(yy, 618); }
+
+
+#ifndef YY_PART
+
+typedef int (*yyrule)(yycontext *yy);
+
+YY_LOCAL(void) yyInit(yycontext *yy)
+{
+  yy->_buflen= YY_BUFFER_SIZE;
+  yy->_buf= (char *)YY_MALLOC(yy, yy->_buflen);
+  yy->_textlen= YY_BUFFER_SIZE;
+  yy->_text= (char *)YY_MALLOC(yy, yy->_textlen);
+  yy->_thunkslen= YY_STACK_SIZE;
+  yy->_thunks= (yythunk *)YY_MALLOC(yy, sizeof(yythunk) * yy->_thunkslen);
+#ifdef __cplusplus
+  yy->_vals = new std::vector<YYSTYPE>();
+  yy->_vals->reserve(YY_STACK_SIZE);
+#else
+  yy->_valslen= YY_STACK_SIZE;
+  yy->_vals= (YYSTYPE *)YY_MALLOC(yy, sizeof(YYSTYPE) * yy->_valslen);
+  memset(yy->_vals, 0, sizeof(YYSTYPE) * yy->_valslen);
+#endif
+  yy->_begin= yy->_end= yy->_pos= yy->_limit= yy->_maxpos= yy->_thunkpos= 0;
+}
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok, yystartthunk= 0;
+  size_t yyoffset;
+#ifdef YY_LIMITS
+  int yystartpos;
+#endif
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yyctx->_begin= yyctx->_end= -1;		/* no text yet */
+  yyctx->_thunkpos= yystartthunk;
+  yyctx->_choices= 0;
+  yyctx->_frametop= 0;
+  yyoffset= yyctx->_offset;
+#ifdef YY_STRUCTURAL
+  yyctx->_indexed= 0;
+#endif
+#ifdef YY_LIMITS
+  yyctx->_error= yyctx->_depth= 0;
+  yyctx->_stepcount= 0;
+  yystartpos= yyctx->_pos;
+  if (setjmp(yyctx->_abort))
+    {
+      if (YYLIMIT_CANCEL == yyctx->_error) yyctx->_cancel= 0;
+      yyctx->_pos= (yyctx->_offset != yyoffset) ? 0 : yystartpos;
+      yyctx->_thunkpos= yystartthunk;
+      yyCommit(yyctx);
+      return 0;
+    }
+#endif
+#ifdef __cplusplus
+  yyctx->_vals->resize(1);
+  yyctx->_val = &yyctx->_vals->back();
+#else
+  yyctx->_val= yyctx->_vals;
+#endif
+  yyok= yystart(yyctx);
+  if (yyok) yyDone(yyctx);
+  else if (yyctx->_offset != yyoffset) yyctx->_pos= 0;	/* start of parse already discarded */
+  yyCommit(yyctx);
+  return yyok;
+}
+
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
+{
+  return YYPARSEFROM(YY_CTX_ARG_ yyrline);
+}
+
+#ifdef YY_LAZY
+
+/* Parse the text of a span that was skipped with the rule that it
+ * belongs to.  Spans within it are recorded with their offsets in the
+ * whole input.  Input that the parser has buffered is left alone.
+ */
+YY_PARSE(int) YYPARSESPAN(YY_CTX_PARAM_ const yyspan *yyspan, const char *yytext)
+{
+  char *yybuf;
+  int yybuflen, yypos, yylimit, yymaxpos, yyok;
+  size_t yyoffset;
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yybuf= yyctx->_buf;  yybuflen= yyctx->_buflen;  yypos= yyctx->_pos;  yylimit= yyctx->_limit;
+  yymaxpos= yyctx->_maxpos;  yyoffset= yyctx->_offset;
+  yyctx->_limit= yyspan->end - yyspan->begin;
+  yyctx->_buflen= yyctx->_limit + 1;
+  yyctx->_buf= (char *)YY_MALLOC(yyctx, yyctx->_buflen);
+  memcpy(yyctx->_buf, yytext, yyctx->_limit);
+  yyctx->_pos= yyctx->_maxpos= 0;
+  yyctx->_offset= yyspan->begin;
+  yyctx->_spanning= 1;
+  yyok= YYPARSEFROM(YY_CTX_ARG_ yylazyrules[yyspan->rule]) && !yyctx->_limit;
+  yyctx->_spanning= 0;
+  YY_FREE(yyctx, yyctx->_buf);
+  yyctx->_buf= yybuf;  yyctx->_buflen= yybuflen;  yyctx->_pos= yypos;  yyctx->_limit= yylimit;
+  yyctx->_maxpos= yymaxpos;  yyctx->_offset= yyoffset;
+  return yyok;
+}
+
+#endif
+
+
+#ifdef YY_COROUTINE
+
+/* The parser's stack.  Where anonymous mappings are available it sits
+ * above a page that cannot be touched, so that a parse recursing too
+ * deeply faults, as it would on the thread's own stack, instead of
+ * writing over the heap.
+ */
+#ifdef MAP_ANONYMOUS
+#define yyStackGuard()	((size_t)sysconf(_SC_PAGESIZE))
+#define yyStackSize()	((YY_COROUTINE_STACK_SIZE + yyStackGuard() - 1) / yyStackGuard() * yyStackGuard())
+
+YY_LOCAL(char *) yyStackAlloc(yycontext *yy)
+{
+  char *stack= (char *)mmap(0, yyStackGuard() + yyStackSize(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == stack) return 0;
+  if (mprotect(stack, yyStackGuard(), PROT_NONE))
+    {
+      munmap(stack, yyStackGuard() + yyStackSize());
+      return 0;
+    }
+  return stack;
+}
+
+#define yyStackFree(yy, stack)	munmap((stack), yyStackGuard() + yyStackSize())
+#else
+#define yyStackGuard()		0
+#define yyStackSize()		YY_COROUTINE_STACK_SIZE
+#define yyStackAlloc(yy)	(char *)YY_MALLOC((yy), YY_COROUTINE_STACK_SIZE)
+#define yyStackFree(yy, stack)	YY_FREE((yy), (stack))
+#endif
+
+static void yyCoroutine(unsigned int yyhi, unsigned int yylo)
+{
+  yycontext *yyctx= (yycontext *)((((uintptr_t)yyhi << 16) << 16) | (uintptr_t)yylo);
+  for (;;)
+    {
+      yyctx->_status= YYPARSEFROM(YY_CTX_ARG_ yyrline) ? YYPARSE_ACCEPT : YYPARSE_REJECT;
+      swapcontext(&yyctx->_parser, &yyctx->_caller);
+    }
+}
+
+YY_LOCAL(int) yyResume(yycontext *yy)
+{
+  if (!yy->_stack)
+    {
+      uintptr_t yyarg= (uintptr_t)yy;
+      if (!(yy->_stack= yyStackAlloc(yy)))
+	return YYPARSE_REJECT;
+      getcontext(&yy->_parser);
+      yy->_parser.uc_stack.ss_sp= yy->_stack + yyStackGuard();
+      yy->_parser.uc_stack.ss_size= yyStackSize();
+      yy->_parser.uc_link= 0;
+      makecontext(&yy->_parser, (void (*)(void))yyCoroutine, 2, (unsigned int)((yyarg >> 16) >> 16), (unsigned int)yyarg);
+    }
+#ifdef YY_QUOTA
+  yy->_steps= yy->_quota;
+#endif
+  swapcontext(&yy->_caller, &yy->_parser);
+  return yy->_status;
+}
+
+#endif
+
+#ifdef YY_PUSH
+
+YY_PARSE(int) YYPUSH(YY_CTX_PARAM_ const char *yychunk, int yylen, int yyfinal)
+{
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+#ifdef YY_LIMITS
+  if (yyctx->_maxbuf && yyctx->_limit + yylen >= yyctx->_maxbuf)
+    {
+      yyctx->_error= YYLIMIT_BUFFER;
+      return YYPARSE_REJECT;
+    }
+#endif
+  while (yyctx->_buflen - yyctx->_limit <= yylen)
+    {
+      yyctx->_buflen *= 2;
+#ifdef YY_LIMITS
+      if (yyctx->_maxbuf && yyctx->_buflen > yyctx->_maxbuf)
+	yyctx->_buflen= yyctx->_maxbuf;
+#endif
+      yyctx->_buf= (char *)YY_REALLOC(yyctx, yyctx->_buf, yyctx->_buflen);
+    }
+  memcpy(yyctx->_buf + yyctx->_limit, yychunk, yylen);
+  yyctx->_limit += yylen;
+  yyctx->_final= yyfinal;
+  return yyResume(yyctx);
+}
+
+#endif
+
+#ifdef YY_LIMITS
+
+YY_PARSE(void) YYCANCEL(YY_CTX_PARAM)
+{
+#ifdef __GNUC__
+  __atomic_store_n(&yyctx->_cancel, 1, __ATOMIC_RELAXED);
+#else
+  *(volatile int *)&yyctx->_cancel= 1;
+#endif
+}
+
+#endif
+
+#ifdef YY_QUOTA
+
+YY_PARSE(int) YYPARSEQUOTA(YY_CTX_PARAM_ int yysteps)
+{
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yyctx->_quota= yysteps;
+  return yyResume(yyctx);
+}
+
+#endif
+
+/* Forget the last parse and any input left in the buffer, keeping the
+ * storage that the context has grown, so that the next parse starts
+ * afresh without allocating.
+ */
+YY_PARSE(void) YYRESET(YY_CTX_PARAM)
+{
+  yyctx->_begin= yyctx->_end= yyctx->_pos= yyctx->_limit= yyctx->_maxpos= yyctx->_thunkpos= yyctx->_choices= 0;
+  yyctx->_offset= 0;
+#ifdef YY_PUSH
+  yyctx->_final= 0;
+#endif
+#ifdef YY_LIMITS
+  yyctx->_error= yyctx->_cancel= 0;
+#endif
+#ifdef YY_TOKENS
+  yyctx->_tokencount= yyctx->_token= 0;
+#endif
+#ifdef YY_LAZY
+  yyctx->_spancount= 0;
+#endif
+#ifdef YY_STRUCTURAL
+  yyctx->_indexed= 0;
+#endif
+}
+
+YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)
+{
+  if (yyctx->_buflen)
+    {
+      yyctx->_buflen= 0;
+      YY_FREE(yyctx, yyctx->_buf);
+      YY_FREE(yyctx, yyctx->_text);
+      YY_FREE(yyctx, yyctx->_thunks);
+#ifdef __cplusplus
+      delete yyctx->_vals;
+#else
+      YY_FREE(yyctx, yyctx->_vals);
+#endif
+    }
+  if (yyctx->_frames)
+    {
+      YY_FREE(yyctx, yyctx->_frames);
+      yyctx->_frames= 0;
+      yyctx->_frameslen= 0;
+    }
+#ifdef YY_COROUTINE
+  if (yyctx->_stack)
+    {
+      yyStackFree(yyctx, yyctx->_stack);
+      yyctx->_stack= 0;
+    }
+#endif
+#ifdef YY_STRUCTURAL
+  if (yyctx->_index)
+    {
+      YY_FREE(yyctx, yyctx->_index);
+      yyctx->_index= 0;
+      yyctx->_indexlen= yyctx->_indexed= 0;
+    }
+#endif
+#ifdef YY_LAZY
+  if (yyctx->_spans)
+    {
+      YY_FREE(yyctx, yyctx->_spans);
+      yyctx->_spans= 0;
+      yyctx->_spanslen= yyctx->_spancount= 0;
+    }
+#endif
+#ifdef YY_TOKENS
+  if (yyctx->_tokens)
+    {
+      YY_FREE(yyctx, yyctx->_tokens);
+      yyctx->_tokens= 0;
+      yyctx->_tokenslen= yyctx->_tokencount= yyctx->_token= 0;
+    }
+#endif
+  return yyctx;
+}
+
+
+
+
+
+
+
+#endif
+#line 165 "basic.leg"
+
+
+#include <unistd.h>
+#include <stdarg.h>
+
+char *help=
+  "print <num>|<string> [, <num>|<string> ...] [,]\n"
+  "if <expr> <|<=|<>|=|>=|> <expr> then <stmt>\n"
+  "input <var> [, <var> ...]     let <var> = <expr>\n"
+  "goto <expr>                   gosub <expr>\n"
+  "end                           return\n"
+  "list                          clear\n"
+  "run [\"filename\"]              rem <comment...>\n"
+  "dir                           type \"filename\"\n"
+  "save \"filename\"               load \"filename\"\n"
+  "bye|quit|exit                 help\n"
+  ;
+
+void error(char *fmt, ...)
+{
+  va_list ap;
+  va_start(ap, fmt);
+  if (epc > 0)
+    fprintf(stderr, "\nline %d: %s", lines[epc-1].number, lines[epc-1].text);
+  else
+    fprintf(stderr, "\n");
+  vfprintf(stderr, fmt, ap);
+  fprintf(stderr, "\n");
+  va_end(ap);
+  epc= pc= -1;
+}
+
+#ifdef USE_READLINE
+# include <readline/readline.h>
+# include <readline/history.h>
+#endif
+
+int nextline(char *buf, int max)
+{
+  pc= -1;
+  if (batch) exit(0);
+  if (isatty(fileno(stdin)))
+    {
+#    ifdef USE_READLINE
+      char *line= readline(">");
+      if (line)
+	{
+	  int len= strlen(line);
+	  if (len >= max) len= max - 1;
+	  strncpy(buf, line, len);
+	  (buf)[len]= '\n';
+	  add_history(line);
+	  free(line);
+	  return len + 1;
+	}
+      else
+	{
+	  printf("\n");
+	  return 0;
+	}
+#    endif
+      putchar('>');
+      fflush(stdout);
+    }
+  return fgets(buf, max, stdin) ? strlen(buf) : 0;
+}
+
+int maxLines= 0;
+
+int findLine(int n, int create)
+{
+  int lo= 0, hi= numLines - 1;
+  while (lo <= hi)
+    {
+      int mid= (lo + hi) / 2, lno= lines[mid].number;
+      if (lno > n)
+	hi= mid - 1;
+      else if (lno < n)
+	lo= mid + 1;
+      else
+	return mid;
+    }
+  if (create)
+    {
+      if (numLines == maxLines)
+	{
+	  maxLines *= 2;
+	  lines= realloc(lines, sizeof(line) * maxLines);
+	}
+      if (lo < numLines)
+	memmove(lines + lo + 1, lines + lo, sizeof(line) * (numLines - lo));
+      ++numLines;
+      lines[lo].number= n;
+      lines[lo].text= 0;
+      return lo;
+    }
+  return -1;
+}
+
+void accept(int n, char *s)
+{
+  if (s[0] < 32)	/* delete */
+    {
+      int lno= findLine(n, 0);
+      if (lno >= 0)
+	{
+	  if (lno < numLines - 1)
+	    memmove(lines + lno, lines + lno + 1, sizeof(line) * (numLines - lno - 1));
+	  --numLines;
+	}
+    }
+  else			/* insert */
+    {
+      int lno= findLine(n, 1);
+      if (lines[lno].text) free(lines[lno].text);
+      lines[lno].length= strlen(s);
+      lines[lno].text= strdup(s);
+    }
+}
+
+char *extend(char *name)
+{
+  static char path[1024];
+  int len= strlen(name);
+  sprintf(path, "%s%s", name, (((len > 4) && !strcasecmp(".bas", name + len - 4)) ? "" : ".bas"));
+  return path;
+}
+
+void save(char *name)
+{
+  FILE *f= fopen(name= extend(name), "w");
+  if (!f)
+    perror(name);
+  else
+    {
+      int i;
+      for (i= 0;  i < numLines;  ++i)
+	fprintf(f, "%d %s", lines[i].number, lines[i].text);
+      fclose(f);
+    }
+}
+
+void load(char *name)
+{
+  FILE *f= fopen(name= extend(name), "r");
+  if (!f)
+    perror(name);
+  else
+    {
+      int  lineNumber;
+      char lineText[1024];
+      while ((1 == fscanf(f, " %d ", &lineNumber)) && fgets(lineText, sizeof(lineText), f))
+	accept(lineNumber, lineText);
+      fclose(f);
+    }
+}
+
+void type(char *name)
+{
+  FILE *f= fopen(name= extend(name), "r");
+  if (!f)
+    perror(name);
+  else
+    {
+      int  c, d;
+      while ((c= getc(f)) >= 0)
+	putchar(d= c);
+      fclose(f);
+      if ('\n' != d && '\r' != d) putchar('\n');
+    }
+}
+
+int input(void)
+{
+  char line[32];
+  fgets(line, sizeof(line), stdin);
+  return atoi(line);
+}
+
+int main(int argc, char **argv)
+{
+  lines= malloc(sizeof(line) * (maxLines= 32));
+  numLines= 0;
+
+  if (argc > 1)
+    {
+      batch= 1;
+      while (argc-- > 1)
+	load(*++argv);
+      pc= 0;
+    }
+
+  while (!feof(stdin))
+    yyparse();
+
+  return 0;
+}
+
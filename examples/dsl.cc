@@ -0,0 +1,66 @@
+/* The desk calculator of calc.leg, written with the expression templates
+ * of peg.hh instead of being generated by leg.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "peg.hh"
+
+static int vars[26];
+static int stack[1024], sp= 0;
+
+static void push(int n)	{ stack[sp++]= n; }
+static int  pop(void)	{ return stack[--sp]; }
+
+static int input(char *buf, int size)
+{
+  return fread(buf, 1, size, stdin);
+}
+
+typedef yystream<int (*)(char *, int)> Input;
+
+int main()
+{
+  using namespace peg;
+
+  rule<Input> Stmt, Expr, Sum, Product, Value;
+
+  cls	_(" \t");
+  auto	blank=	*_;
+  auto	EOL=	'\n' | str("\r\n") | '\r' | ';';
+  auto	NUMBER=	capture(+cls("0-9")) >> blank;
+  auto	ID=	capture(cls("a-z")) >> blank;
+  auto	ASSIGN=	'=' >> blank;
+  auto	PLUS=	'+' >> blank;
+  auto	MINUS=	'-' >> blank;
+  auto	TIMES=	'*' >> blank;
+  auto	DIVIDE=	'/' >> blank;
+  auto	OPEN=	'(' >> blank;
+  auto	CLOSE=	')' >> blank;
+
+  Stmt=		(blank >> Expr >> EOL)		[([](const char *, int) { printf("%d\n", pop()); })]
+	|	(*(!EOL >> dot) >> EOL)		[([](const char *, int) { printf("error\n"); })];
+
+  Expr=		ID				[([](const char *yytext, int) { push(yytext[0] - 'a'); })]
+		  >> (ASSIGN >> Sum)		[([](const char *, int) { int s= pop();  vars[pop()]= s;  push(s); })]
+	|	Sum;
+
+  Sum=		Product >> *( (PLUS  >> Product)	[([](const char *, int) { int r= pop();  push(pop() + r); })]
+			    | (MINUS >> Product)	[([](const char *, int) { int r= pop();  push(pop() - r); })]
+			    );
+
+  Product=	Value >> *( (TIMES  >> Value)	[([](const char *, int) { int r= pop();  push(pop() * r); })]
+			  | (DIVIDE >> Value)	[([](const char *, int) { int r= pop();  push(pop() / r); })]
+			  );
+
+  Value=	NUMBER				[([](const char *yytext, int) { push(atoi(yytext)); })]
+	|	(ID >> !ASSIGN)			[([](const char *yytext, int) { push(vars[yytext[0] - 'a']); })]
+	|	OPEN >> Expr >> CLOSE;
+
+  parser<Input> calc(input);
+  while (calc.parse(Stmt))
+    ;
+
+  return 0;
+}
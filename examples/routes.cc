@@ -0,0 +1,38 @@
+/* Check a routing table at compile time, and tables read from stdin at
+ * run time, with the recognizer generated by leg -R from routes.leg.
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "routes.leg.h"
+
+static constexpr const char *routes= "\
+GET    /                  => index\n\
+GET    /users             => list_users\n\
+POST   /users             => create_user\n\
+GET    /users/:id         => show_user\n\
+DELETE /users/:id/posts   => delete_posts\n\
+";
+
+static_assert(yyrecognizer::valid(routes), "routing table does not parse");
+
+#ifdef BROKEN
+static_assert(yyrecognizer::valid("GET /users/: => list\n"), "routing table does not parse");
+#endif
+
+int main()
+{
+  char line[1024];
+
+  while (fgets(line, sizeof(line), stdin))
+    {
+      yyrecognizer yy(line);
+      if (yy.match() == (int)strlen(line))
+	printf("ok        %s", line);
+      else
+	printf("error %3d %s", yy.furthest(), line);
+    }
+
+  return 0;
+}
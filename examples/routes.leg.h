@@ -0,0 +1,487 @@
+/* A recursive-descent parser generated by peg 0.1.18 */
+
+#include <string_view>
+#define YYRULECOUNT 12
+#ifndef YYRECOGNIZER
+#define YYRECOGNIZER	yyrecognizer
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( yy->_begin= yy->_pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( yy->_end= yy->_pos, 1)
+#endif
+#define yytext		yyText(yy)
+#define yyleng		((int)yyText(yy).size())
+
+class YYRECOGNIZER
+{
+public:
+  typedef YYRECOGNIZER yycontext;
+
+  constexpr explicit YYRECOGNIZER(std::string_view text) : _buf(text) {}
+
+  /* The position furthest into the text reached by the last match. */
+  constexpr int furthest() const	{ return _maxpos; }
+
+  /* Answer whether the start rule matches the whole of text. */
+  static constexpr bool valid(std::string_view text)
+  {
+    YYRECOGNIZER yy(text);
+    return yy.match() == (int)text.size();
+  }
+
+  std::string_view _buf;
+  int		   _pos= 0;
+  int		   _maxpos= 0;
+  int		   _begin= 0;
+  int		   _end= 0;
+
+  static constexpr void yyrecordMaxPos(yycontext *yy)
+  {
+    if (yy->_pos > yy->_maxpos)
+      yy->_maxpos= yy->_pos;
+  }
+
+  static constexpr int yymatchDot(yycontext *yy)
+  {
+    if (yy->_pos >= (int)yy->_buf.size()) return 0;
+    ++yy->_pos;
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static constexpr int yymatchChar(yycontext *yy, int c)
+  {
+    if (yy->_pos >= (int)yy->_buf.size() || (unsigned char)yy->_buf[yy->_pos] != c) return 0;
+    ++yy->_pos;
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static constexpr int yymatchString(yycontext *yy, const char *s)
+  {
+    int yysav= yy->_pos;
+    for (;  *s;  ++s, ++yy->_pos)
+      if (yy->_pos >= (int)yy->_buf.size() || yy->_buf[yy->_pos] != *s)
+	{
+	  yy->_pos= yysav;
+	  return 0;
+	}
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static constexpr int yymatchIString(yycontext *yy, const char *s)
+  {
+    int yysav= yy->_pos;
+    for (;  *s;  ++s, ++yy->_pos)
+      {
+	int c= yy->_pos < (int)yy->_buf.size() ? (unsigned char)yy->_buf[yy->_pos] : -1;
+	if (('A' <= c && c <= 'Z' ? c - 'A' + 'a' : c) != *s)
+	  {
+	    yy->_pos= yysav;
+	    return 0;
+	  }
+      }
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static constexpr int yymatchClass(yycontext *yy, const char *bits)
+  {
+    int c;
+    if (yy->_pos >= (int)yy->_buf.size()) return 0;
+    c= (unsigned char)yy->_buf[yy->_pos];
+    if (!((unsigned char)bits[c >> 3] & (1 << (c & 7)))) return 0;
+    ++yy->_pos;
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static constexpr std::string_view yyText(yycontext *yy)
+  {
+    return yy->_end > yy->_begin ? yy->_buf.substr(yy->_begin, yy->_end - yy->_begin) : std::string_view();
+  }
+
+  /* Match the start rule at the start of the text and answer the length
+   * of the match, or -1 if it fails.
+   */
+  constexpr int match()	{ return yyrtable(this) ? _pos : -1; }
+
+static constexpr int yy1(yycontext *yy)
+{
+  if (yymatchClass(yy, "\000\000\000\000\000\000\377\003\000\000\000\200\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000") <= 0) return 0;
+  for (;;)
+    {
+      int yypos= yy->_pos, yyr= yymatchClass(yy, "\000\000\000\000\000\000\377\003\000\000\000\200\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000");
+      if (yyr < 0) return 0;
+      if (!yyr)
+	{
+	  yy->_pos= yypos;
+	  return 1;
+	}
+    }
+}
+
+static constexpr int yyrname(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy1(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy2(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yymatchChar(yy, ':')) <= 0) return yyr;
+  if ((yyr= yyrname(yy)) <= 0) return -1;
+  return 1;
+}
+
+static constexpr int yy3(yycontext *yy)
+{
+  int yypos= yy->_pos, yyr;
+  if ((yyr= yy2(yy)) > 0) return 1;
+  if (yyr < 0) return 0;
+  yy->_pos= yypos;
+  return yyrname(yy) > 0;
+}
+
+static constexpr int yyrsegment(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy3(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy4(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yymatchString(yy, "->")) <= 0) return yyr;
+  if ((yyr= yyr_(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yyrREDIRECT(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy4(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy5(yycontext *yy)
+{
+  int yypos= yy->_pos, yyr;
+  if ((yyr= yymatchChar(yy, '\n')) > 0) return 1;
+  yy->_pos= yypos;
+  if ((yyr= yymatchString(yy, "\r\n")) > 0) return 1;
+  yy->_pos= yypos;
+  return yymatchChar(yy, ';') > 0;
+}
+
+static constexpr int yy6(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yy5(yy)) <= 0) return yyr;
+  if ((yyr= yyr_(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yyrEOL(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy6(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy7(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= (YY_BEGIN)) <= 0) return yyr;
+  if ((yyr= yyrname(yy)) <= 0) return yyr;
+  if ((yyr= (YY_END)) <= 0) return yyr;
+  if ((yyr= ( yyleng <= 16 )) <= 0) return yyr;
+  if ((yyr= yyr_(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yyrhandler(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy7(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy8(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yymatchString(yy, "=>")) <= 0) return yyr;
+  if ((yyr= yyr_(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yyrARROW(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy8(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy9(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yymatchChar(yy, '/')) <= 0) return yyr;
+  if ((yyr= yyrsegment(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yy10(yycontext *yy)
+{
+  if (yy9(yy) <= 0) return 0;
+  for (;;)
+    {
+      int yypos= yy->_pos, yyr= yy9(yy);
+      if (yyr < 0) return 0;
+      if (!yyr)
+	{
+	  yy->_pos= yypos;
+	  return 1;
+	}
+    }
+}
+
+static constexpr int yy11(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yy10(yy)) <= 0) return yyr;
+  if ((yyr= yyr_(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yy12(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yymatchChar(yy, '/')) <= 0) return yyr;
+  if ((yyr= yyr_(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yy13(yycontext *yy)
+{
+  int yypos= yy->_pos, yyr;
+  if ((yyr= yy11(yy)) > 0) return 1;
+  yy->_pos= yypos;
+  return yy12(yy) > 0;
+}
+
+static constexpr int yyrpath(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy13(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy14(yycontext *yy)
+{
+  if (yymatchClass(yy, "\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000") <= 0) return 0;
+  for (;;)
+    {
+      int yypos= yy->_pos, yyr= yymatchClass(yy, "\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000");
+      if (yyr < 0) return 0;
+      if (!yyr)
+	{
+	  yy->_pos= yypos;
+	  return 1;
+	}
+    }
+}
+
+static constexpr int yy15(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yymatchChar(yy, 'v')) <= 0) return yyr;
+  if ((yyr= yy14(yy)) <= 0) return yyr;
+  if ((yyr= yyr_(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yyrversion(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy15(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy16(yycontext *yy)
+{
+  int yypos= yy->_pos, yyr;
+  if ((yyr= yymatchString(yy, "GET")) > 0) return 1;
+  yy->_pos= yypos;
+  if ((yyr= yymatchString(yy, "POST")) > 0) return 1;
+  yy->_pos= yypos;
+  if ((yyr= yymatchString(yy, "PUT")) > 0) return 1;
+  yy->_pos= yypos;
+  return yymatchString(yy, "DELETE") > 0;
+}
+
+static constexpr int yy17(yycontext *yy)
+{
+  int yypos= yy->_pos, yymaxpos= yy->_maxpos, yyr= yymatchClass(yy, "\000\000\000\000\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000");
+  yy->_pos= yypos;
+  yy->_maxpos= yymaxpos;
+  return yyr <= 0;
+}
+
+static constexpr int yy18(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yy16(yy)) <= 0) return yyr;
+  if ((yyr= yy17(yy)) <= 0) return yyr;
+  if ((yyr= yyr_(yy)) <= 0) return -1;
+  return 1;
+}
+
+static constexpr int yyrmethod(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy18(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy19(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yymatchChar(yy, ':')) <= 0) return yyr;
+  if ((yyr= yyrversion(yy)) <= 0) return -1;
+  return 1;
+}
+
+static constexpr int yy20(yycontext *yy)
+{
+  int yypos= yy->_pos, yyr= yy19(yy);
+  if (yyr < 0) return 0;
+  if (!yyr) yy->_pos= yypos;
+  return 1;
+}
+
+static constexpr int yy21(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yy20(yy)) <= 0) return yyr;
+  if ((yyr= yyrpath(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yy22(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yyrmethod(yy)) <= 0) return yyr;
+  if ((yyr= yy21(yy)) <= 0) return yyr;
+  if ((yyr= yyrARROW(yy)) <= 0) return yyr;
+  if ((yyr= yyrhandler(yy)) <= 0) return yyr;
+  if ((yyr= yyrEOL(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yy23(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yyrmethod(yy)) <= 0) return yyr;
+  if ((yyr= yyrpath(yy)) <= 0) return yyr;
+  if ((yyr= yyrREDIRECT(yy)) <= 0) return yyr;
+  if ((yyr= yyrpath(yy)) <= 0) return yyr;
+  if ((yyr= yyrEOL(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yy24(yycontext *yy)
+{
+  int yypos= yy->_pos, yyr;
+  if ((yyr= yy22(yy)) > 0) return 1;
+  yy->_pos= yypos;
+  return yy23(yy) > 0;
+}
+
+static constexpr int yyrroute(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy24(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy25(yycontext *yy)
+{
+  for (;;)
+    {
+      int yypos= yy->_pos, yyr= yymatchClass(yy, "\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000");
+      if (yyr < 0) return 0;
+      if (!yyr)
+	{
+	  yy->_pos= yypos;
+	  return 1;
+	}
+    }
+}
+
+static constexpr int yyr_(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy25(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+static constexpr int yy26(yycontext *yy)
+{
+  for (;;)
+    {
+      int yypos= yy->_pos, yyr= yyrroute(yy);
+      if (yyr < 0) return 0;
+      if (!yyr)
+	{
+	  yy->_pos= yypos;
+	  return 1;
+	}
+    }
+}
+
+static constexpr int yy27(yycontext *yy)
+{
+  int yypos= yy->_pos, yymaxpos= yy->_maxpos, yyr= yymatchDot(yy);
+  yy->_pos= yypos;
+  yy->_maxpos= yymaxpos;
+  return yyr <= 0;
+}
+
+static constexpr int yy28(yycontext *yy)
+{
+  int yyr;
+  if ((yyr= yyr_(yy)) <= 0) return yyr;
+  if ((yyr= yy26(yy)) <= 0) return yyr;
+  if ((yyr= yy27(yy)) <= 0) return yyr;
+  return 1;
+}
+
+static constexpr int yyrtable(yycontext *yy)
+{
+  int yypos= yy->_pos;
+  if (yy28(yy) > 0) return 1;
+  yy->_pos= yypos;
+  return 0;
+}
+
+};
+
+#undef yytext
+#undef yyleng
@@ -0,0 +1,74 @@
+/* Match stdin against each grammar named on the command line, compiled
+ * at run time, and print the captures.  With -n the grammars are
+ * compiled to native code and cached in the default directory.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libpeg.h"
+
+static char *slurp(FILE *in, size_t *length)
+{
+  size_t size= 1024, n;
+  char  *text= malloc(size);
+  *length= 0;
+  while ((n= fread(text + *length, 1, size - *length - 1, in)) > 0)
+    if ((*length += n) == size - 1)
+      text= realloc(text, size *= 2);
+  text[*length]= '\0';
+  return text;
+}
+
+static void capture(void *user, const peg_capture *capture)
+{
+  const char *input= user;
+  printf("%-8s %-28s '%.*s'\n", capture->rule, capture->text, (int)(capture->end - capture->begin), input + capture->begin);
+}
+
+int main(int argc, char **argv)
+{
+  peg_callbacks callbacks= { capture };
+  size_t	length;
+  char	       *input= slurp(stdin, &length);
+  int		native= 0, i= 1;
+
+  if (argc > 1 && !strcmp(argv[1], "-n"))
+    native= i++;
+
+  for (;  i < argc;  ++i)
+    {
+      FILE	  *file= fopen(argv[i], "r");
+      size_t	   size;
+      char	  *text, *error;
+      peg_grammar *grammar;
+      long	   offset, n;
+
+      if (!file)
+	{
+	  perror(argv[i]);
+	  exit(1);
+	}
+      text= slurp(file, &size);
+      fclose(file);
+      printf("%s:\n", argv[i]);
+      if (!(grammar= native ? peg_compile_native(text, 0, &error) : peg_compile(text, &error)))
+	{
+	  printf("%s\n", error);
+	  free(error);
+	}
+      else
+	{
+	  for (offset= 0;  offset < length;  offset += n)
+	    if ((n= peg_match(grammar, input + offset, length - offset, &callbacks, input + offset)) <= 0)
+	      break;
+	  printf("matched %ld of %ld\n", offset, (long)length);
+	  peg_free(grammar);
+	}
+      free(text);
+    }
+
+  free(input);
+  return 0;
+}
@@ -0,0 +1,23 @@
+/* Parse statements from a string in memory and then from stdin with the
+ * parser class generated by leg -C from typed.leg.
+ */
+
+#include "typed.leg.h"
+
+static int input(char *buf, int size)
+{
+  return fread(buf, 1, size, stdin);
+}
+
+int main()
+{
+  yyparser<yymemory>		memory("width = 2.5; height = 4; width * height\n");
+  yyparser<yystream<int (*)(char *, int)> > stream(input);
+
+  while (memory.parse())
+    printf("%g\n", memory.value());
+  while (stream.parse())
+    printf("%g\n", stream.value());
+
+  return 0;
+}
@@ -0,0 +1,1036 @@
+/* A recursive-descent parser generated by peg 0.1.18 */
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+#define YYRULECOUNT 15
+#line 3 "typed.leg"
+
+#include <map>
+#include <string>
+
+static std::map<std::string, double> variables;
+
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YYPARSER
+#define YYPARSER	yyparser
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( yy->_begin= yy->_pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( yy->_end= yy->_pos, 1)
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+#ifndef YY_STACK_SIZE
+#define YY_STACK_SIZE 128
+#endif
+#ifndef YY_BUFFER_SIZE
+#define YY_BUFFER_SIZE 1024
+#endif
+
+#ifndef YY_CPP_RUNTIME
+#define YY_CPP_RUNTIME
+
+struct yythunk { int begin, end;  unsigned short action; };
+
+enum { yyThunkPush= 0, yyThunkPop, yyThunkSet, yyThunkActions };
+
+/* Input policy for text that is already in memory.  The parser reads it
+ * in place and never asks for more.
+ */
+struct yymemory
+{
+  const char *_buf;
+  int	      _limit;
+
+  yymemory(const char *text, size_t length) : _buf(text), _limit((int)length) {}
+  explicit yymemory(const char *text) : _buf(text), _limit((int)strlen(text)) {}
+
+  bool refill()		{ return false; }
+  void discard(int n)	{ _buf += n;  _limit -= n; }
+};
+
+/* Input policy for text that arrives a piece at a time.  source(buf, size)
+ * stores at most size bytes in buf and answers how many, or 0 at the end
+ * of the input.
+ */
+template <class Source>
+struct yystream
+{
+  char  *_buf;
+  int	 _buflen;
+  int	 _limit;
+  Source _source;
+
+  explicit yystream(Source source)
+    : _buf((char *)malloc(YY_BUFFER_SIZE)), _buflen(YY_BUFFER_SIZE), _limit(0), _source(source) {}
+  ~yystream()	{ free(_buf); }
+  yystream(const yystream &)= delete;
+  yystream &operator=(const yystream &)= delete;
+
+  bool refill()
+  {
+    int n;
+    while (_buflen - _limit < 512)
+      _buf= (char *)realloc(_buf, _buflen *= 2);
+    if ((n= _source(_buf + _limit, _buflen - _limit)) <= 0)
+      return false;
+    _limit += n;
+    return true;
+  }
+
+  void discard(int n)	{ memmove(_buf, _buf + n, _limit -= n); }
+};
+
+#ifndef yyprintf
+# ifdef YY_DEBUG
+#  define yyprintf(args)	fprintf args
+# else
+#  define yyprintf(args)
+# endif
+#endif
+
+/* The primitives that matching is made of, for a Context that is also
+ * an input policy.  The parsers of leg -C and peg::parser derive from
+ * this, and leg copies everything from YY_CPP_RUNTIME to here into each
+ * parser it writes with -C.
+ */
+template <class Context>
+struct yymatcher
+{
+  typedef Context yycontext;
+
+  static void yyrecordMaxPos(yycontext *yy)
+  {
+    if (yy->_pos > yy->_maxpos)
+      yy->_maxpos= yy->_pos;
+  }
+
+  static int yymatchDot(yycontext *yy)
+  {
+    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+    ++yy->_pos;
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static int yymatchChar(yycontext *yy, int c)
+  {
+    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+    if ((unsigned char)yy->_buf[yy->_pos] == c)
+      {
+	++yy->_pos;
+	yyrecordMaxPos(yy);
+	yyprintf((stderr, "  ok   yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+	return 1;
+      }
+    yyprintf((stderr, "  fail yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+    return 0;
+  }
+
+  static int yymatchString(yycontext *yy, const char *s)
+  {
+    int yysav= yy->_pos;
+    while (*s)
+      {
+	if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+	if (yy->_buf[yy->_pos] != *s)
+	  {
+	    yy->_pos= yysav;
+	    return 0;
+	  }
+	++s;
+	++yy->_pos;
+      }
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static int yymatchIString(yycontext *yy, const char *s)
+  {
+    int yysav= yy->_pos;
+    while (*s)
+      {
+	if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+	if (tolower(yy->_buf[yy->_pos]) != *s)
+	  {
+	    yy->_pos= yysav;
+	    return 0;
+	  }
+	++s;
+	++yy->_pos;
+      }
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static int yymatchClass(yycontext *yy, const unsigned char *bits)
+  {
+    int c;
+    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+    c= (unsigned char)yy->_buf[yy->_pos];
+    if (bits[c >> 3] & (1 << (c & 7)))
+      {
+	++yy->_pos;
+	yyrecordMaxPos(yy);
+	yyprintf((stderr, "  ok   yymatchClass @ %s\n", yy->_buf+yy->_pos));
+	return 1;
+      }
+    yyprintf((stderr, "  fail yymatchClass @ %s\n", yy->_buf+yy->_pos));
+    return 0;
+  }
+
+  static int yyText(yycontext *yy, int begin, int end)
+  {
+    int yyleng= end - begin;
+    if (yyleng < 0)
+      yyleng= 0;
+    if (yy->_textlen < yyleng + 1)
+      {
+	while (yy->_textlen < yyleng + 1)
+	  yy->_textlen= yy->_textlen ? 2 * yy->_textlen : YY_BUFFER_SIZE;
+	yy->_text= (char *)realloc(yy->_text, yy->_textlen);
+      }
+    memcpy(yy->_text, yy->_buf + begin, yyleng);
+    yy->_text[yyleng]= '\0';
+    return yyleng;
+  }
+
+  static void yyCommit(yycontext *yy)
+  {
+    yy->discard(yy->_pos);
+    yy->_begin -= yy->_pos;
+    yy->_end -= yy->_pos;
+    yy->_offset += yy->_pos;
+    yy->_pos= yy->_thunkpos= 0;
+  }
+};
+
+#define YY_MATCHER(C)					\
+  using yymatcher<C>::yyrecordMaxPos;			\
+  using yymatcher<C>::yymatchDot;			\
+  using yymatcher<C>::yymatchChar;			\
+  using yymatcher<C>::yymatchString;			\
+  using yymatcher<C>::yymatchIString;			\
+  using yymatcher<C>::yymatchClass;			\
+  using yymatcher<C>::yyText;				\
+  using yymatcher<C>::yyCommit
+
+#endif /* YY_CPP_RUNTIME */
+
+template <class Input>
+class YYPARSER : public Input, public yymatcher<YYPARSER<Input> >
+{
+public:
+  typedef YYPARSER yycontext;
+  YY_MATCHER(YYPARSER);
+
+  template <class... Args>
+  explicit YYPARSER(Args &&... args) : Input(std::forward<Args>(args)...) {}
+  ~YYPARSER()	{ free(_text); }
+  YYPARSER(const YYPARSER &)= delete;
+  YYPARSER &operator=(const YYPARSER &)= delete;
+
+  /* Match the start rule against the input that follows the previous
+   * match, run its actions, and answer whether it matched.
+   */
+  bool parse()		{ return yyParseFrom(yyrStmt); }
+
+  /* The semantic value of the start rule after a match. */
+  double &value()		{ return _2; }
+
+  /* The offset in the input of the text following the previous match. */
+  size_t offset() const	{ return _offset; }
+
+  int	   _pos= 0;
+  int	   _maxpos= 0;
+  char	  *_text= 0;
+  int	   _textlen= 0;
+  int	   _begin= 0;
+  int	   _end= 0;
+  int	   _choices= 0;
+  size_t   _offset= 0;
+  std::vector<yythunk> _thunks;
+  int	   _thunkpos= 0;
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+  YYSTYPE _0{};
+  std::vector<YYSTYPE > _vals0;
+  int _val0= 0;
+  std::string _1{};
+  std::vector<std::string > _vals1;
+  int _val1= 0;
+  double _2{};
+  std::vector<double > _vals2;
+  int _val2= 0;
+
+#define yyEnter(yy)
+#define yyLeave(yy)
+#define yyPoll(yy)
+#define yyStep(yy)
+#define yyAvail(yy, p)		((p) < (yy)->_limit || ((yy)->_pos= (p), (yy)->refill()))
+#define yyByte(yy, p)		((unsigned char)(yy)->_buf[p])
+#define yyInClass(bits, c)	((bits)[(c) >> 3] & (1 << ((c) & 7)))
+
+  static void yyDo(yycontext *yy, int action, int begin, int end)
+  {
+    if (yy->_thunkpos >= (int)yy->_thunks.size())
+      yy->_thunks.resize(yy->_thunks.empty() ? YY_STACK_SIZE : 2 * yy->_thunks.size());
+    yythunk &thunk= yy->_thunks[yy->_thunkpos++];
+    thunk.begin=  begin;
+    thunk.end=    end;
+    thunk.action= action;
+  }
+
+  /* Semantic values live in one stack per type.  A rule with variables
+   * pushes a frame on the stack of each of their types when it starts and
+   * pops it when it succeeds; a variable is set from y_ of the same type.
+   */
+  template <class T>
+  static void yyValues(std::vector<T> &vals, int &val, T &value, int action, int count)
+  {
+    switch (action)
+      {
+      case yyThunkPush:
+	val += count;
+	if ((int)vals.size() <= val)
+	  vals.resize(vals.empty() ? YY_STACK_SIZE : 2 * vals.size());
+	break;
+      case yyThunkPop:	val -= count;		break;
+      case yyThunkSet:	vals[val + count]= value;	break;
+      }
+  }
+
+  static void yyDone(yycontext *yy)
+  {
+    int pos;
+    for (pos= 0;  pos < yy->_thunkpos;  ++pos)
+      {
+	yythunk *thunk= &yy->_thunks[pos];
+	if (thunk->action < yyThunkActions)
+	  yyValue(yy, thunk->action, thunk->begin, thunk->end);
+	else
+	  {
+	    int yyleng= yyText(yy, thunk->begin, thunk->end);
+	    yyprintf((stderr, "DO [%d] %d %s\n", pos, thunk->action, yy->_text));
+	    yyDispatch(yy, thunk->action, yy->_text, yyleng);
+	  }
+      }
+    yy->_thunkpos= 0;
+  }
+
+  static void yyStream(yycontext *yy)
+  {
+    int keep= yy->_pos;
+    if (yy->_begin >= 0 && yy->_begin < keep) keep= yy->_begin;
+    if (yy->_end   >= 0 && yy->_end   < keep) keep= yy->_end;
+    yyDone(yy);
+    if (keep > 0 && keep >= yy->_limit - keep)
+      {
+	yyprintf((stderr, "stream %d of %d\n", keep, yy->_limit));
+	yy->discard(keep);
+	yy->_pos -= keep;
+	yy->_begin -= keep;
+	yy->_end -= keep;
+	yy->_maxpos= (yy->_maxpos > keep) ? yy->_maxpos - keep : 0;
+	yy->_offset += keep;
+      }
+  }
+
+  static int yyAccept(yycontext *yy, int tp0)
+  {
+    if (tp0)
+      {
+	fprintf(stderr, "accept denied at %d\n", tp0);
+	return 0;
+      }
+    yyDone(yy);
+    yyCommit(yy);
+    return 1;
+  }
+
+  bool yyParseFrom(int (*yystart)(yycontext *yy))
+  {
+    int	   yyok;
+    size_t yyoffset= _offset;
+    _begin= _end= -1;
+    _thunkpos= _choices= 0;
+    yyClear(this);
+    yyok= yystart(this);
+    if (yyok) yyDone(this);
+    else if (_offset != yyoffset) _pos= 0;	/* start of parse already discarded */
+    yyCommit(this);
+    return yyok;
+  }
+
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)
+
+  static void yyValue(yycontext *yy, int action, int count, int type)
+  {
+    switch (type)
+      {
+      case 0:	yyValues(yy->_vals0, yy->_val0, yy->_0, action, count);	break;
+      case 1:	yyValues(yy->_vals1, yy->_val1, yy->_1, action, count);	break;
+      case 2:	yyValues(yy->_vals2, yy->_val2, yy->_2, action, count);	break;
+      }
+  }
+
+  static void yyClear(yycontext *yy)
+  {
+    yy->_val0= 0;
+    yy->_val1= 0;
+    yy->_val2= 0;
+  }
+
+enum {
+  yy_1_Name= yyThunkActions + 13,
+  yy_3_Value= yyThunkActions + 12,
+  yy_2_Value= yyThunkActions + 11,
+  yy_1_Value= yyThunkActions + 10,
+  yy_3_Product= yyThunkActions + 9,
+  yy_2_Product= yyThunkActions + 8,
+  yy_1_Product= yyThunkActions + 7,
+  yy_3_Sum= yyThunkActions + 6,
+  yy_2_Sum= yyThunkActions + 5,
+  yy_1_Sum= yyThunkActions + 4,
+  yy_2_Expr= yyThunkActions + 3,
+  yy_1_Expr= yyThunkActions + 2,
+  yy_2_Stmt= yyThunkActions + 1,
+  yy_1_Stmt= yyThunkActions + 0,
+};
+
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng)
+{
+  switch (yyaction)
+    {
+    case yy_1_Name:
+      {
+#define y_ yy->_1
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_Name\n"));
+  {
+#line 33
+   y_= yytext; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_3_Value:
+      {
+#define e yy->_vals2[yy->_val2 + -1]
+#define n yy->_vals1[yy->_val1 + -1]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_Value\n"));
+  {
+#line 31
+   y_= e; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+#undef n
+      }
+      break;
+    case yy_2_Value:
+      {
+#define e yy->_vals2[yy->_val2 + -1]
+#define n yy->_vals1[yy->_val1 + -1]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_Value\n"));
+  {
+#line 30
+   y_= variables[n]; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+#undef n
+      }
+      break;
+    case yy_1_Value:
+      {
+#define e yy->_vals2[yy->_val2 + -1]
+#define n yy->_vals1[yy->_val1 + -1]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_Value\n"));
+  {
+#line 29
+   y_= atof(yytext); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+#undef n
+      }
+      break;
+    case yy_3_Product:
+      {
+#define r yy->_vals2[yy->_val2 + -1]
+#define l yy->_vals2[yy->_val2 + -2]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_Product\n"));
+  {
+#line 27
+   y_= l; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_Product:
+      {
+#define r yy->_vals2[yy->_val2 + -1]
+#define l yy->_vals2[yy->_val2 + -2]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_Product\n"));
+  {
+#line 26
+   l /= r; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_1_Product:
+      {
+#define r yy->_vals2[yy->_val2 + -1]
+#define l yy->_vals2[yy->_val2 + -2]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_Product\n"));
+  {
+#line 25
+   l *= r; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_3_Sum:
+      {
+#define r yy->_vals2[yy->_val2 + -1]
+#define l yy->_vals2[yy->_val2 + -2]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_Sum\n"));
+  {
+#line 22
+   y_= l; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_Sum:
+      {
+#define r yy->_vals2[yy->_val2 + -1]
+#define l yy->_vals2[yy->_val2 + -2]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_Sum\n"));
+  {
+#line 21
+   l -= r; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_1_Sum:
+      {
+#define r yy->_vals2[yy->_val2 + -1]
+#define l yy->_vals2[yy->_val2 + -2]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_Sum\n"));
+  {
+#line 20
+   l += r; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef r
+#undef l
+      }
+      break;
+    case yy_2_Expr:
+      {
+#define s yy->_vals2[yy->_val2 + -1]
+#define n yy->_vals1[yy->_val1 + -1]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_Expr\n"));
+  {
+#line 17
+   y_= s; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef n
+      }
+      break;
+    case yy_1_Expr:
+      {
+#define s yy->_vals2[yy->_val2 + -1]
+#define n yy->_vals1[yy->_val1 + -1]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_Expr\n"));
+  {
+#line 16
+   y_= variables[n]= s; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef s
+#undef n
+      }
+      break;
+    case yy_2_Stmt:
+      {
+#define e yy->_vals2[yy->_val2 + -1]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_2_Stmt\n"));
+  {
+#line 14
+   y_= 0; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    case yy_1_Stmt:
+      {
+#define e yy->_vals2[yy->_val2 + -1]
+#define y_ yy->_2
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_1_Stmt\n"));
+  {
+#line 13
+   y_= e; ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+#undef e
+      }
+      break;
+    }
+}
+
+
+YY_LOCAL(int) yyscan0(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 41) goto l1;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l1:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan1(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 40) goto l2;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l2:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan2(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 47) goto l3;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l3:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan3(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 42) goto l4;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l4:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan4(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 45) goto l5;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l5:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan5(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 43) goto l6;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l6:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan6(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 61) goto l7;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l7:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan7(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq10= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l11;  ++yyp;  if (yyp > yym) yym= yyp;  goto l9;
+  l11:;	  yyp= yyq10;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l12;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l12;  ++yyp;  if (yyp > yym) yym= yyp;  goto l9;
+  l12:;	  yyp= yyq10;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l13;  ++yyp;  if (yyp > yym) yym= yyp;  goto l9;
+  l13:;	  yyp= yyq10;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 59) goto l8;  ++yyp;  if (yyp > yym) yym= yyp;
+  l9:;	  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l8:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan8(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+}
+
+YY_LOCAL(int) yyscan9(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l15;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l15;  ++yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_END)) goto l15;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l15:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan10(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l16;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l16;  ++yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  { int yyq17= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 46) goto l17;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l17;  ++yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;  goto l18;
+  l17:;	  yyp= yyq17;
+  l18:;	  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l16;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l16:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan11(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq20= yyp, yym20= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 61) goto l20;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\002\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;  yym= yym20;  goto l19;
+  l20:;	  yyp= yyq20;  yym= yym20;  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l19:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan12(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq23;
+  l22:;	  yyPoll(yy);  yyq23= yyp;
+  { int yyq24= yyp, yym24= yym;
+  { int yyq26= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l27;  ++yyp;  if (yyp > yym) yym= yyp;  goto l25;
+  l27:;	  yyp= yyq26;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l28;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l28;  ++yyp;  if (yyp > yym) yym= yyp;  goto l25;
+  l28:;	  yyp= yyq26;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l29;  ++yyp;  if (yyp > yym) yym= yyp;  goto l25;
+  l29:;	  yyp= yyq26;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 59) goto l24;  ++yyp;  if (yyp > yym) yym= yyp;
+  l25:;	  }  yym= yym24;  goto l23;
+  l24:;	  yyp= yyq24;  yym= yym24;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l23;  ++yyp;  if (yyp > yym) yym= yyp;  goto l22;
+  l23:;	  yyp= yyq23;  }
+  { int yyq31= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l32;  ++yyp;  if (yyp > yym) yym= yyp;  goto l30;
+  l32:;	  yyp= yyq31;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l33;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l33;  ++yyp;  if (yyp > yym) yym= yyp;  goto l30;
+  l33:;	  yyp= yyq31;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l34;  ++yyp;  if (yyp > yym) yym= yyp;  goto l30;
+  l34:;	  yyp= yyq31;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 59) goto l21;  ++yyp;  if (yyp > yym) yym= yyp;
+  l30:;	  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l21:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_RULE(int) yyrCLOSE(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yyscan0(yy)) goto l35;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CLOSE", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l35:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CLOSE", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrOPEN(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "OPEN"));  if (!yyscan1(yy)) goto l36;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPEN", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l36:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPEN", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrDIVIDE(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "DIVIDE"));  if (!yyscan2(yy)) goto l37;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DIVIDE", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l37:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DIVIDE", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrTIMES(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "TIMES"));  if (!yyscan3(yy)) goto l38;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TIMES", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l38:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TIMES", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrMINUS(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "MINUS"));  if (!yyscan4(yy)) goto l39;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MINUS", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l39:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MINUS", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrPLUS(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "PLUS"));  if (!yyscan5(yy)) goto l40;
+  yyprintf((stderr, "  ok   %s @ %s\n", "PLUS", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l40:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "PLUS", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrASSIGN(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "ASSIGN"));  if (!yyscan6(yy)) goto l41;
+  yyprintf((stderr, "  ok   %s @ %s\n", "ASSIGN", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l41:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ASSIGN", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrEOL(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "EOL"));  if (!yyscan7(yy)) goto l42;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EOL", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l42:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EOL", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyr_(yycontext *yy)
+{
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "_"));  yyscan8(yy);
+  yyprintf((stderr, "  ok   %s @ %s\n", "_", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+}
+YY_RULE(int) yyrName(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "Name"));  if (!yyscan9(yy)) goto l44;  yyDo(yy, yy_1_Name, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Name", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l44:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Name", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrValue(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 1, 1);  yyDo(yy, yyThunkPush, 1, 2);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "Value"));
+  {  int yypos46= yy->_pos, yythunkpos46= yy->_thunkpos;  if (!yyscan10(yy)) goto l47;  yyDo(yy, yy_1_Value, yy->_begin, yy->_end);  goto l46;
+  l47:;	  yy->_pos= yypos46; yy->_thunkpos= yythunkpos46;  if (!yyrName(yy)) goto l48;  yyDo(yy, yyThunkSet, -1, 1);  if (!yyscan11(yy)) goto l48;  yyDo(yy, yy_2_Value, yy->_begin, yy->_end);  goto l46;
+  l48:;	  yy->_pos= yypos46; yy->_thunkpos= yythunkpos46;  if (!yyrOPEN(yy)) goto l45;  if (!yyrExpr(yy)) goto l45;  yyDo(yy, yyThunkSet, -1, 2);  if (!yyrCLOSE(yy)) goto l45;  yyDo(yy, yy_3_Value, yy->_begin, yy->_end);
+  }
+  l46:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Value", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 1, 1);  yyDo(yy, yyThunkPop, 1, 2);
+  yyLeave(yy);  return 1;
+  l45:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Value", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrProduct(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 2, 2);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "Product"));  if (!yyrValue(yy)) goto l49;  yyDo(yy, yyThunkSet, -2, 2);
+  l50:;	  yyPoll(yy);
+  {  int yypos51= yy->_pos, yythunkpos51= yy->_thunkpos;
+  {  int yypos52= yy->_pos, yythunkpos52= yy->_thunkpos;  if (!yyrTIMES(yy)) goto l53;  if (!yyrValue(yy)) goto l53;  yyDo(yy, yyThunkSet, -1, 2);  yyDo(yy, yy_1_Product, yy->_begin, yy->_end);  goto l52;
+  l53:;	  yy->_pos= yypos52; yy->_thunkpos= yythunkpos52;  if (!yyrDIVIDE(yy)) goto l51;  if (!yyrValue(yy)) goto l51;  yyDo(yy, yyThunkSet, -1, 2);  yyDo(yy, yy_2_Product, yy->_begin, yy->_end);
+  }
+  l52:;	  goto l50;
+  l51:;	  yy->_pos= yypos51; yy->_thunkpos= yythunkpos51;
+  }  yyDo(yy, yy_3_Product, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Product", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 2, 2);
+  yyLeave(yy);  return 1;
+  l49:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Product", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrSum(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 2, 2);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "Sum"));  if (!yyrProduct(yy)) goto l54;  yyDo(yy, yyThunkSet, -2, 2);
+  l55:;	  yyPoll(yy);
+  {  int yypos56= yy->_pos, yythunkpos56= yy->_thunkpos;
+  {  int yypos57= yy->_pos, yythunkpos57= yy->_thunkpos;  if (!yyrPLUS(yy)) goto l58;  if (!yyrProduct(yy)) goto l58;  yyDo(yy, yyThunkSet, -1, 2);  yyDo(yy, yy_1_Sum, yy->_begin, yy->_end);  goto l57;
+  l58:;	  yy->_pos= yypos57; yy->_thunkpos= yythunkpos57;  if (!yyrMINUS(yy)) goto l56;  if (!yyrProduct(yy)) goto l56;  yyDo(yy, yyThunkSet, -1, 2);  yyDo(yy, yy_2_Sum, yy->_begin, yy->_end);
+  }
+  l57:;	  goto l55;
+  l56:;	  yy->_pos= yypos56; yy->_thunkpos= yythunkpos56;
+  }  yyDo(yy, yy_3_Sum, yy->_begin, yy->_end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Sum", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 2, 2);
+  yyLeave(yy);  return 1;
+  l54:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Sum", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrExpr(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 1, 1);  yyDo(yy, yyThunkPush, 1, 2);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "Expr"));
+  {  int yypos60= yy->_pos, yythunkpos60= yy->_thunkpos;  if (!yyrName(yy)) goto l61;  yyDo(yy, yyThunkSet, -1, 1);  if (!yyrASSIGN(yy)) goto l61;  if (!yyrSum(yy)) goto l61;  yyDo(yy, yyThunkSet, -1, 2);  yyDo(yy, yy_1_Expr, yy->_begin, yy->_end);  goto l60;
+  l61:;	  yy->_pos= yypos60; yy->_thunkpos= yythunkpos60;  if (!yyrSum(yy)) goto l59;  yyDo(yy, yyThunkSet, -1, 2);  yyDo(yy, yy_2_Expr, yy->_begin, yy->_end);
+  }
+  l60:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Expr", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 1, 1);  yyDo(yy, yyThunkPop, 1, 2);
+  yyLeave(yy);  return 1;
+  l59:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Expr", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrStmt(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;  yyDo(yy, yyThunkPush, 1, 2);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "Stmt"));
+  {  int yypos63= yy->_pos, yythunkpos63= yy->_thunkpos;  if (!yyr_(yy)) goto l64;  if (!yyrExpr(yy)) goto l64;  yyDo(yy, yyThunkSet, -1, 2);  if (!yyrEOL(yy)) goto l64;  yyDo(yy, yy_1_Stmt, yy->_begin, yy->_end);  goto l63;
+  l64:;	  yy->_pos= yypos63; yy->_thunkpos= yythunkpos63;  if (!yyscan12(yy)) goto l62;  yyDo(yy, yy_2_Stmt, yy->_begin, yy->_end);
+  }
+  l63:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Stmt", yy->_buf+yy->_pos));  yyDo(yy, yyThunkPop, 1, 2);
+  yyLeave(yy);  return 1;
+  l62:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Stmt", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+};
+
+#undef yyEnter
+#undef yyLeave
+#undef yyPoll
+#undef YYACCEPT
@@ -20,6 +20,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <ctype.h>
 
 #ifdef WIN32
 # undef inline
@@ -29,6 +30,17 @@
 #include "version.h"
 #include "tree.h"
 
+int eagerFlag= 0;
+int streamFlag= 0;
+int gotoFlag= 0;
+int bytecodeFlag= 0;
+int cppFlag= 0;
+int constexprFlag= 0;
+int reentrantFlag= 0;
+int driverFlags= 0;
+
+static int events= 0;		/* rules post YYEVENT_ENTER and YYEVENT_LEAVE */
+
 static int yyl(void)
 {
   static int prev= 0;
@@ -89,13 +101,10 @@ static int cnext(unsigned char **ccp)
     return c;
 }
 
-static char *makeCharClass(unsigned char *cclass)
+static void makeCharBits(unsigned char *cclass, unsigned char bits[32])
 {
-  unsigned char	 bits[32];
   setter	 set;
   int		 c, prev= -1;
-  static char	 string[256];
-  char		*ptr;
 
   if ('^' == *cclass)
     {
@@ -124,784 +133,5503 @@ static char *makeCharClass(unsigned char *cclass)
 	  set(bits, prev= c);
 	}
     }
+}
+
+static char *formatCharBits(unsigned char bits[32])
+{
+  static char	 string[256];
+  char		*ptr= string;
+  int		 c;
 
-  ptr= string;
   for (c= 0;  c < 32;  ++c)
     ptr += sprintf(ptr, "\\%03o", bits[c]);
 
   return string;
 }
 
+static char *makeCharClass(unsigned char *cclass)
+{
+  unsigned char	 bits[32];
+
+  makeCharBits(cclass, bits);
+  return formatCharBits(bits);
+}
+
+/* Decode the escapes in a string or character as written in a
+ * grammar, in place.  Returns the length of the result.
+ */
+int unescape(char *string)
+{
+  unsigned char *in= (unsigned char *)string;
+  char		*out= string;
+
+  while (*in)
+    *out++= cnext(&in);
+  *out= '\0';
+  return out - string;
+}
+
 static void begin(void)		{ fprintf(output, "\n  {"); }
 static void end(void)		{ fprintf(output, "\n  }"); }
 static void label(int n)	{ fprintf(output, "\n  l%d:;\t", n); }
-static void jump(int n)		{ fprintf(output, "  goto l%d;", n); }
-static void save(int n)		{ fprintf(output, "  int yypos%d= yy->_pos, yythunkpos%d= yy->_thunkpos;", n, n); }
-static void restore(int n)	{ fprintf(output,     "  yy->_pos= yypos%d; yy->_thunkpos= yythunkpos%d;", n, n); }
-static void saveMaxPos(int n)	{ fprintf(output, "  int yymaxpos%d= yy->_maxpos;", n); }
-static void restoreMaxPos(int n){ fprintf(output,     "  yy->_maxpos= yymaxpos%d;", n); }
+static int ruleKo= 0;		/* where the rule being compiled fails */
+static int ruleKoUsed= 0;	/* whether anything in it can fail */
 
-static void Node_compile_c_ko(Node *node, int ko)
+static int fail(int ko)
 {
-  assert(node);
-  switch (node->type)
-    {
-    case Rule:
-      fprintf(stderr, "\ninternal error #1 (%s)\n", node->rule.name);
-      exit(1);
-      break;
-
-    case Dot:
-      fprintf(output, "  if (!yymatchDot(yy)) goto l%d;", ko);
-      break;
+  if (ko == ruleKo) ruleKoUsed= 1;
+  return ko;
+}
 
-    case Name:
-      fprintf(output, "  if (!yyr%s(yy)) goto l%d;", node->name.rule->rule.name, ko);
-      if (node->name.variable)
-	fprintf(output, "  yyDo(yy, yySet, %d, 0);", node->name.variable->variable.offset);
-      break;
+static void jump(int n)		{ fprintf(output, "  goto l%d;", fail(n)); }
 
-    case Character:
-    case String:
-      {
-	int len= strlen(node->string.value);
-	if (String == node->type && node->string.casefold)
-	  {
-    	    fprintf(output, "  if (!yymatchIString(yy, \"%s\")) goto l%d;", node->string.value, ko);
-	  } 
-	else if (1 == len)
-	  {
-	    if ('\'' == node->string.value[0])
-	      fprintf(output, "  if (!yymatchChar(yy, '\\'')) goto l%d;", ko);
-	    else
-	      fprintf(output, "  if (!yymatchChar(yy, '%s')) goto l%d;", node->string.value, ko);
-	  }
-	else
-	  if (2 == len && '\\' == node->string.value[0])
-	    fprintf(output, "  if (!yymatchChar(yy, '%s')) goto l%d;", node->string.value, ko);
-	  else
-	    fprintf(output, "  if (!yymatchString(yy, \"%s\")) goto l%d;", node->string.value, ko);
-      }
-      break;
+/* With -g the whole grammar is one function and a rule's saved
+ * positions live in its frame on an explicit stack instead of in C
+ * locals.  Slots 0 and 1 of a frame hold the return id and the
+ * caller's frame; each save point gets the next free slots.
+ */
+static int *frameKeys= 0, *frameSlots= 0;
+static int  frameCount= 0, frameMax= 0, frameSize= 2;
 
-    case Class:
-      fprintf(output, "  if (!yymatchClass(yy, (unsigned char *)\"%s\")) goto l%d;", makeCharClass(node->cclass.value), ko);
-      break;
+static int frameSlot(int key, int size)
+{
+  int i;
+  for (i= 0;  i < frameCount;  ++i)
+    if (key == frameKeys[i])
+      return frameSlots[i];
+  if (frameCount == frameMax)
+    {
+      frameMax= frameMax ? frameMax * 2 : 32;
+      frameKeys= (int *)realloc(frameKeys, sizeof(int) * frameMax);
+      frameSlots= (int *)realloc(frameSlots, sizeof(int) * frameMax);
+    }
+  frameKeys[frameCount]= key;
+  frameSlots[frameCount++]= frameSize;
+  frameSize += size;
+  return frameSize - size;
+}
 
-    case Action:
-      fprintf(output, "  yyDo(yy, yy%s, yy->_begin, yy->_end);", node->action.name);
-      break;
+static void save(int n)
+{
+  if (gotoFlag)
+    {
+      int k= frameSlot(2 * n, 2);
+      fprintf(output, "  yyF(%d)= yy->_pos; yyF(%d)= yy->_thunkpos;", k, k + 1);
+    }
+  else
+    fprintf(output, "  int yypos%d= yy->_pos, yythunkpos%d= yy->_thunkpos;", n, n);
+}
 
-    case Inline:
-      fprintf(output, "  yyText(yy, yy->_begin, yy->_end);\n");
-      fprintf(output, "#define yytext yy->_text\n");
-      fprintf(output, "#define yyleng yy->_textlen\n");
-      fprintf(output, "%s;\n", node->inLine.text);
-      fprintf(output, "#undef yytext\n");
-      fprintf(output, "#undef yyleng\n");
-      break;
+static void restore(int n)
+{
+  if (gotoFlag)
+    {
+      int k= frameSlot(2 * n, 2);
+      fprintf(output, "  yy->_pos= yyF(%d); yy->_thunkpos= yyF(%d);", k, k + 1);
+    }
+  else
+    fprintf(output, "  yy->_pos= yypos%d; yy->_thunkpos= yythunkpos%d;", n, n);
+}
 
-    case Predicate:
-      fprintf(output, "  yyText(yy, yy->_begin, yy->_end);  {\n");
-      fprintf(output, "#define yytext yy->_text\n");
-      fprintf(output, "#define yyleng yy->_textlen\n");
-      fprintf(output, "if (!(%s)) goto l%d;\n", node->predicate.text, ko);
-      fprintf(output, "#undef yytext\n");
-      fprintf(output, "#undef yyleng\n");
-      fprintf(output, "  }");
-      break;
+static void saveMaxPos(int n)
+{
+  if (gotoFlag)
+    fprintf(output, "  yyF(%d)= yy->_maxpos;", frameSlot(2 * n + 1, 1));
+  else
+    fprintf(output, "  int yymaxpos%d= yy->_maxpos;", n);
+}
 
-    case Error:
-      {
-	int eok= yyl(), eko= yyl();
-	Node_compile_c_ko(node->error.element, eko);
-	jump(eok);
-	label(eko);
-	fprintf(output, "  yyText(yy, yy->_begin, yy->_end);  {\n");
-	fprintf(output, "#define yytext yy->_text\n");
-	fprintf(output, "#define yyleng yy->_textlen\n");
-	fprintf(output, "  %s;\n", node->error.text);
-	fprintf(output, "#undef yytext\n");
-	fprintf(output, "#undef yyleng\n");
-	fprintf(output, "  }");
-	jump(ko);
-	label(eok);
-      }
-      break;
+static void restoreMaxPos(int n)
+{
+  if (gotoFlag)
+    fprintf(output, "  yy->_maxpos= yyF(%d);", frameSlot(2 * n + 1, 1));
+  else
+    fprintf(output, "  yy->_maxpos= yymaxpos%d;", n);
+}
 
-    case Alternate:
-      {
-	int ok= yyl();
-	begin();
-	save(ok);
-	for (node= node->alternate.first;  node;  node= node->alternate.next)
-	  if (node->alternate.next)
-	    {
-	      int next= yyl();
-	      Node_compile_c_ko(node, next);
-	      jump(ok);
-	      label(next);
-	      restore(ok);
-	    }
-	  else
-	    Node_compile_c_ko(node, ko);
-	end();
-	label(ok);
-      }
-      break;
+static int returns= 0;		/* call sites compiled so far with -g */
 
-    case Sequence:
-      for (node= node->sequence.first;  node;  node= node->sequence.next)
-	Node_compile_c_ko(node, ko);
-      break;
+static void call(Node *rule, int ko)
+{
+  if (gotoFlag)
+    {
+      int ret= returns++;
+      fprintf(output, "  yyret= %d;  goto yy_%s;  yyret%d:;  if (!yyok) goto l%d;", ret, rule->rule.name, ret, fail(ko));
+    }
+  else
+    fprintf(output, "  if (!yyr%s(yy)) goto l%d;", rule->rule.name, fail(ko));
+}
 
-    case PeekFor:
-      {
-	int ok= yyl();
-	begin();
-	save(ok);
-	Node_compile_c_ko(node->peekFor.element, ko);
-	restore(ok);
-	end();
-      }
-      break;
+static void ret(int ok)
+{
+  if (gotoFlag)
+    fprintf(output, "  yyok= %d;  goto yyreturn;", ok);
+  else
+    fprintf(output, "  return %d;", ok);
+}
+static void choice(void)	{ if (streamFlag) fprintf(output, "  ++yy->_choices;"); }
+static void unchoice(void)	{ if (streamFlag) fprintf(output, "  --yy->_choices;"); }
+static void stream(void)	{ if (streamFlag) fprintf(output, "  if (!yy->_choices) yyStream(yy);"); }
+static void poll(void)		{ fprintf(output, "  yyPoll(yy);"); }
 
-    case PeekNot:
-      {
-	int ok= yyl();
-	begin();
-	save(ok);
-	saveMaxPos(ok);
-	Node_compile_c_ko(node->peekFor.element, ok);
-	restoreMaxPos(ok);
-	jump(ko);
-	label(ok);
-	restore(ok);
-	restoreMaxPos(ok);
-	end();
-      }
-      break;
+/* With %token a rule named in the grammar can be a token, matched by
+ * looking up the token that the scanner finds at the current position
+ * instead of by calling the rule.  Within token rules, and the rules
+ * they call, names are matched as usual.
+ */
+static int   tokens= 0;		/* the number of tokens, if %token is in effect */
+static Node *compiling= 0;	/* the rule being compiled */
 
-    case Query:
-      {
-	int qko= yyl(), qok= yyl();
-	begin();
-	save(qko);
-	Node_compile_c_ko(node->query.element, qko);
-	jump(qok);
-	label(qko);
-	restore(qko);
-	end();
-	label(qok);
-      }
-      break;
+static int isTokenCall(Node *rule)
+{
+  return tokens && rule->rule.token && !(compiling && compiling->rule.token);
+}
 
-    case Star:
-      {
-	int again= yyl(), out= yyl();
-	label(again);
-	begin();
-	save(out);
-	Node_compile_c_ko(node->star.element, out);
-	jump(again);
-	label(out);
-	restore(out);
-	end();
-      }
-      break;
+/* With %lazy a call to the rule skips a balanced region, which can be
+ * parsed with the rule later on.
+ */
+static int lazies= 0;		/* the number of lazy rules, if %lazy is in effect */
 
-    case Plus:
-      {
-	int again= yyl(), out= yyl();
-	Node_compile_c_ko(node->plus.element, ko);
-	label(again);
-	begin();
-	save(out);
-	Node_compile_c_ko(node->plus.element, out);
-	jump(again);
-	label(out);
-	restore(out);
-	end();
-      }
-      break;
+/* With %structural the characters of the class are indexed in a bitmap
+ * as the input arrives, and a repetition of a single character that
+ * can stop only at one of them jumps from one to the next.
+ */
+static int	     structural= 0;	/* %structural is in effect */
+static unsigned char structuralBits[32];
 
-    default:
-      fprintf(stderr, "\nNode_compile_c_ko: illegal node type %d\n", node->type);
-      exit(1);
-    }
+static int isStructuralLoop(unsigned char bits[32])
+{
+  int i;
+  if (!structural) return 0;
+  for (i= 0;  i < 32;  ++i)
+    if (~bits[i] & ~structuralBits[i] & 0xff)
+      return 0;
+  return 1;
 }
 
-
-static int countVariables(Node *node)
+static int isLazyCall(Node *rule)
 {
-  int count= 0;
-  while (node)
-    {
-      ++count;
-      node= node->variable.next;
-    }
-  return count;
+  return lazies && rule->rule.lazy;
 }
 
-static void defineVariables(Node *node)
+/* The character that node must begin with, if it is that simple. */
+static int firstChar(Node *node)
 {
-  int count= 0;
-  while (node)
+  switch (node->type)
     {
-      fprintf(output, "#define %s yy->_val[%d]\n", node->variable.name, --count);
-      node->variable.offset= count;
-      node= node->variable.next;
+    case Character:
+    case String:
+      {
+	unsigned char *s= (unsigned char *)node->string.value;
+	return cnext(&s);
+      }
+    case Sequence:	return firstChar(node->sequence.first);
+    case Name:
+      {
+	Node *rule= node->name.rule;
+	int   c= 0;
+	if (rule->rule.expression && !(RuleReached & rule->rule.flags))
+	  {
+	    rule->rule.flags |= RuleReached;
+	    c= firstChar(rule->rule.expression);
+	    rule->rule.flags &= ~RuleReached;
+	  }
+	return c;
+      }
+    default:		return 0;
     }
-  fprintf(output, "#define y_ yy->_\n");
-  fprintf(output, "#define yypos yy->_pos\n");
-  fprintf(output, "#define yythunkpos yy->_thunkpos\n");
 }
 
-static void undefineVariables(Node *node)
+/* The brackets that delimit the region matched by a lazy rule. */
+static void Rule_brackets(Node *rule, int *open, int *close)
 {
-  fprintf(output, "#undef yythunkpos\n");
-  fprintf(output, "#undef yypos\n");
-  fprintf(output, "#undef yy\n");
-  while (node)
+  static char *brackets= "()[]{}<>";
+  char *b= 0;
+  int   c= rule->rule.expression ? firstChar(rule->rule.expression) : 0;
+  if (c && (b= strchr(brackets, c)) && !((b - brackets) & 1))
     {
-      fprintf(output, "#undef %s\n", node->variable.name);
-      node= node->variable.next;
+      *open= b[0];
+      *close= b[1];
+      return;
     }
+  fprintf(stderr, "%%lazy rule '%s' does not begin with an opening bracket\n", rule->rule.name);
+  exit(1);
 }
 
+/* Regular parts of the grammar are compiled to scanners: one function
+ * for each that matches directly against the buffer with the position
+ * in a local variable, instead of a call for every character.  A part
+ * is regular if it contains no actions, predicates, variables or cuts
+ * and calls only rules that are themselves regular and not recursive;
+ * those rules are expanded in place.  The scanner keeps the ordered
+ * and possessive choices of the grammar, so it matches exactly what the
+ * code it replaces would have matched.
+ */
+typedef struct Scanner { Node *node;  int count, id; } Scanner;
 
-static void Rule_compile_c2(Node *node)
-{
-  assert(node);
-  assert(Rule == node->type);
+static Scanner *scanners= 0;
+static int	scannerCount= 0;
+static int	scannerMax= 0;
 
-  if (!node->rule.expression)
-    fprintf(stderr, "rule '%s' used but not defined\n", node->rule.name);
-  else
-    {
-      int ko= yyl(), safe;
+static int isRegular(Node *node);
 
-      if ((!(RuleUsed & node->rule.flags)) && (node != start))
-	fprintf(stderr, "rule '%s' defined but not used\n", node->rule.name);
+static int Rule_isRegular(Node *rule)
+{
+  Node *outer= compiling;
+  int   regular;
+  if (RuleRegular   & rule->rule.flags) return 1;
+  if (RuleIrregular & rule->rule.flags) return 0;
+  if (!rule->rule.expression || (RuleReached & rule->rule.flags)) return 0;
+  rule->rule.flags |= RuleReached;
+  compiling= rule;
+  regular= isRegular(rule->rule.expression);
+  compiling= outer;
+  rule->rule.flags &= ~RuleReached;
+  rule->rule.flags |= regular ? RuleRegular : RuleIrregular;
+  return regular;
+}
 
-      safe= ((Query == node->rule.expression->type) || (Star == node->rule.expression->type));
+static int isBeginEnd(Node *node)
+{
+  return !strcmp(node->predicate.text, "YY_BEGIN") || !strcmp(node->predicate.text, "YY_END");
+}
 
-      fprintf(output, "\nYY_RULE(int) yyr%s(yycontext *yy)\n{", node->rule.name);
-      if (!safe) save(0);
-      if (node->rule.variables)
-	fprintf(output, "  yyDo(yy, yyPush, %d, 0);", countVariables(node->rule.variables));
-      fprintf(output, "\n  yyprintf((stderr, \"%%s\\n\", \"%s\"));", node->rule.name);
-      Node_compile_c_ko(node->rule.expression, ko);
-      fprintf(output, "\n  yyprintf((stderr, \"  ok   %%s @ %%s\\n\", \"%s\", yy->_buf+yy->_pos));", node->rule.name);
-      if (node->rule.variables)
-	fprintf(output, "  yyDo(yy, yyPop, %d, 0);", countVariables(node->rule.variables));
-      fprintf(output, "\n  return 1;");
-      if (!safe)
-	{
-	  label(ko);
-	  restore(0);
-	  fprintf(output, "\n  yyprintf((stderr, \"  fail %%s @ %%s\\n\", \"%s\", yy->_buf+yy->_pos));", node->rule.name);
-	  fprintf(output, "\n  return 0;");
+static int isRegular(Node *node)
+{
+  switch (node->type)
+    {
+    case Dot:
+    case Character:
+    case String:
+    case Class:		return 1;
+    case Predicate:	return isBeginEnd(node);
+    case Name:		return !node->name.variable && !isTokenCall(node->name.rule) && !isLazyCall(node->name.rule) && Rule_isRegular(node->name.rule);
+    case Alternate:
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  if (!isRegular(n))
+	    return 0;
+      }
+      return 1;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		return isRegular(node->query.element);
+    default:		return 0;
+    }
+}
+
+static void addScanner(Node *node, int count)
+{
+  if (scannerCount == scannerMax)
+    scanners= realloc(scanners, sizeof(Scanner) * (scannerMax= scannerMax ? 2 * scannerMax : 32));
+  scanners[scannerCount].node=  node;
+  scanners[scannerCount].count= count;
+  scanners[scannerCount].id=    scannerCount;
+  ++scannerCount;
+}
+
+/* Whether a regular node moves the start or end of yytext. */
+static int setsText(Node *node)
+{
+  switch (node->type)
+    {
+    case Predicate:	return 1;
+    case Name:		return setsText(node->name.rule->rule.expression);
+    case Alternate:
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  if (setsText(n))
+	    return 1;
+      }
+      return 0;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		return setsText(node->query.element);
+    default:		return 0;
+    }
+}
+
+/* The scanner for node, or for the run of count elements of a sequence
+ * that starts with node if count is not zero.
+ */
+static Scanner *findScanner(Node *node, int count)
+{
+  int i;
+  for (i= 0;  i < scannerCount;  ++i)
+    if (scanners[i].node == node && !scanners[i].count == !count)
+      return scanners + i;
+  return 0;
+}
+
+static int hasCut(Node *node);
+
+/* Whether node, compiled where no choice point is open, contains a loop
+ * whose head is a point at which -s may discard the buffer.  The last
+ * alternative of a choice and the first pass of a Plus run with the
+ * choice closed; everything else within a choice does not.
+ */
+static int scanStreams(Node *node)
+{
+  switch (node->type)
+    {
+    case Star:
+    case Plus:		return 1;
+    case Name:		return scanStreams(node->name.rule->rule.expression);
+    case Alternate:	return scanStreams(node->alternate.last);
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->sequence.first;  n;  n= n->sequence.next)
+	  if (scanStreams(n))
+	    return 1;
+      }
+      return 0;
+    default:		return 0;
+    }
+}
+
+/* Whether node can become a scanner.  With -s a scanner must not take
+ * in a loop that might run with no choice open, since it would read
+ * the whole of the input that the loop matches into the buffer.  top
+ * is zero if a choice point certainly encloses node within its rule.
+ */
+static int isScannable(Node *node, int top)
+{
+  return isRegular(node) && !(streamFlag && top && scanStreams(node));
+}
+
+/* Find the largest regular parts of node, and runs of two or more
+ * regular elements in its sequences.
+ */
+static void Node_findScanners(Node *node, int top)
+{
+  switch (node->type)
+    {
+    case Alternate:
+    case Sequence:
+      if (isScannable(node, top))
+	addScanner(node, 0);
+      else if (Sequence == node->type)
+	{
+	  Node *n, *m;
+	  int   count;
+	  for (n= node->sequence.first;  n;  n= m)
+	    {
+	      for (count= 0, m= n;  m && isScannable(m, top);  m= m->sequence.next)
+		++count;
+	      if (count > 1)
+		addScanner(n, count);
+	      else
+		{
+		  Node_findScanners(n, top);
+		  m= n->sequence.next;
+		}
+	    }
 	}
-      fprintf(output, "\n}");
+      else
+	{
+	  Node *n;
+	  for (n= node->alternate.first;  n;  n= n->alternate.next)
+	    Node_findScanners(n, top && (!n->alternate.next || hasCut(n)));
+	}
+      break;
+    case Error:
+      Node_findScanners(node->error.element, top);
+      break;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:
+      if (isScannable(node, top))
+	addScanner(node, 0);
+      else
+	Node_findScanners(node->query.element, top && (Plus == node->type || hasCut(node->query.element)));
+      break;
+    default:
+      break;
     }
+}
 
-  if (node->rule.next)
-    Rule_compile_c2(node->rule.next);
+static void scanRecord(void)	{ fprintf(output, "  if (yyp > yym) yym= yyp;"); }
+
+static int scanKo= 0;		/* where the scanner being compiled fails */
+static int scanKoUsed= 0;	/* whether anything in it can fail */
+
+static int scanFail(int ko)
+{
+  if (ko == scanKo) scanKoUsed= 1;
+  return ko;
 }
 
-static char *header= "\
-#include <ctype.h>\n\
-#include <stdio.h>\n\
-#include <stdlib.h>\n\
-#include <string.h>\n\
-#ifdef __cplusplus\n\
-  #include <vector>\n\
-#endif\n\
-";
+/* The set of characters that node matches, if it matches just one. */
+static int scanBits(Node *node, unsigned char bits[32])
+{
+  switch (node->type)
+    {
+    case Dot:
+      memset(bits, 255, 32);
+      return 1;
+    case Character:
+    case String:
+      {
+	unsigned char *s= (unsigned char *)node->string.value;
+	int c= cnext(&s);
+	if (!c || *s) return 0;
+	memset(bits, 0, 32);
+	charClassSet(bits, c);
+	if (String == node->type && node->string.casefold)
+	  charClassSet(bits, toupper(c));
+      }
+      return 1;
+    case Class:
+      makeCharBits(node->cclass.value, bits);
+      return 1;
+    case Sequence:	/* !x . */
+      {
+	Node *peek= node->sequence.first;
+	int   i;
+	if (PeekNot != peek->type || !peek->sequence.next || Dot != peek->sequence.next->type || peek->sequence.next->sequence.next
+	    || !scanBits(peek->peekNot.element, bits))
+	  return 0;
+	for (i= 0;  i < 32;  ++i)
+	  bits[i]= ~bits[i];
+      }
+      return 1;
+    default:
+      return 0;
+    }
+}
 
-static char *preamble= "\
-#ifndef YY_MALLOC\n\
-#define YY_MALLOC(C, N)		malloc(N)\n\
-#endif\n\
-#ifndef YY_REALLOC\n\
-#define YY_REALLOC(C, P, N)	realloc(P, N)\n\
-#endif\n\
-#ifndef YY_FREE\n\
-#define YY_FREE(C, P)		free(P)\n\
-#endif\n\
-#ifndef YY_LOCAL\n\
-#define YY_LOCAL(T)	static T\n\
-#endif\n\
-#ifndef YY_ACTION\n\
-#define YY_ACTION(T)	static T\n\
-#endif\n\
-#ifndef YY_RULE\n\
-#define YY_RULE(T)	static T\n\
-#endif\n\
-#ifndef YY_PARSE\n\
-#define YY_PARSE(T)	T\n\
-#endif\n\
-#ifndef YYPARSE\n\
-#define YYPARSE		yyparse\n\
-#endif\n\
-#ifndef YYPARSEFROM\n\
-#define YYPARSEFROM	yyparsefrom\n\
-#endif\n\
-#ifndef YYRELEASE\n\
-#define YYRELEASE	yyrelease\n\
-#endif\n\
-#ifndef YY_BEGIN\n\
-#define YY_BEGIN	( yy->_begin= yy->_pos, 1)\n\
-#endif\n\
-#ifndef YY_END\n\
-#define YY_END		( yy->_end= yy->_pos, 1)\n\
-#endif\n\
-#ifdef YY_DEBUG\n\
-# define yyprintf(args)	fprintf args\n\
-#else\n\
-# define yyprintf(args)\n\
-#endif\n\
-#ifndef YYSTYPE\n\
-#define YYSTYPE	int\n\
-#endif\n\
-#ifndef YY_STACK_SIZE\n\
-#define YY_STACK_SIZE 128\n\
-#endif\n\
-\n\
-#ifndef YY_BUFFER_SIZE\n\
-#define YY_BUFFER_SIZE 1024\n\
-#endif\n\
-\n\
-#ifndef YY_PART\n\
-\n\
-typedef struct _yycontext yycontext;\n\
-typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);\n\
-typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;\n\
-\n\
-struct _yycontext {\n\
-  char     *_buf;\n\
-  int       _buflen;\n\
-  int       _pos;\n\
-  int       _limit;\n\
-  int       _maxpos;\n\
-  char     *_text;\n\
-  int       _textlen;\n\
-  int       _begin;\n\
-  int       _end;\n\
-  int       _textmax;\n\
-  yythunk  *_thunks;\n\
-  int       _thunkslen;\n\
-  int       _thunkpos;\n\
-  YYSTYPE   _;\n\
-  YYSTYPE  *_val;\n\
-#ifdef __cplusplus\n\
-  std::vector<YYSTYPE>* _vals;\n\
-#else\n\
-  YYSTYPE  *_vals;\n\
-  int       _valslen;\n\
-#endif\n\
-#ifdef YY_CTX_MEMBERS\n\
-  YY_CTX_MEMBERS\n\
-#endif\n\
-};\n\
-\n\
-#ifdef YY_CTX_LOCAL\n\
-#define YY_CTX_PARAM_	yycontext *yyctx,\n\
-#define YY_CTX_PARAM	yycontext *yyctx\n\
-#define YY_CTX_ARG_	yyctx,\n\
-#define YY_CTX_ARG	yyctx\n\
-#ifndef YY_INPUT\n\
-#define YY_INPUT(yy, buf, result, max_size)		\\\n\
-  {							\\\n\
-    int yyc= getchar();					\\\n\
-    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\\\n\
-    yyprintf((stderr, \"<%c>\", yyc));			\\\n\
-  }\n\
-#endif\n\
-#else\n\
-#define YY_CTX_PARAM_\n\
-#define YY_CTX_PARAM\n\
-#define YY_CTX_ARG_\n\
-#define YY_CTX_ARG\n\
-yycontext yyctx_= { 0, 0 };\n\
-yycontext *yyctx= &yyctx_;\n\
-#ifndef YY_INPUT\n\
-#define YY_INPUT(buf, result, max_size)			\\\n\
-  {							\\\n\
-    int yyc= getchar();					\\\n\
-    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\\\n\
-    yyprintf((stderr, \"<%c>\", yyc));			\\\n\
-  }\n\
-#endif\n\
-#endif\n\
-\n\
-YY_LOCAL(int) yyrefill(yycontext *yy)\n\
-{\n\
-  int yyn;\n\
-  while (yy->_buflen - yy->_pos < 512)\n\
-    {\n\
-      yy->_buflen *= 2;\n\
-      yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);\n\
-    }\n\
-#ifdef YY_CTX_LOCAL\n\
-  YY_INPUT(yy, (yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));\n\
-#else\n\
-  YY_INPUT((yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));\n\
-#endif\n\
-  if (!yyn) return 0;\n\
-  yy->_limit += yyn;\n\
-  return 1;\n\
+/* The test for one character at yyp, or 0 if node matches more than one. */
+static int scanTest(Node *node, char *test)
+{
+  unsigned char bits[32];
+  switch (node->type)
+    {
+    case Dot:
+      strcpy(test, "1");
+      return 1;
+    case Character:
+    case String:
+      {
+	unsigned char *s= (unsigned char *)node->string.value;
+	int c= cnext(&s);
+	if (!c || *s) return 0;
+	if (String == node->type && node->string.casefold)
+	  sprintf(test, "tolower(yyByte(yy, yyp)) == %d", c);
+	else
+	  sprintf(test, "yyByte(yy, yyp) == %d", c);
+      }
+      return 1;
+    default:
+      if (!scanBits(node, bits))
+	return 0;
+      sprintf(test, "yyInClass((const unsigned char *)\"%s\", yyByte(yy, yyp))", formatCharBits(bits));
+      return 1;
+    }
+}
+
+static void Node_compile_scan(Node *node, int ko)
+{
+  char test[1024];
+  switch (node->type)
+    {
+    case Dot:
+    case Class:
+      scanTest(node, test);
+      fprintf(output, "\n  yyStep(yy);  if (!yyAvail(yy, yyp) || !(%s)) goto l%d;  ++yyp;", test, scanFail(ko));
+      scanRecord();
+      break;
+
+    case Character:
+    case String:
+      {
+	unsigned char *s= (unsigned char *)node->string.value;
+	int c, fold= String == node->type && node->string.casefold;
+	fprintf(output, "\n  yyStep(yy);");
+	while ((c= cnext(&s)))
+	  fprintf(output, "\n  if (!yyAvail(yy, yyp) || %s != %d) goto l%d;  ++yyp;", fold ? "tolower(yyByte(yy, yyp))" : "yyByte(yy, yyp)", c, scanFail(ko));
+	scanRecord();
+      }
+      break;
+
+    case Predicate:
+      fprintf(output, "\n  yy->_pos= yyp;  if (!(%s)) goto l%d;", node->predicate.text, scanFail(ko));
+      break;
+
+    case Name:
+      Node_compile_scan(node->name.rule->rule.expression, ko);
+      break;
+
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	Node_compile_scan(node, ko);
+      break;
+
+    case Alternate:
+      {
+	int ok= yyl(), q= yyl();
+	fprintf(output, "\n  { int yyq%d= yyp;", q);
+	for (node= node->alternate.first;  node;  node= node->alternate.next)
+	  if (node->alternate.next)
+	    {
+	      int next= yyl();
+	      Node_compile_scan(node, next);
+	      jump(ok);
+	      label(next);
+	      fprintf(output, "  yyp= yyq%d;", q);
+	    }
+	  else
+	    Node_compile_scan(node, ko);
+	label(ok);
+	fprintf(output, "  }");
+      }
+      break;
+
+    case PeekFor:
+      {
+	int q= yyl();
+	fprintf(output, "\n  { int yyq%d= yyp;", q);
+	Node_compile_scan(node->peekFor.element, ko);
+	fprintf(output, "  yyp= yyq%d;  }", q);
+      }
+      break;
+
+    case PeekNot:
+      {
+	int ok= yyl();
+	fprintf(output, "\n  { int yyq%d= yyp, yym%d= yym;", ok, ok);
+	Node_compile_scan(node->peekNot.element, ok);
+	fprintf(output, "  yym= yym%d;", ok);
+	jump(scanFail(ko));
+	label(ok);
+	fprintf(output, "  yyp= yyq%d;  yym= yym%d;  }", ok, ok);
+      }
+      break;
+
+    case Query:
+      {
+	int qko= yyl(), qok= yyl();
+	fprintf(output, "\n  { int yyq%d= yyp;", qko);
+	Node_compile_scan(node->query.element, qko);
+	jump(qok);
+	label(qko);
+	fprintf(output, "  yyp= yyq%d;", qko);
+	label(qok);
+	fprintf(output, "  }");
+      }
+      break;
+
+    case Star:
+    case Plus:
+      if (scanTest(node->star.element, test))
+	{
+	  if (Plus == node->type)
+	    fprintf(output, "\n  yyStep(yy);  if (!yyAvail(yy, yyp) || !(%s)) goto l%d;  ++yyp;", test, scanFail(ko));
+	  unsigned char bits[32];
+	  fprintf(output, "\n  for (;;) { yyPoll(yy);  yyStep(yy);  %sif (!yyAvail(yy, yyp) || !(%s)) break;  ++yyp; }",
+		  scanBits(node->star.element, bits) && isStructuralLoop(bits) ? "yyp= yyStructural(yy, yyp);  " : "", test);
+	  scanRecord();
+	}
+      else
+	{
+	  int again= yyl(), out= yyl();
+	  if (Plus == node->type)
+	    Node_compile_scan(node->plus.element, ko);
+	  fprintf(output, "\n  { int yyq%d;", out);
+	  label(again);
+	  poll();
+	  fprintf(output, "  yyq%d= yyp;", out);
+	  Node_compile_scan(node->star.element, out);
+	  jump(again);
+	  label(out);
+	  fprintf(output, "  yyp= yyq%d;  }", out);
+	}
+      break;
+
+    default:
+      fprintf(stderr, "\nNode_compile_scan: illegal node type %d\n", node->type);
+      exit(1);
+    }
+}
+
+static void Scanner_compile(Scanner *scanner)
+{
+  Node *node= scanner->node;
+  int   ko= yyl(), i;
+
+  fprintf(output, "\n\nYY_LOCAL(int) yyscan%d(yycontext *yy)\n{", scanner->id);
+  fprintf(output, "\n  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;");
+  scanKo= ko;
+  scanKoUsed= 0;
+  if (scanner->count)
+    for (i= 0;  i < scanner->count;  ++i, node= node->sequence.next)
+      Node_compile_scan(node, ko);
+  else
+    Node_compile_scan(node, ko);
+  fprintf(output, "\n  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;");
+  if (scanKoUsed)
+    {
+      label(ko);
+      fprintf(output, "  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;");
+    }
+  fprintf(output, "\n}");
+}
+
+static void Rule_compile_scanners(Node *node)
+{
+  Node *n;
+  int   i;
+
+  scannerCount= 0;
+  for (n= node;  n;  n= n->rule.next)
+    if (n->rule.expression)
+      {
+	compiling= n;
+	Node_findScanners(n->rule.expression, 1);
+      }
+  compiling= 0;
+  for (i= 0;  i < scannerCount;  ++i)
+    Scanner_compile(scanners + i);
+  if (scannerCount)
+    fprintf(output, "\n");
+}
+
+static int cutKo= 0;		/* where failures go after a cut in the current scope */
+static int cutChoice= 0;	/* the current scope has a counted choice point */
+static int cutSeen= 0;		/* a cut has been compiled in the current scope */
+
+static void Node_compile_c_ko(Node *node, int ko);
+static int  valueType(char *type);
+
+/* Compile node as the body of a construct that a cut commits to: after
+ * a cut, failures go to label cut instead of ko.  Returns non-zero if
+ * the body contains a cut.
+ */
+static int Node_compile_c_scope(Node *node, int ko, int cut, int counted)
+{
+  int ko0= cutKo, choice0= cutChoice, seen;
+  cutKo= cut;
+  cutChoice= counted;
+  cutSeen= 0;
+  Node_compile_c_ko(node, ko);
+  seen= cutSeen;
+  cutKo= ko0;
+  cutChoice= choice0;
+  cutSeen= 0;
+  return seen;
+}
+
+static int hasCut(Node *node)
+{
+  switch (node->type)
+    {
+    case Cut:		return 1;
+    case Error:		return hasCut(node->error.element);
+    case Alternate:
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  if (hasCut(n))
+	    return 1;
+      }
+      return 0;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		return hasCut(node->query.element);
+    default:		return 0;
+    }
+}
+
+static void Node_compile_c_ko(Node *node, int ko)
+{
+  Scanner *scanner;
+  assert(node);
+  if ((scanner= findScanner(node, 0)))
+    {
+      if (Query == node->type || Star == node->type)
+	fprintf(output, "  yyscan%d(yy);", scanner->id);
+      else
+	fprintf(output, "  if (!yyscan%d(yy)) goto l%d;", scanner->id, fail(ko));
+      return;
+    }
+  switch (node->type)
+    {
+    case Rule:
+      fprintf(stderr, "\ninternal error #1 (%s)\n", node->rule.name);
+      exit(1);
+      break;
+
+    case Dot:
+      fprintf(output, "  if (!yymatchDot(yy)) goto l%d;", fail(ko));
+      break;
+
+    case Name:
+      if (isLazyCall(node->name.rule))
+	{
+	  int open, close;
+	  Rule_brackets(node->name.rule, &open, &close);
+	  fprintf(output, "  if (!yyskipLazy(yy, %d, %d, %d)) goto l%d;", node->name.rule->rule.lazy, open, close, fail(ko));
+	}
+      else if (isTokenCall(node->name.rule))
+	{
+	  if (Rule_isRegular(node->name.rule) && !setsText(node->name.rule->rule.expression))
+	    fprintf(output, "  if (!yyskipToken(yy, %d)) goto l%d;", node->name.rule->rule.token, fail(ko));
+	  else
+	    fprintf(output, "  if (!yymatchToken(yy, %d, yyr%s)) goto l%d;", node->name.rule->rule.token, node->name.rule->rule.name, fail(ko));
+	}
+      else
+	call(node->name.rule, ko);
+      if (node->name.variable)
+	fprintf(output, "  yyDo(yy, yyThunkSet, %d, %d);", node->name.variable->variable.offset, cppFlag ? valueType(node->name.variable->variable.valueType) : 0);
+      break;
+
+    case Character:
+    case String:
+      {
+	int len= strlen(node->string.value);
+	if (String == node->type && node->string.casefold)
+	  {
+    	    fprintf(output, "  if (!yymatchIString(yy, \"%s\")) goto l%d;", node->string.value, fail(ko));
+	  } 
+	else if (1 == len)
+	  {
+	    if ('\'' == node->string.value[0])
+	      fprintf(output, "  if (!yymatchChar(yy, '\\'')) goto l%d;", fail(ko));
+	    else
+	      fprintf(output, "  if (!yymatchChar(yy, '%s')) goto l%d;", node->string.value, fail(ko));
+	  }
+	else
+	  if (2 == len && '\\' == node->string.value[0])
+	    fprintf(output, "  if (!yymatchChar(yy, '%s')) goto l%d;", node->string.value, fail(ko));
+	  else
+	    fprintf(output, "  if (!yymatchString(yy, \"%s\")) goto l%d;", node->string.value, fail(ko));
+      }
+      break;
+
+    case Class:
+      fprintf(output, "  if (!yymatchClass(yy, (unsigned char *)\"%s\")) goto l%d;", makeCharClass(node->cclass.value), fail(ko));
+      break;
+
+    case Action:
+      fprintf(output, "  yyDo(yy, yy%s, yy->_begin, yy->_end);", node->action.name);
+      if (node->action.eager)
+	fprintf(output, "  yyDone(yy);");
+      break;
+
+    case Inline:
+      fprintf(output, "  yyText(yy, yy->_begin, yy->_end);\n");
+      fprintf(output, "#define yytext yy->_text\n");
+      fprintf(output, "#define yyleng yy->_textlen\n");
+      fprintf(output, "%s;\n", node->inLine.text);
+      fprintf(output, "#undef yytext\n");
+      fprintf(output, "#undef yyleng\n");
+      break;
+
+    case Predicate:
+      fprintf(output, "  yyText(yy, yy->_begin, yy->_end);  {\n");
+      fprintf(output, "#define yytext yy->_text\n");
+      fprintf(output, "#define yyleng yy->_textlen\n");
+      fprintf(output, "if (!(%s)) goto l%d;\n", node->predicate.text, fail(ko));
+      fprintf(output, "#undef yytext\n");
+      fprintf(output, "#undef yyleng\n");
+      fprintf(output, "  }");
+      break;
+
+    case Error:
+      {
+	int eok= yyl(), eko= yyl();
+	Node_compile_c_scope(node->error.element, eko, eko, 0);
+	jump(eok);
+	label(eko);
+	fprintf(output, "  yyText(yy, yy->_begin, yy->_end);  {\n");
+	fprintf(output, "#define yytext yy->_text\n");
+	fprintf(output, "#define yyleng yy->_textlen\n");
+	fprintf(output, "  %s;\n", node->error.text);
+	fprintf(output, "#undef yytext\n");
+	fprintf(output, "#undef yyleng\n");
+	fprintf(output, "  }");
+	jump(ko);
+	label(eok);
+      }
+      break;
+
+    case Alternate:
+      {
+	int ok= yyl();
+	begin();
+	save(ok);
+	choice();
+	for (node= node->alternate.first;  node;  node= node->alternate.next)
+	  if (node->alternate.next)
+	    {
+	      int next= yyl();
+	      if (!Node_compile_c_scope(node, next, ko, 1))
+		unchoice();
+	      jump(ok);
+	      label(next);
+	      restore(ok);
+	    }
+	  else
+	    {
+	      unchoice();
+	      Node_compile_c_scope(node, ko, ko, 0);
+	    }
+	end();
+	label(ok);
+      }
+      break;
+
+    case Sequence:
+      {
+	int cut= 0;
+	for (node= node->sequence.first;  node;  node= node->sequence.next)
+	  {
+	    if ((scanner= findScanner(node, 1)))
+	      {
+		int count;
+		fprintf(output, "  if (!yyscan%d(yy)) goto l%d;", scanner->id, fail(ko));
+		for (count= scanner->count;  --count;  node= node->sequence.next);
+		continue;
+	      }
+	    cutSeen= 0;
+	    Node_compile_c_ko(node, ko);
+	    if (cutSeen)
+	      {
+		ko= cutKo;
+		cut= 1;
+	      }
+	  }
+	cutSeen= cut;
+      }
+      break;
+
+    case Cut:
+      if (cutChoice)
+	{
+	  unchoice();
+	  cutChoice= 0;
+	}
+      stream();
+      cutSeen= 1;
+      break;
+
+    case PeekFor:
+      {
+	int ok= yyl();
+	begin();
+	save(ok);
+	if (streamFlag)
+	  {
+	    int pko= yyl(), pok= yyl();
+	    choice();
+	    Node_compile_c_scope(node->peekFor.element, pko, pko, 0);
+	    unchoice();
+	    jump(pok);
+	    label(pko);
+	    unchoice();
+	    jump(ko);
+	    label(pok);
+	  }
+	else
+	  Node_compile_c_scope(node->peekFor.element, ko, ko, 0);
+	restore(ok);
+	end();
+      }
+      break;
+
+    case PeekNot:
+      {
+	int ok= yyl();
+	begin();
+	save(ok);
+	saveMaxPos(ok);
+	choice();
+	Node_compile_c_scope(node->peekNot.element, ok, ok, 0);
+	unchoice();
+	restoreMaxPos(ok);
+	jump(ko);
+	label(ok);
+	restore(ok);
+	restoreMaxPos(ok);
+	unchoice();
+	end();
+      }
+      break;
+
+    case Query:
+      {
+	int qko= yyl(), qok= yyl();
+	begin();
+	save(qko);
+	choice();
+	if (!Node_compile_c_scope(node->query.element, qko, ko, 1))
+	  unchoice();
+	jump(qok);
+	label(qko);
+	restore(qko);
+	unchoice();
+	end();
+	label(qok);
+      }
+      break;
+
+    case Star:
+      {
+	int again= yyl(), out= yyl();
+	label(again);
+	stream();
+	poll();
+	begin();
+	save(out);
+	choice();
+	if (!Node_compile_c_scope(node->star.element, out, ko, 1))
+	  unchoice();
+	jump(again);
+	label(out);
+	restore(out);
+	unchoice();
+	end();
+      }
+      break;
+
+    case Plus:
+      {
+	int again= yyl(), out= yyl();
+	Node_compile_c_scope(node->plus.element, ko, ko, 0);
+	label(again);
+	stream();
+	poll();
+	begin();
+	save(out);
+	choice();
+	if (!Node_compile_c_scope(node->plus.element, out, ko, 1))
+	  unchoice();
+	jump(again);
+	label(out);
+	restore(out);
+	unchoice();
+	end();
+      }
+      break;
+
+    default:
+      fprintf(stderr, "\nNode_compile_c_ko: illegal node type %d\n", node->type);
+      exit(1);
+    }
+}
+
+
+/* With -C each semantic value type has its own stack in the parser.
+ * Type 0 is YYSTYPE, the type of every rule without a %type.
+ */
+static char **valueTypes= 0;
+static int    valueTypeCount= 0;
+
+static int valueType(char *type)
+{
+  int i;
+  if (!type) type= "YYSTYPE";
+  for (i= 0;  i < valueTypeCount;  ++i)
+    if (!strcmp(type, valueTypes[i]))
+      return i;
+  valueTypes= (char **)realloc(valueTypes, sizeof(char *) * (valueTypeCount + 1));
+  valueTypes[valueTypeCount]= type;
+  return valueTypeCount++;
+}
+
+static void Node_typeVariables(Node *node)
+{
+  switch (node->type)
+    {
+    case Name:
+      if (node->name.variable)
+	{
+	  Node *variable= node->name.variable;
+	  char *type= node->name.rule->rule.valueType;
+	  if (variable->variable.offset && valueType(variable->variable.valueType) != valueType(type))
+	    {
+	      fprintf(stderr, "variable '%s' is bound to values of types %s and %s\n", variable->variable.name,
+		      valueTypes[valueType(variable->variable.valueType)], valueTypes[valueType(type)]);
+	      exit(1);
+	    }
+	  variable->variable.valueType= type;
+	  variable->variable.offset= 1;
+	}
+      break;
+
+    case Alternate:
+      for (node= node->alternate.first;  node;  node= node->alternate.next)
+	Node_typeVariables(node);
+      break;
+
+    case Sequence:
+      for (node= node->sequence.first;  node;  node= node->sequence.next)
+	Node_typeVariables(node);
+      break;
+
+    case Error:		Node_typeVariables(node->error.element);	break;
+    case PeekFor:	Node_typeVariables(node->peekFor.element);	break;
+    case PeekNot:	Node_typeVariables(node->peekNot.element);	break;
+    case Query:		Node_typeVariables(node->query.element);	break;
+    case Star:		Node_typeVariables(node->star.element);		break;
+    case Plus:		Node_typeVariables(node->plus.element);		break;
+    }
+}
+
+/* Give each variable the type of the rules it is bound to and an offset
+ * within the frame its rule pushes on the stack for that type.
+ */
+static void Rule_typeVariables(Node *rule)
+{
+  Node *n, *v;
+  int  *counts;
+
+  valueTypeCount= 0;
+  valueType(0);
+  for (n= rule;  n;  n= n->rule.next)
+    {
+      valueType(n->rule.valueType);
+      for (v= n->rule.variables;  v;  v= v->variable.next)
+	v->variable.offset= 0;
+      if (n->rule.expression)
+	Node_typeVariables(n->rule.expression);
+    }
+  counts= (int *)malloc(sizeof(int) * valueTypeCount);
+  for (n= rule;  n;  n= n->rule.next)
+    {
+      memset(counts, 0, sizeof(int) * valueTypeCount);
+      for (v= n->rule.variables;  v;  v= v->variable.next)
+	v->variable.offset= --counts[valueType(v->variable.valueType)];
+    }
+  free(counts);
+}
+
+static int countVariables(Node *node, int type)
+{
+  int count= 0;
+  while (node)
+    {
+      if (!cppFlag || type == valueType(node->variable.valueType))
+	++count;
+      node= node->variable.next;
+    }
+  return count;
+}
+
+static void Rule_compile_frame(Node *rule, char *thunk)
+{
+  int type, count;
+  for (type= 0;  type < (cppFlag ? valueTypeCount : 1);  ++type)
+    if ((count= countVariables(rule->rule.variables, type)))
+      fprintf(output, "  yyDo(yy, %s, %d, %d);", thunk, count, type);
+}
+
+static void defineVariables(Node *rule)
+{
+  Node *node;
+  int	count= 0;
+  for (node= rule->rule.variables;  node;  node= node->variable.next)
+    if (cppFlag)
+      {
+	int type= valueType(node->variable.valueType);
+	fprintf(output, "#define %s yy->_vals%d[yy->_val%d + %d]\n", node->variable.name, type, type, node->variable.offset);
+      }
+    else
+      {
+	fprintf(output, "#define %s yy->_val[%d]\n", node->variable.name, --count);
+	node->variable.offset= count;
+      }
+  if (cppFlag)
+    fprintf(output, "#define y_ yy->_%d\n", valueType(rule->rule.valueType));
+  else
+    fprintf(output, "#define y_ yy->_\n");
+  fprintf(output, "#define yypos yy->_pos\n");
+  fprintf(output, "#define yythunkpos yy->_thunkpos\n");
+}
+
+static void undefineVariables(Node *rule)
+{
+  Node *node;
+  fprintf(output, "#undef yythunkpos\n");
+  fprintf(output, "#undef yypos\n");
+  fprintf(output, "#undef y_\n");
+  for (node= rule->rule.variables;  node;  node= node->variable.next)
+    fprintf(output, "#undef %s\n", node->variable.name);
+}
+
+
+static FILE *ruleBody= 0;
+
+static void Rule_compile_c2(Node *node)
+{
+  assert(node);
+  assert(Rule == node->type);
+
+  if (!node->rule.expression)
+    fprintf(stderr, "rule '%s' used but not defined\n", node->rule.name);
+  else
+    {
+      FILE *out;
+      long  length;
+      int   ko= yyl(), safe;
+
+      if ((!(RuleUsed & node->rule.flags)) && (node != start))
+	fprintf(stderr, "rule '%s' defined but not used\n", node->rule.name);
+
+      safe= ((Query == node->rule.expression->type) || (Star == node->rule.expression->type)) && !hasCut(node->rule.expression);
+      compiling= node;
+
+      if (gotoFlag)
+	{
+	  frameCount= 0;
+	  frameSize= 2;
+	  frameSlot(0, 2);	/* yythunkpos0 is always yyF(3) */
+	  fprintf(output, "\n\n yy_%s:;  yyPushFrame(yyframe_%s);", node->rule.name, node->rule.name);
+	  if (safe) fprintf(output, "  yyF(3)= yy->_thunkpos;");
+	}
+      else	/* scanners expand regular rules in place, so they may never be called; -C class members never warn */
+	fprintf(output, "\nYY_RULE(int) %syyr%s(yycontext *yy)\n{", (RuleRegular & node->rule.flags) && !cppFlag ? "YY_UNUSED " : "", node->rule.name);
+      out= output;		/* the body goes first to ruleBody, to learn whether it can fail */
+      if (!ruleBody && !(ruleBody= tmpfile()))
+	{
+	  perror("tmpfile");
+	  exit(1);
+	}
+      rewind(ruleBody);
+      output= ruleBody;
+      Rule_compile_frame(node, "yyThunkPush");
+      fprintf(output, "\n  yyEnter(yy);");
+      if (events) fprintf(output, "  yyEventEnter(yy, %d);", node->rule.id);
+      fprintf(output, "  yyprintf((stderr, \"%%s\\n\", \"%s\"));", node->rule.name);
+      ruleKo= ko;
+      ruleKoUsed= 0;
+      Node_compile_c_scope(node->rule.expression, ko, ko, 0);
+      fprintf(output, "\n  yyprintf((stderr, \"  ok   %%s @ %%s\\n\", \"%s\", yy->_buf+yy->_pos));", node->rule.name);
+      Rule_compile_frame(node, "yyThunkPop");
+      fprintf(output, "\n  ");
+      if (events) fprintf(output, "yyEventLeave(yy, %d);  ", node->rule.id);
+      fprintf(output, "yyLeave(yy);");
+      ret(1);
+      length= ftell(ruleBody);
+      output= out;
+      if (!safe && (ruleKoUsed || gotoFlag))	/* -g keeps yythunkpos0 in the frame all the same */
+	save(0);
+      rewind(ruleBody);
+      while (length-- > 0)
+	putc(getc(ruleBody), output);
+      if (!safe && ruleKoUsed)			/* else nothing in it fails, and there is nothing to restore */
+	{
+	  label(ko);
+	  restore(0);
+	  fprintf(output, "\n  yyprintf((stderr, \"  fail %%s @ %%s\\n\", \"%s\", yy->_buf+yy->_pos));", node->rule.name);
+	  fprintf(output, "\n  yyLeave(yy);");
+	  ret(0);
+	}
+      if (gotoFlag)
+	node->rule.frame= frameSize;
+      else
+	fprintf(output, "\n}");
+    }
+
+  if (node->rule.next)
+    Rule_compile_c2(node->rule.next);
+}
+
+static char *header= "\
+#include <ctype.h>\n\
+#include <stdio.h>\n\
+#include <stdlib.h>\n\
+#include <string.h>\n\
+#ifdef __cplusplus\n\
+  #include <vector>\n\
+#endif\n\
+";
+
+static char *preamble= "\
+#ifndef YY_MALLOC\n\
+#define YY_MALLOC(C, N)		malloc(N)\n\
+#endif\n\
+#ifndef YY_REALLOC\n\
+#define YY_REALLOC(C, P, N)	realloc(P, N)\n\
+#endif\n\
+#ifndef YY_FREE\n\
+#define YY_FREE(C, P)		free(P)\n\
+#endif\n\
+#ifndef YY_LOCAL\n\
+#define YY_LOCAL(T)	static T\n\
+#endif\n\
+#ifndef YY_ACTION\n\
+#define YY_ACTION(T)	static T\n\
+#endif\n\
+#ifndef YY_RULE\n\
+#define YY_RULE(T)	static T\n\
+#endif\n\
+#ifndef YY_PARSE\n\
+#define YY_PARSE(T)	T\n\
+#endif\n\
+#ifndef YY_UNUSED\n\
+# ifdef __GNUC__\n\
+#  define YY_UNUSED	__attribute__((unused))\n\
+# else\n\
+#  define YY_UNUSED\n\
+# endif\n\
+#endif\n\
+#ifndef YYPARSE\n\
+#define YYPARSE		yyparse\n\
+#endif\n\
+#ifndef YYPARSEFROM\n\
+#define YYPARSEFROM	yyparsefrom\n\
+#endif\n\
+#ifndef YYRELEASE\n\
+#define YYRELEASE	yyrelease\n\
+#endif\n\
+#ifndef YYRESET\n\
+#define YYRESET		yyreset\n\
+#endif\n\
+#if defined(YY_LAZY) && !defined(YYPARSESPAN)\n\
+#define YYPARSESPAN	yyparsespan\n\
+#endif\n\
+#ifndef YY_BEGIN\n\
+#define YY_BEGIN	( yy->_begin= yy->_pos, 1)\n\
+#endif\n\
+#ifndef YY_END\n\
+#define YY_END		( yy->_end= yy->_pos, 1)\n\
+#endif\n\
+#ifdef YY_DEBUG\n\
+# define yyprintf(args)	fprintf args\n\
+#else\n\
+# define yyprintf(args)\n\
+#endif\n\
+#ifndef YYSTYPE\n\
+#define YYSTYPE	int\n\
+#endif\n\
+#ifndef YY_STACK_SIZE\n\
+#define YY_STACK_SIZE 128\n\
+#endif\n\
+\n\
+#ifndef YY_BUFFER_SIZE\n\
+#define YY_BUFFER_SIZE 1024\n\
+#endif\n\
+\n\
+#if defined(YY_PUSH) || defined(YY_QUOTA)\n\
+#define YY_COROUTINE\n\
+#if defined(__has_include)\n\
+#if !__has_include(<ucontext.h>)\n\
+#error \"YY_PUSH needs ucontext, which this platform does not provide\"\n\
+#endif\n\
+#elif defined(_WIN32)\n\
+#error \"YY_PUSH needs ucontext, which this platform does not provide\"\n\
+#endif\n\
+#include <stdint.h>\n\
+#include <ucontext.h>\n\
+#include <unistd.h>\n\
+#include <sys/mman.h>\n\
+#if !defined(YY_COROUTINE_STACK_SIZE) && defined(YY_PUSH_STACK_SIZE)\n\
+#define YY_COROUTINE_STACK_SIZE YY_PUSH_STACK_SIZE\n\
+#endif\n\
+#ifndef YY_COROUTINE_STACK_SIZE\n\
+#define YY_COROUTINE_STACK_SIZE (256 * 1024)\n\
+#endif\n\
+enum { YYPARSE_NEED_MORE= 0, YYPARSE_ACCEPT, YYPARSE_REJECT, YYPARSE_YIELD };\n\
+#define YYPUSH_NEED_MORE	YYPARSE_NEED_MORE	/* the names used before YY_QUOTA */\n\
+#define YYPUSH_ACCEPT		YYPARSE_ACCEPT\n\
+#define YYPUSH_REJECT		YYPARSE_REJECT\n\
+#endif\n\
+#ifdef YY_PUSH\n\
+#ifndef YYPUSH\n\
+#define YYPUSH		yypush\n\
+#endif\n\
+#endif\n\
+#ifdef YY_QUOTA\n\
+#ifndef YYPARSEQUOTA\n\
+#define YYPARSEQUOTA	yyparsequota\n\
+#endif\n\
+#endif\n\
+#ifdef YY_STRUCTURAL\n\
+#include <stdint.h>\n\
+#endif\n\
+#ifdef YY_READAHEAD\n\
+#include <errno.h>\n\
+#include <poll.h>\n\
+#include <pthread.h>\n\
+#include <unistd.h>\n\
+#include <sys/stat.h>\n\
+#ifndef YYREADAHEAD\n\
+#define YYREADAHEAD	yyreadahead\n\
+#endif\n\
+#ifndef YY_READAHEAD_BUFFERS\n\
+#define YY_READAHEAD_BUFFERS	4\n\
+#endif\n\
+#ifndef YY_READAHEAD_SIZE\n\
+#define YY_READAHEAD_SIZE	65536\n\
+#endif\n\
+#if defined(__linux__) && defined(__has_include) && !defined(YY_READAHEAD_THREAD)\n\
+#if __has_include(<linux/io_uring.h>)\n\
+#define YY_URING\n\
+#include <stdint.h>\n\
+#include <linux/io_uring.h>\n\
+#include <sys/mman.h>\n\
+#include <sys/syscall.h>\n\
+long syscall(long number, ...);	/* <unistd.h> declares it only for _DEFAULT_SOURCE */\n\
+#endif\n\
+#endif\n\
+struct _yyahead;\n\
+#endif\n\
+#ifdef YY_SEGMENTS_NOCOPY\n\
+#define YY_SEGMENTS\n\
+#endif\n\
+#ifdef YY_SEGMENTS\n\
+#include <sys/uio.h>\n\
+#ifndef YYSEGMENTS\n\
+#define YYSEGMENTS	yysegments\n\
+#endif\n\
+#endif\n\
+#if defined(YY_PARALLEL) || defined(YY_BATCH) || defined(YY_POOL)\n\
+#ifndef YY_CTX_LOCAL\n\
+#error \"YY_PARALLEL, YY_BATCH and YY_POOL require YY_CTX_LOCAL\"\n\
+#endif\n\
+#include <pthread.h>\n\
+#include <unistd.h>\n\
+#endif\n\
+#ifdef YY_PARALLEL\n\
+#ifndef YYPARSEPARALLEL\n\
+#define YYPARSEPARALLEL	yyparseparallel\n\
+#endif\n\
+#ifndef YY_PARALLEL_SEPARATOR\n\
+#define YY_PARALLEL_SEPARATOR	'\\n'\n\
+#endif\n\
+#ifndef YY_PARALLEL_SYNC\n\
+#define YY_PARALLEL_SYNC(text, len, pos)	yySync(text, len, pos, YY_PARALLEL_SEPARATOR)\n\
+#endif\n\
+#ifndef YY_PARALLEL_INIT\n\
+#define YY_PARALLEL_INIT(chunk, yyctx)\n\
+#endif\n\
+#ifndef YY_PARALLEL_CHUNKS\n\
+#define YY_PARALLEL_CHUNKS	4\n\
+#endif\n\
+#ifndef YY_PARALLEL_MIN_CHUNK\n\
+#define YY_PARALLEL_MIN_CHUNK	65536\n\
+#endif\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+#include <sched.h>\n\
+#ifdef __linux__\n\
+#define YY_EVENT_FUTEX\n\
+#include <linux/futex.h>\n\
+#include <sys/syscall.h>\n\
+long syscall(long number, ...);\n\
+#endif\n\
+#ifndef YYNEXTEVENT\n\
+#define YYNEXTEVENT	yynextevent\n\
+#endif\n\
+#ifndef YY_EVENT_RING\n\
+#define YY_EVENT_RING	1024\n\
+#endif\n\
+#if (YY_EVENT_RING) < 1 || ((YY_EVENT_RING) & ((YY_EVENT_RING) - 1))\n\
+#error \"YY_EVENT_RING must be a power of two\"\n\
+#endif\n\
+#ifndef __GNUC__\n\
+#error \"YY_EVENTS needs the __atomic builtins of GCC or Clang\"\n\
+#endif\n\
+#define YY_EVENT_ENTER	0xfffe\n\
+#define YY_EVENT_LEAVE	0xffff\n\
+enum { YYEVENT_ENTER= 1, YYEVENT_LEAVE, YYEVENT_CAPTURE, YYEVENT_END, YYEVENT_UNPIN };\n\
+#define yyEventEnter(yy, rule)	yyDo(yy, YY_EVENT_ENTER, yy->_pos, rule)\n\
+#define yyEventLeave(yy, rule)	yyDo(yy, YY_EVENT_LEAVE, yy->_pos, rule)\n\
+#else\n\
+#define yyEventEnter(yy, rule)\n\
+#define yyEventLeave(yy, rule)\n\
+#endif\n\
+#ifdef YY_RECORDS\n\
+#include <time.h>\n\
+#ifndef YYPARSERECORDS\n\
+#define YYPARSERECORDS	yyparserecords\n\
+#endif\n\
+#ifndef YYRECORDRATE\n\
+#define YYRECORDRATE	yyrecordrate\n\
+#endif\n\
+#ifndef YY_RECORD_SEPARATOR\n\
+#define YY_RECORD_SEPARATOR	'\\n'\n\
+#endif\n\
+#endif\n\
+#ifdef YY_BATCH\n\
+#ifndef YYPARSEBATCH\n\
+#define YYPARSEBATCH	yyparsebatch\n\
+#endif\n\
+#ifndef YY_BATCH_INIT\n\
+#define YY_BATCH_INIT(worker, yyctx)\n\
+#endif\n\
+#endif\n\
+#ifdef YY_POOL\n\
+#include <stdint.h>\n\
+#ifndef YYPOOLCREATE\n\
+#define YYPOOLCREATE	yypoolcreate\n\
+#endif\n\
+#ifndef YYPOOLACQUIRE\n\
+#define YYPOOLACQUIRE	yypoolacquire\n\
+#endif\n\
+#ifndef YYPOOLRELEASE\n\
+#define YYPOOLRELEASE	yypoolrelease\n\
+#endif\n\
+#ifndef YYPOOLDESTROY\n\
+#define YYPOOLDESTROY	yypooldestroy\n\
+#endif\n\
+#ifndef YY_POOL_INIT\n\
+#define YY_POOL_INIT(yy, yyctx)\n\
+#endif\n\
+#ifndef YY_POOL_RESET\n\
+#define YY_POOL_RESET(yy)\n\
+#endif\n\
+#endif\n\
+#ifdef YY_LIMITS\n\
+#include <setjmp.h>\n\
+#ifndef YYCANCEL\n\
+#define YYCANCEL	yycancel\n\
+#endif\n\
+enum { YYLIMIT_NONE= 0, YYLIMIT_STEPS, YYLIMIT_DEPTH, YYLIMIT_BUFFER, YYLIMIT_THUNKS, YYLIMIT_CANCEL };\n\
+#endif\n\
+\n\
+#ifndef YY_PART\n\
+\n\
+typedef struct _yycontext yycontext;\n\
+typedef struct _yythunk { int begin, end;  unsigned short action; } yythunk;\n\
+#ifdef YY_TOKENS\n\
+typedef struct _yytoken { int kind;  size_t begin, end; } yytoken;\n\
+#endif\n\
+#ifdef YY_LAZY\n\
+typedef struct _yyspan { int rule;  size_t begin, end; } yyspan;\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+typedef struct _yyevent\n\
+{\n\
+  int	      kind;		/* YYEVENT_ENTER, YYEVENT_LEAVE, YYEVENT_CAPTURE or YYEVENT_END */\n\
+  int	      id;		/* the rule, the action, or for YYEVENT_END the result */\n\
+  const char *name;		/* the rule, or the rule containing the action */\n\
+  size_t      begin, end;	/* the offsets in the input of the capture */\n\
+  const char *text;		/* the captured text, not terminated */\n\
+  int	      leng;\n\
+} yyevent;\n\
+#endif\n\
+\n\
+enum { yyThunkPush= 0, yyThunkPop, yyThunkSet, yyThunkActions };\n\
+\n\
+struct _yycontext {\n\
+  char     *_buf;\n\
+  int       _buflen;\n\
+  int       _pos;\n\
+  int       _limit;\n\
+  int       _maxpos;\n\
+  char     *_text;\n\
+  int       _textlen;\n\
+  int       _begin;\n\
+  int       _end;\n\
+  int       _textmax;\n\
+  yythunk  *_thunks;\n\
+  int       _thunkslen;\n\
+  int       _thunkpos;\n\
+  int       _choices;\n\
+  size_t    _offset;\n\
+  YYSTYPE   _;\n\
+  YYSTYPE  *_val;\n\
+#ifdef __cplusplus\n\
+  std::vector<YYSTYPE>* _vals;\n\
+#else\n\
+  YYSTYPE  *_vals;\n\
+  int       _valslen;\n\
+#endif\n\
+  int      *_frames;\n\
+  int       _frameslen;\n\
+  int       _frametop;\n\
+#ifdef YY_COROUTINE\n\
+  int       _final;\n\
+  int       _status;\n\
+  char     *_stack;\n\
+  ucontext_t _parser;\n\
+  ucontext_t _caller;\n\
+#endif\n\
+#ifdef YY_QUOTA\n\
+  int       _quota;\n\
+  int       _steps;\n\
+#endif\n\
+#ifdef YY_LIMITS\n\
+  long      _maxsteps;\n\
+  int       _maxdepth;\n\
+  int       _maxbuf;\n\
+  int       _maxthunks;\n\
+  int       _cancel;\n\
+  int       _error;\n\
+  long      _stepcount;\n\
+  int       _depth;\n\
+  jmp_buf   _abort;\n\
+#endif\n\
+#ifdef YY_TOKENS\n\
+  yytoken  *_tokens;\n\
+  int       _tokenslen;\n\
+  int       _tokencount;\n\
+  int       _token;\n\
+#endif\n\
+#ifdef YY_STRUCTURAL\n\
+  uint64_t *_index;\n\
+  int       _indexlen;\n\
+  int       _indexed;\n\
+#endif\n\
+#ifdef YY_LAZY\n\
+  yyspan   *_spans;\n\
+  int       _spanslen;\n\
+  int       _spancount;\n\
+  int       _spanning;\n\
+#endif\n\
+#ifdef YY_PARALLEL\n\
+  int       _chunk;\n\
+#endif\n\
+#ifdef YY_READAHEAD\n\
+  struct _yyahead *_ahead;\n\
+#endif\n\
+#ifdef YY_SEGMENTS\n\
+  const struct iovec *_segments;\n\
+  int       _segmentcount;\n\
+  int       _segment;		/* the next to be read */\n\
+  size_t    _segmentpos;		/* in that segment */\n\
+  size_t    _segmentsbase;	/* the offset of the first */\n\
+  size_t    _viewbegin, _viewend;\n\
+  int       _viewseg;		/* the last segment that began a view */\n\
+  size_t    _viewbase;		/* and its offset */\n\
+  char     *_ownbuf;		/* set aside while _buf points into a segment */\n\
+  int       _ownlen;\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+  yyevent  *_ring;		/* YY_EVENT_RING of them */\n\
+  unsigned  _ringhead;		/* written by the parser */\n\
+  unsigned  _ringtail;		/* written by the consumer */\n\
+  int       _headwait;		/* the consumer waits for the head to move */\n\
+  int       _tailwait;		/* the parser waits for the tail to move */\n\
+  const char *_pinned;		/* the text of the events last taken */\n\
+#endif\n\
+#if defined(YY_BATCH) || defined(YY_RECORDS)\n\
+  int       _document;\n\
+#endif\n\
+#ifdef YY_RECORDS\n\
+  long      _records;\n\
+  long      _rejected;\n\
+  double    _seconds;\n\
+#endif\n\
+#ifdef YY_CTX_MEMBERS\n\
+  YY_CTX_MEMBERS\n\
+#endif\n\
+};\n\
+\n\
+#ifdef YY_CTX_LOCAL\n\
+#define YY_CTX_PARAM_	yycontext *yyctx,\n\
+#define YY_CTX_PARAM	yycontext *yyctx\n\
+#define YY_CTX_ARG_	yyctx,\n\
+#define YY_CTX_ARG	yyctx\n\
+#ifndef YY_INPUT\n\
+#define YY_INPUT(yy, buf, result, max_size)		\\\n\
+  {							\\\n\
+    int yyc= getchar();					\\\n\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\\\n\
+    yyprintf((stderr, \"<%c>\", yyc));			\\\n\
+  }\n\
+#endif\n\
+#else\n\
+#define YY_CTX_PARAM_\n\
+#define YY_CTX_PARAM\n\
+#define YY_CTX_ARG_\n\
+#define YY_CTX_ARG\n\
+yycontext yyctx_= { 0, 0 };\n\
+yycontext *yyctx= &yyctx_;\n\
+#ifndef YY_INPUT\n\
+#define YY_INPUT(buf, result, max_size)			\\\n\
+  {							\\\n\
+    int yyc= getchar();					\\\n\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\\\n\
+    yyprintf((stderr, \"<%c>\", yyc));			\\\n\
+  }\n\
+#endif\n\
+#endif\n\
+\n\
+#ifdef YY_LIMITS\n\
+#ifdef __GNUC__\n\
+#define yyCancelled(yy)	__atomic_load_n(&yy->_cancel, __ATOMIC_RELAXED)\n\
+#else\n\
+#define yyCancelled(yy)	(*(volatile int *)&yy->_cancel)\n\
+#endif\n\
+YY_LOCAL(void) yyAbort(yycontext *yy, int error)\n\
+{\n\
+  yyprintf((stderr, \"limit: abort %d\\n\", error));\n\
+  yy->_error= error;\n\
+  longjmp(yy->_abort, 1);\n\
+}\n\
+#define yyEnter(yy)	do { if (++yy->_depth > yy->_maxdepth && yy->_maxdepth) yyAbort(yy, YYLIMIT_DEPTH); } while (0)\n\
+#define yyLeave(yy)	--yy->_depth\n\
+#define yyPoll(yy)	do { if (yyCancelled(yy)) yyAbort(yy, YYLIMIT_CANCEL); } while (0)\n\
+#define yyGrow(yy, size, max, error)	do { if ((max) && (size) > (max)) yyAbort(yy, error); } while (0)\n\
+#else\n\
+#define yyEnter(yy)\n\
+#define yyLeave(yy)\n\
+#define yyPoll(yy)\n\
+#define yyGrow(yy, size, max, error)\n\
+#endif\n\
+\n\
+#ifdef YY_READAHEAD\n\
+\n\
+/* Reading ahead of the parser.  YY_READAHEAD_BUFFERS buffers are kept\n\
+ * in flight, filled by io_uring when the input is a regular file and\n\
+ * the kernel supports it and otherwise by a thread of their own, and\n\
+ * yyrefill() takes them in order without a system call of its own\n\
+ * unless it has caught up with the reads.\n\
+ */\n\
+\n\
+typedef struct _yyahead\n\
+{\n\
+  int		  fd, size, count;\n\
+  char		 *bufs;			/* count buffers of size bytes */\n\
+  int		 *lens;			/* of each buffer once read */\n\
+  int		  take, put;		/* buffers taken by the parser, and filled */\n\
+  int		  used;			/* of the buffer being taken */\n\
+  int		  error;		/* errno of a failed read */\n\
+  int		  stop;\n\
+  int		  wake[2];		/* a pipe that wakes the reader to stop */\n\
+  pthread_t	  reader;\n\
+  pthread_mutex_t lock;\n\
+  pthread_cond_t  cond;\n\
+#ifdef YY_URING\n\
+  int		  ring;			/* or -1 if the thread is reading */\n\
+  off_t		  offset;		/* of the next read to submit */\n\
+  off_t		 *offsets;		/* of each buffer being read */\n\
+  int		 *gots;			/* bytes read into each buffer so far */\n\
+  int		  queued, inflight;\n\
+  void		 *sqmap, *cqmap;\n\
+  size_t	  sqsize, cqsize, sqessize;\n\
+  struct io_uring_sqe *sqes;\n\
+  unsigned	 *sqhead, *sqtail, *sqmask, *sqarray;\n\
+  unsigned	 *cqhead, *cqtail, *cqmask;\n\
+  struct io_uring_cqe *cqes;\n\
+#endif\n\
+} yyahead;\n\
+\n\
+static void *yyAheadReader(void *arg)\n\
+{\n\
+  yyahead *a= (yyahead *)arg;\n\
+  for (;;)\n\
+    {\n\
+      int slot, stop, n;\n\
+      pthread_mutex_lock(&a->lock);\n\
+      while (a->put - a->take == a->count && !a->stop)\n\
+	pthread_cond_wait(&a->cond, &a->lock);\n\
+      slot= a->put % a->count;\n\
+      stop= a->stop;\n\
+      pthread_mutex_unlock(&a->lock);\n\
+      if (stop) return 0;\n\
+      {\n\
+	struct pollfd fds[2]= { { a->fd, POLLIN, 0 }, { a->wake[0], POLLIN, 0 } };\n\
+	while (poll(fds, 2, -1) < 0 && EINTR == errno);\n\
+	if (fds[1].revents) return 0;		/* stopped while waiting for input */\n\
+      }\n\
+      while ((n= (int)read(a->fd, a->bufs + (size_t)slot * a->size, a->size)) < 0 && EINTR == errno);\n\
+      pthread_mutex_lock(&a->lock);\n\
+      if (n < 0) a->error= errno;\n\
+      a->lens[slot]= (n < 0) ? 0 : n;\n\
+      ++a->put;\n\
+      pthread_cond_signal(&a->cond);\n\
+      pthread_mutex_unlock(&a->lock);\n\
+      if (n <= 0) return 0;\n\
+    }\n\
+}\n\
+\n\
+#ifdef YY_URING\n\
+\n\
+YY_LOCAL(void) yyAheadSubmit(yyahead *a, int slot)\n\
+{\n\
+  unsigned		tail= *a->sqtail, index= tail & *a->sqmask;\n\
+  struct io_uring_sqe  *sqe= &a->sqes[index];\n\
+  memset(sqe, 0, sizeof(*sqe));\n\
+  sqe->opcode=	  IORING_OP_READ;\n\
+  sqe->fd=	  a->fd;\n\
+  sqe->off=	  a->offsets[slot] + a->gots[slot];\n\
+  sqe->addr=	  (uint64_t)(size_t)(a->bufs + (size_t)slot * a->size + a->gots[slot]);\n\
+  sqe->len=	  a->size - a->gots[slot];\n\
+  sqe->user_data= slot;\n\
+  a->sqarray[index]= index;\n\
+  __atomic_store_n(a->sqtail, tail + 1, __ATOMIC_RELEASE);\n\
+  ++a->queued;\n\
+  ++a->inflight;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyAheadEnter(yyahead *a, unsigned wait)\n\
+{\n\
+  int n= (int)syscall(__NR_io_uring_enter, a->ring, a->queued, wait, wait ? IORING_ENTER_GETEVENTS : 0, 0, 0);\n\
+  if (n < 0) return EINTR == errno || EAGAIN == errno || EBUSY == errno;\n\
+  a->queued -= n;\n\
+  return 1;\n\
+}\n\
+\n\
+/* Note the reads that have completed, submitting again those that\n\
+ * were short but not at the end of the file.\n\
+ */\n\
+YY_LOCAL(void) yyAheadReap(yyahead *a)\n\
+{\n\
+  unsigned head= *a->cqhead;\n\
+  while (head != __atomic_load_n(a->cqtail, __ATOMIC_ACQUIRE))\n\
+    {\n\
+      struct io_uring_cqe *cqe= &a->cqes[head++ & *a->cqmask];\n\
+      int slot= (int)cqe->user_data;\n\
+      --a->inflight;\n\
+      if (-EINTR == cqe->res || -EAGAIN == cqe->res || (cqe->res > 0 && (a->gots[slot] += cqe->res) < a->size))\n\
+	yyAheadSubmit(a, slot);\n\
+      else\n\
+	{\n\
+	  if (cqe->res < 0) a->error= -cqe->res;\n\
+	  a->lens[slot]= a->gots[slot];\n\
+	}\n\
+    }\n\
+  __atomic_store_n(a->cqhead, head, __ATOMIC_RELEASE);\n\
+}\n\
+\n\
+YY_LOCAL(void) yyAheadRead(yyahead *a, int slot)\n\
+{\n\
+  a->offsets[slot]= a->offset;\n\
+  a->offset += a->size;\n\
+  a->gots[slot]= 0;\n\
+  a->lens[slot]= -1;\n\
+  yyAheadSubmit(a, slot);\n\
+}\n\
+\n\
+YY_LOCAL(void) yyAheadUnmap(yyahead *a)\n\
+{\n\
+  if (a->sqmap && MAP_FAILED != a->sqmap) munmap(a->sqmap, a->sqsize);\n\
+  if (a->cqmap && MAP_FAILED != a->cqmap && a->cqmap != a->sqmap) munmap(a->cqmap, a->cqsize);\n\
+  if (a->sqes && MAP_FAILED != (void *)a->sqes) munmap(a->sqes, a->sqessize);\n\
+  close(a->ring);\n\
+  a->ring= -1;\n\
+}\n\
+\n\
+/* Read a regular file through io_uring and return 1, or return 0 if it\n\
+ * cannot be read that way.  Return -1 if the reads could not be\n\
+ * followed after the kernel had taken some of them, which may then\n\
+ * still fill the buffers.\n\
+ */\n\
+YY_LOCAL(int) yyAheadRing(yycontext *yy, yyahead *a)\n\
+{\n\
+  struct io_uring_params p;\n\
+  struct stat		 st;\n\
+  int			 slot, busy;\n\
+  unsigned		 head;\n\
+  if (fstat(a->fd, &st) || !S_ISREG(st.st_mode) || (a->offset= lseek(a->fd, 0, SEEK_CUR)) < 0)\n\
+    return 0;\n\
+  memset(&p, 0, sizeof(p));\n\
+  if ((a->ring= (int)syscall(__NR_io_uring_setup, a->count, &p)) < 0)\n\
+    return 0;\n\
+  if (!(p.features & IORING_FEAT_RW_CUR_POS))	/* no IORING_OP_READ before 5.6 */\n\
+    {\n\
+      close(a->ring);\n\
+      a->ring= -1;\n\
+      return 0;\n\
+    }\n\
+  a->sqsize= p.sq_off.array + p.sq_entries * sizeof(unsigned);\n\
+  a->cqsize= p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);\n\
+  if ((p.features & IORING_FEAT_SINGLE_MMAP) && a->cqsize > a->sqsize)\n\
+    a->sqsize= a->cqsize;\n\
+  a->sqmap= mmap(0, a->sqsize, PROT_READ | PROT_WRITE, MAP_SHARED, a->ring, IORING_OFF_SQ_RING);\n\
+  a->cqmap= (p.features & IORING_FEAT_SINGLE_MMAP) ? a->sqmap\n\
+	  : mmap(0, a->cqsize, PROT_READ | PROT_WRITE, MAP_SHARED, a->ring, IORING_OFF_CQ_RING);\n\
+  a->sqessize= p.sq_entries * sizeof(struct io_uring_sqe);\n\
+  a->sqes= (struct io_uring_sqe *)mmap(0, a->sqessize, PROT_READ | PROT_WRITE, MAP_SHARED, a->ring, IORING_OFF_SQES);\n\
+  a->count= p.sq_entries < (unsigned)a->count ? (int)p.sq_entries : a->count;\n\
+  if (MAP_FAILED == a->sqmap || MAP_FAILED == a->cqmap || MAP_FAILED == (void *)a->sqes)\n\
+    {\n\
+      yyAheadUnmap(a);\n\
+      return 0;\n\
+    }\n\
+  a->sqhead=  (unsigned *)((char *)a->sqmap + p.sq_off.head);\n\
+  a->sqtail=  (unsigned *)((char *)a->sqmap + p.sq_off.tail);\n\
+  a->sqmask=  (unsigned *)((char *)a->sqmap + p.sq_off.ring_mask);\n\
+  a->sqarray= (unsigned *)((char *)a->sqmap + p.sq_off.array);\n\
+  a->cqhead=  (unsigned *)((char *)a->cqmap + p.cq_off.head);\n\
+  a->cqtail=  (unsigned *)((char *)a->cqmap + p.cq_off.tail);\n\
+  a->cqmask=  (unsigned *)((char *)a->cqmap + p.cq_off.ring_mask);\n\
+  a->cqes=    (struct io_uring_cqe *)((char *)a->cqmap + p.cq_off.cqes);\n\
+  a->offsets= (off_t *)YY_MALLOC(yy, sizeof(off_t) * a->count);\n\
+  a->gots=    (int *)YY_MALLOC(yy, sizeof(int) * a->count);\n\
+  head= *a->sqhead;\n\
+  for (slot= 0;  slot < a->count;  ++slot)\n\
+    yyAheadRead(a, slot);\n\
+  if (!yyAheadEnter(a, 0))\n\
+    {\n\
+      busy= head != __atomic_load_n(a->sqhead, __ATOMIC_ACQUIRE);\n\
+      yyAheadUnmap(a);\n\
+      YY_FREE(yy, a->offsets);\n\
+      YY_FREE(yy, a->gots);\n\
+      return busy ? -1 : 0;\n\
+    }\n\
+  return 1;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+/* Copy up to max bytes of input that has been read ahead into buf. */\n\
+YY_LOCAL(int) yyAheadTake(yyahead *a, char *buf, int max)\n\
+{\n\
+  int slot= a->take % a->count, n;\n\
+#ifdef YY_URING\n\
+  if (a->ring >= 0)\n\
+    {\n\
+      while (a->lens[slot] < 0)\n\
+	{\n\
+	  yyAheadReap(a);\n\
+	  if (a->lens[slot] < 0 && !yyAheadEnter(a, 1))\n\
+	    {\n\
+	      a->error= errno;\n\
+	      return 0;\n\
+	    }\n\
+	}\n\
+    }\n\
+  else\n\
+#endif\n\
+    {\n\
+      pthread_mutex_lock(&a->lock);			/* uncontended unless waiting */\n\
+      while (a->take == a->put)\n\
+	pthread_cond_wait(&a->cond, &a->lock);\n\
+      pthread_mutex_unlock(&a->lock);\n\
+    }\n\
+  if ((n= a->lens[slot] - a->used) > max) n= max;\n\
+  memcpy(buf, a->bufs + (size_t)slot * a->size + a->used, n);\n\
+  if ((a->used += n) < a->lens[slot] || !n)\n\
+    return n;					/* the end of the input stays taken */\n\
+  a->used= 0;\n\
+#ifdef YY_URING\n\
+  if (a->ring >= 0)\n\
+    {\n\
+      ++a->take;\n\
+      yyAheadRead(a, slot);\n\
+      if (a->queued >= a->count / 2)		/* submit in batches */\n\
+	yyAheadEnter(a, 0);\n\
+      return n;\n\
+    }\n\
+#endif\n\
+  pthread_mutex_lock(&a->lock);\n\
+  ++a->take;\n\
+  pthread_cond_signal(&a->cond);\n\
+  pthread_mutex_unlock(&a->lock);\n\
+  return n;\n\
+}\n\
+\n\
+YY_LOCAL(void) yyAheadStop(yycontext *yy, yyahead *a)\n\
+{\n\
+  int busy= 0;\n\
+#ifdef YY_URING\n\
+  if (a->ring >= 0)\n\
+    {\n\
+      while (a->inflight && yyAheadEnter(a, 1))\n\
+	yyAheadReap(a);\n\
+      busy= a->inflight;\n\
+      yyAheadUnmap(a);\n\
+      YY_FREE(yy, a->offsets);\n\
+      YY_FREE(yy, a->gots);\n\
+    }\n\
+  else\n\
+#endif\n\
+    {\n\
+      pthread_mutex_lock(&a->lock);\n\
+      a->stop= 1;\n\
+      pthread_cond_signal(&a->cond);\n\
+      pthread_mutex_unlock(&a->lock);\n\
+      while (write(a->wake[1], \"\", 1) < 0 && EINTR == errno);\n\
+      pthread_join(a->reader, 0);\n\
+      close(a->wake[0]);\n\
+      close(a->wake[1]);\n\
+    }\n\
+  pthread_mutex_destroy(&a->lock);\n\
+  pthread_cond_destroy(&a->cond);\n\
+  if (!busy)				/* else reads the kernel still has may yet fill them */\n\
+    YY_FREE(yy, a->bufs);\n\
+  YY_FREE(yy, a->lens);\n\
+  YY_FREE(yy, a);\n\
+}\n\
+\n\
+/* Read the input from fd ahead of the parser, instead of through\n\
+ * YY_INPUT, until yyrelease().  Return zero if the reads could not be\n\
+ * started.\n\
+ */\n\
+YY_PARSE(int) YYREADAHEAD(YY_CTX_PARAM_ int yyfd)\n\
+{\n\
+  yyahead *yya;\n\
+  int	   yyok;\n\
+  if (yyctx->_ahead)\n\
+    {\n\
+      yyAheadStop(yyctx, yyctx->_ahead);\n\
+      yyctx->_ahead= 0;\n\
+    }\n\
+  yya= (yyahead *)YY_MALLOC(yyctx, sizeof(yyahead));\n\
+  memset(yya, 0, sizeof(yyahead));\n\
+  yya->fd= yyfd;\n\
+  yya->size= YY_READAHEAD_SIZE;\n\
+  yya->count= YY_READAHEAD_BUFFERS;\n\
+  yya->bufs= (char *)YY_MALLOC(yyctx, (size_t)yya->size * yya->count);\n\
+  yya->lens= (int *)YY_MALLOC(yyctx, sizeof(int) * yya->count);\n\
+  pthread_mutex_init(&yya->lock, 0);\n\
+  pthread_cond_init(&yya->cond, 0);\n\
+#ifdef YY_URING\n\
+  yya->ring= -1;\n\
+  if ((yyok= yyAheadRing(yyctx, yya)) < 0)	/* the buffers cannot be used or freed */\n\
+    {\n\
+      pthread_mutex_destroy(&yya->lock);\n\
+      pthread_cond_destroy(&yya->cond);\n\
+      YY_FREE(yyctx, yya->lens);\n\
+      YY_FREE(yyctx, yya);\n\
+      return 0;\n\
+    }\n\
+  if (yyok)\n\
+    {\n\
+      yyctx->_ahead= yya;\n\
+      return 1;\n\
+    }\n\
+#endif\n\
+  yyok= !pipe(yya->wake);\n\
+  if (yyok && pthread_create(&yya->reader, 0, yyAheadReader, yya))\n\
+    {\n\
+      close(yya->wake[0]);\n\
+      close(yya->wake[1]);\n\
+      yyok= 0;\n\
+    }\n\
+  if (!yyok)\n\
+    {\n\
+      pthread_mutex_destroy(&yya->lock);\n\
+      pthread_cond_destroy(&yya->cond);\n\
+      YY_FREE(yyctx, yya->bufs);\n\
+      YY_FREE(yyctx, yya->lens);\n\
+      YY_FREE(yyctx, yya);\n\
+      return 0;\n\
+    }\n\
+  yyctx->_ahead= yya;\n\
+  return 1;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+#ifdef YY_SEGMENTS\n\
+\n\
+/* The parser matches in the caller's segment itself for as long as it\n\
+ * can, borrowing it as its buffer, and copies into its own buffer only\n\
+ * the input that it needs to see whole across the end of a segment.\n\
+ */\n\
+\n\
+/* The segment to read from next, past any that are empty, or 0.\n\
+ */\n\
+YY_LOCAL(const struct iovec *) yySegmentsNext(yycontext *yy)\n\
+{\n\
+  while (yy->_segment < yy->_segmentcount && !yy->_segments[yy->_segment].iov_len)\n\
+    ++yy->_segment;\n\
+  return (yy->_segment < yy->_segmentcount) ? &yy->_segments[yy->_segment] : 0;\n\
+}\n\
+\n\
+/* Copy up to max bytes of the next segment into buf, as YY_INPUT would.\n\
+ * Stopping at the end of the segment copies no more than the parser\n\
+ * asks for, and leaves it a chance to borrow the next one.\n\
+ */\n\
+YY_LOCAL(int) yySegmentsTake(yycontext *yy, char *buf, int max)\n\
+{\n\
+  const struct iovec *seg= yySegmentsNext(yy);\n\
+  size_t	      len;\n\
+  if (!seg) return 0;\n\
+  len= seg->iov_len - yy->_segmentpos;\n\
+  if (len > (size_t)max) len= max;\n\
+  memcpy(buf, (const char *)seg->iov_base + yy->_segmentpos, len);\n\
+  if ((yy->_segmentpos += len) == seg->iov_len)\n\
+    {\n\
+      yy->_segmentpos= 0;\n\
+      ++yy->_segment;\n\
+    }\n\
+  return (int)len;\n\
+}\n\
+\n\
+/* Point the buffer at the rest of the next segment, whose first len\n\
+ * bytes were taken already and whose last limit of those are the input\n\
+ * still buffered, setting the parser's own buffer aside.\n\
+ */\n\
+YY_LOCAL(void) yySegmentsBorrow(yycontext *yy, const struct iovec *seg, size_t len)\n\
+{\n\
+  yy->_ownbuf= yy->_buf;\n\
+  yy->_ownlen= yy->_buflen;\n\
+  yy->_buf= (char *)seg->iov_base + len - yy->_limit;\n\
+  yy->_buflen= yy->_limit += (int)(seg->iov_len - len);\n\
+  yy->_segment= (int)(seg - yy->_segments) + 1;\n\
+  yy->_segmentpos= 0;\n\
+}\n\
+\n\
+/* Go back to the parser's own buffer, leaving behind what is in the\n\
+ * borrowed one.\n\
+ */\n\
+YY_LOCAL(void) yySegmentsOwn(yycontext *yy)\n\
+{\n\
+  yy->_buf= yy->_ownbuf;\n\
+  yy->_buflen= yy->_ownlen;\n\
+  yy->_ownbuf= 0;\n\
+}\n\
+\n\
+/* Copy what is left of a borrowed segment into the parser's own buffer,\n\
+ * to read on past its end or to let it go.\n\
+ */\n\
+YY_LOCAL(void) yySegmentsReturn(yycontext *yy)\n\
+{\n\
+  char *text= yy->_buf;\n\
+  yyGrow(yy, yy->_limit + 1, yy->_maxbuf, YYLIMIT_BUFFER);\n\
+  yySegmentsOwn(yy);\n\
+  if (yy->_buflen <= yy->_limit)\n\
+    {\n\
+      while (yy->_buflen <= yy->_limit) yy->_buflen *= 2;\n\
+      yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);\n\
+    }\n\
+  memcpy(yy->_buf, text, yy->_limit);\n\
+}\n\
+\n\
+/* Drop n bytes from the front of the buffer, _limit already counting\n\
+ * only those after them.  A borrowed segment is looked at from further\n\
+ * along, and input still buffered that all came from the segment being\n\
+ * read is looked at there again; only otherwise, when this returns\n\
+ * zero, must the bytes be moved.\n\
+ */\n\
+YY_LOCAL(int) yySegmentsShift(yycontext *yy, int n)\n\
+{\n\
+  const struct iovec *seg;\n\
+  size_t	      len;\n\
+  if (yy->_ownbuf)\n\
+    {\n\
+      if (!yy->_limit)\n\
+	yySegmentsOwn(yy);\n\
+      else\n\
+	{\n\
+	  yy->_buf += n;\n\
+	  yy->_buflen -= n;\n\
+	}\n\
+      return 1;\n\
+    }\n\
+  if (!yy->_segments || !yy->_limit)\n\
+    return 0;\n\
+  if (yy->_segmentpos)\n\
+    {\n\
+      seg= &yy->_segments[yy->_segment];\n\
+      len= yy->_segmentpos;\n\
+    }\n\
+  else if (yy->_segment)\n\
+    {\n\
+      seg= &yy->_segments[yy->_segment - 1];\n\
+      len= seg->iov_len;\n\
+    }\n\
+  else\n\
+    return 0;\n\
+  if ((size_t)yy->_limit > len)\n\
+    return 0;\n\
+  yySegmentsBorrow(yy, seg, len);\n\
+  return 1;\n\
+}\n\
+\n\
+/* Describe the input from begin to end, offsets in the whole input, as\n\
+ * up to max pieces of the caller's segments in iov.  Input that did not\n\
+ * come from the current chain is described as it is in the buffer.\n\
+ * Return the number of pieces, or -1 if max were not enough.\n\
+ */\n\
+YY_LOCAL(int) yyView(yycontext *yy, size_t begin, size_t end, struct iovec *iov, int max)\n\
+{\n\
+  size_t base= yy->_segmentsbase;\n\
+  int	 seg= 0, n= 0;\n\
+  if (begin >= end) return 0;\n\
+  if (begin >= yy->_viewbase && yy->_viewbase >= base)	/* views are mostly taken in order */\n\
+    {\n\
+      seg=  yy->_viewseg;\n\
+      base= yy->_viewbase;\n\
+    }\n\
+  if (begin < base || !yy->_segments)\n\
+    {\n\
+      size_t stop= (end < base || !yy->_segments) ? end : base;\n\
+      if (!max) return -1;\n\
+      iov[n].iov_base= yy->_buf + (begin - yy->_offset);\n\
+      iov[n++].iov_len= stop - begin;\n\
+      begin= stop;\n\
+    }\n\
+  while (begin < end && seg < yy->_segmentcount)\n\
+    {\n\
+      size_t len= yy->_segments[seg].iov_len;\n\
+      if (begin < base + len)\n\
+	{\n\
+	  size_t stop= (end < base + len) ? end : base + len;\n\
+	  if (n == max) return -1;\n\
+	  if (!n)\n\
+	    {\n\
+	      yy->_viewseg=  seg;\n\
+	      yy->_viewbase= base;\n\
+	    }\n\
+	  iov[n].iov_base= (char *)yy->_segments[seg].iov_base + (begin - base);\n\
+	  iov[n++].iov_len= stop - begin;\n\
+	  begin= stop;\n\
+	}\n\
+      base += len;\n\
+      ++seg;\n\
+    }\n\
+  return n;\n\
+}\n\
+\n\
+#define yyview(iov, max)	yyView(yy, yy->_viewbegin, yy->_viewend, iov, max)\n\
+\n\
+/* Take the input from the count segments in iov, which must remain\n\
+ * valid until it has all been parsed, after any that is buffered.  The\n\
+ * end of the last segment is the end of the input.\n\
+ */\n\
+YY_PARSE(void) YYSEGMENTS(YY_CTX_PARAM_ const struct iovec *yyiov, int yycount)\n\
+{\n\
+  if (yyctx->_ownbuf)			/* the old chain may be let go */\n\
+    yySegmentsReturn(yyctx);\n\
+  yyctx->_segments= yyiov;\n\
+  yyctx->_segmentcount= yycount;\n\
+  yyctx->_segment= 0;\n\
+  yyctx->_segmentpos= 0;\n\
+  yyctx->_viewseg= 0;\n\
+  yyctx->_segmentsbase= yyctx->_viewbase= yyctx->_offset + yyctx->_limit;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+YY_LOCAL(int) yyrefill(yycontext *yy)\n\
+{\n\
+  int yyn;\n\
+#ifdef YY_LAZY\n\
+  if (yy->_spanning) return 0;\n\
+#endif\n\
+#ifdef YY_PARALLEL\n\
+  if (yy->_chunk) return 0;\n\
+#endif\n\
+#if defined(YY_BATCH) || defined(YY_RECORDS)\n\
+  if (yy->_document) return 0;\n\
+#endif\n\
+#ifdef YY_PUSH\n\
+  while (yy->_pos >= yy->_limit && !yy->_final)\n\
+    {\n\
+      yyprintf((stderr, \"push: need more\\n\"));\n\
+      yy->_status= YYPARSE_NEED_MORE;\n\
+      swapcontext(&yy->_parser, &yy->_caller);\n\
+    }\n\
+  return yy->_pos < yy->_limit;\n\
+#endif\n\
+#ifdef YY_SEGMENTS\n\
+  if (yy->_ownbuf)			/* reading on past the end of a borrowed segment */\n\
+    {\n\
+      if (!yySegmentsNext(yy)) return 0;	/* there is nothing past it */\n\
+      yySegmentsReturn(yy);\n\
+    }\n\
+  else if (yy->_segments && !yy->_limit && yySegmentsNext(yy))\n\
+    {\n\
+      yySegmentsBorrow(yy, yySegmentsNext(yy), yy->_segmentpos);\n\
+      return 1;\n\
+    }\n\
+#endif\n\
+  while (yy->_buflen - yy->_pos < 512)\n\
+    {\n\
+      int yylen= yy->_buflen * 2;\n\
+#ifdef YY_LIMITS\n\
+      if (yy->_maxbuf && yylen > yy->_maxbuf)\n\
+	{\n\
+	  if (yy->_buflen >= yy->_maxbuf && yy->_buflen > yy->_pos)\n\
+	    break;					/* read into what room is left */\n\
+	  yyGrow(yy, yy->_pos + 1, yy->_maxbuf, YYLIMIT_BUFFER);\n\
+	  yylen= yy->_maxbuf;\n\
+	}\n\
+#endif\n\
+      yy->_buflen= yylen;\n\
+      yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);\n\
+    }\n\
+#ifdef YY_READAHEAD\n\
+  if (yy->_ahead)\n\
+    yyn= yyAheadTake(yy->_ahead, yy->_buf + yy->_pos, yy->_buflen - yy->_pos);\n\
+  else\n\
+#endif\n\
+#ifdef YY_SEGMENTS\n\
+  if (yy->_segments)\n\
+    yyn= yySegmentsTake(yy, yy->_buf + yy->_pos, yy->_buflen - yy->_pos);\n\
+  else\n\
+#endif\n\
+#ifdef YY_CTX_LOCAL\n\
+  YY_INPUT(yy, (yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));\n\
+#else\n\
+  YY_INPUT((yy->_buf + yy->_pos), yyn, (yy->_buflen - yy->_pos));\n\
+#endif\n\
+  if (!yyn) return 0;\n\
+  yy->_limit += yyn;\n\
+  return 1;\n\
+}\n\
+\n\
+YY_LOCAL(void) yyrecordMaxPos(yycontext *yy)\n\
+{\n\
+  if (yy->_pos > yy->_maxpos) {\n\
+    yy->_maxpos = yy->_pos;\n\
+    yyprintf((stderr, \"       maxpos=%d [after '%c']\\n\", yy->_maxpos, yy->_buf[yy->_maxpos-1]));\n\
+  }\n\
+}\n\
+\n\
+#if defined(YY_QUOTA) || defined(YY_LIMITS)\n\
+YY_LOCAL(void) yyStep(yycontext *yy)\n\
+{\n\
+#ifdef YY_LIMITS\n\
+  if (yy->_maxsteps && ++yy->_stepcount > yy->_maxsteps)\n\
+    yyAbort(yy, YYLIMIT_STEPS);\n\
+#endif\n\
+#ifdef YY_QUOTA\n\
+  if (yy->_quota && --yy->_steps < 0)\n\
+    {\n\
+      yyprintf((stderr, \"quota: yield\\n\"));\n\
+      yy->_status= YYPARSE_YIELD;\n\
+      swapcontext(&yy->_parser, &yy->_caller);\n\
+    }\n\
+#endif\n\
+}\n\
+#else\n\
+#define yyStep(yy)\n\
+#endif\n\
+\n\
+/* Scanners match most terminals in place, so any of these may go unused. */\n\
+YY_LOCAL(int) YY_UNUSED yymatchDot(yycontext *yy)\n\
+{\n\
+  yyStep(yy);\n\
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
+  ++yy->_pos;\n\
+  yyrecordMaxPos(yy);\n\
+  return 1;\n\
+}\n\
+\n\
+YY_LOCAL(int) YY_UNUSED yymatchChar(yycontext *yy, int c)\n\
+{\n\
+  yyStep(yy);\n\
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
+  if ((unsigned char)yy->_buf[yy->_pos] == c)\n\
+    {\n\
+      ++yy->_pos;\n\
+      yyrecordMaxPos(yy);\n\
+      yyprintf((stderr, \"  ok   yymatchChar(yy, %c) @ %s\\n\", c, yy->_buf+yy->_pos));\n\
+      return 1;\n\
+    }\n\
+  yyprintf((stderr, \"  fail yymatchChar(yy, %c) @ %s\\n\", c, yy->_buf+yy->_pos));\n\
+  return 0;\n\
+}\n\
+\n\
+YY_LOCAL(int) YY_UNUSED yymatchString(yycontext *yy, const char *s)\n\
+{\n\
+  int yysav= yy->_pos;\n\
+  yyStep(yy);\n\
+  while (*s)\n\
+    {\n\
+      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
+      if (yy->_buf[yy->_pos] != *s)\n\
+	{\n\
+	  yy->_pos= yysav;\n\
+	  return 0;\n\
+	}\n\
+      ++s;\n\
+      ++yy->_pos;\n\
+    }\n\
+  yyrecordMaxPos(yy);\n\
+  return 1;\n\
+}\n\
+\n\
+YY_LOCAL(int) YY_UNUSED yymatchIString(yycontext *yy, const char *s)\n\
+{\n\
+  int yysav= yy->_pos;\n\
+  yyStep(yy);\n\
+  while (*s)\n\
+    {\n\
+      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
+      if (tolower(yy->_buf[yy->_pos]) != *s)\n\
+        {\n\
+          yy->_pos= yysav;\n\
+          return 0;\n\
+        }\n\
+      ++s;\n\
+      ++yy->_pos;\n\
+    }\n\
+  yyrecordMaxPos(yy);\n\
+  return 1;\n\
+}\n\
+\n\
+YY_LOCAL(int) YY_UNUSED yymatchClass(yycontext *yy, unsigned char *bits)\n\
+{\n\
+  int c;\n\
+  yyStep(yy);\n\
+  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
+  c= (unsigned char)yy->_buf[yy->_pos];\n\
+  if (bits[c >> 3] & (1 << (c & 7)))\n\
+    {\n\
+      ++yy->_pos;\n\
+      yyrecordMaxPos(yy);\n\
+      yyprintf((stderr, \"  ok   yymatchClass @ %s\\n\", yy->_buf+yy->_pos));\n\
+      return 1;\n\
+    }\n\
+  yyprintf((stderr, \"  fail yymatchClass @ %s\\n\", yy->_buf+yy->_pos));\n\
+  return 0;\n\
+}\n\
+\n\
+#define yyAvail(yy, p)		((p) < (yy)->_limit || ((yy)->_pos= (p), yyrefill(yy)))\n\
+#define yyByte(yy, p)		((unsigned char)(yy)->_buf[p])\n\
+#define yyInClass(bits, c)	((bits)[(c) >> 3] & (1 << ((c) & 7)))\n\
+\n\
+#ifdef YY_FRAMES\n\
+YY_LOCAL(int *) yyGrowFrames(yycontext *yy, int size)\n\
+{\n\
+  if (!yy->_frameslen)\n\
+    {\n\
+      yy->_frameslen= YY_STACK_SIZE;\n\
+      yy->_frames= (int *)YY_MALLOC(yy, sizeof(int) * yy->_frameslen);\n\
+    }\n\
+  while (yy->_frameslen < size)\n\
+    {\n\
+      yy->_frameslen *= 2;\n\
+      yy->_frames= (int *)YY_REALLOC(yy, yy->_frames, sizeof(int) * yy->_frameslen);\n\
+    }\n\
+  return yy->_frames;\n\
+}\n\
+#endif\n\
+\n\
+YY_LOCAL(void) yyDo(yycontext *yy, int action, int begin, int end)\n\
+{\n\
+  yyGrow(yy, yy->_thunkpos + 1, yy->_maxthunks, YYLIMIT_THUNKS);\n\
+  while (yy->_thunkpos >= yy->_thunkslen)\n\
+    {\n\
+      yy->_thunkslen *= 2;\n\
+#ifdef YY_LIMITS\n\
+      if (yy->_maxthunks && yy->_thunkslen > yy->_maxthunks)\n\
+	yy->_thunkslen= yy->_maxthunks;\n\
+#endif\n\
+      yy->_thunks= (yythunk *)YY_REALLOC(yy, yy->_thunks, sizeof(yythunk) * yy->_thunkslen);\n\
+    }\n\
+  yy->_thunks[yy->_thunkpos].begin=  begin;\n\
+  yy->_thunks[yy->_thunkpos].end=    end;\n\
+  yy->_thunks[yy->_thunkpos].action= action;\n\
+  ++yy->_thunkpos;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)\n\
+{\n\
+  int yyleng= end - begin;\n\
+  if (yyleng <= 0)\n\
+    yyleng= 0;\n\
+  else\n\
+    {\n\
+      while (yy->_textlen < (yyleng + 1))\n\
+	{\n\
+	  yy->_textlen *= 2;\n\
+	  yy->_text= (char *)YY_REALLOC(yy, yy->_text, yy->_textlen);\n\
+	}\n\
+      memcpy(yy->_text, yy->_buf + begin, yyleng);\n\
+    }\n\
+  yy->_text[yyleng]= '\\0';\n\
+  return yyleng;\n\
+}\n\
+\n\
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng);\n\
+\n\
+#ifdef YY_LAZY\n\
+YY_LOCAL(void) yySpan(yycontext *yy, int rule, int begin, int end)\n\
+{\n\
+  yyspan *span;\n\
+  if (yy->_spancount == yy->_spanslen)\n\
+    {\n\
+      yy->_spanslen= yy->_spanslen ? 2 * yy->_spanslen : YY_STACK_SIZE;\n\
+      yy->_spans= (yyspan *)YY_REALLOC(yy, yy->_spans, sizeof(yyspan) * yy->_spanslen);\n\
+    }\n\
+  span= yy->_spans + yy->_spancount++;\n\
+  span->rule=  rule;\n\
+  span->begin= yy->_offset + begin;\n\
+  span->end=   yy->_offset + end;\n\
+}\n\
+#endif\n\
+\n\
+#ifdef YY_EVENTS\n\
+\n\
+#define yyLoadAcquire(p)	__atomic_load_n(p, __ATOMIC_ACQUIRE)\n\
+#define yyStoreOrdered(p, v)	__atomic_store_n(p, v, __ATOMIC_SEQ_CST)\n\
+\n\
+/* Wait while *word, the other side's end of the ring, is still value.\n\
+ * The waiter says so in *waiting before looking at the word again, and\n\
+ * the other side looks at *waiting after moving the word, so at least\n\
+ * one of them sees the other.  Without futexes, only yield.\n\
+ */\n\
+YY_LOCAL(void) yyRingWait(unsigned *word, unsigned value, int *waiting)\n\
+{\n\
+#ifdef YY_EVENT_FUTEX\n\
+  __atomic_store_n(waiting, 1, __ATOMIC_SEQ_CST);\n\
+  if (__atomic_load_n(word, __ATOMIC_SEQ_CST) == value)\n\
+    syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, 0, 0, 0);\n\
+  __atomic_store_n(waiting, 0, __ATOMIC_RELAXED);\n\
+#else\n\
+  sched_yield();\n\
+#endif\n\
+}\n\
+\n\
+YY_LOCAL(void) yyRingWake(unsigned *word, int *waiting)\n\
+{\n\
+#ifdef YY_EVENT_FUTEX\n\
+  if (__atomic_load_n(waiting, __ATOMIC_SEQ_CST))\n\
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, 1, 0, 0, 0);\n\
+#endif\n\
+}\n\
+\n\
+/* Post an event, waiting while the ring is full for the consumer to\n\
+ * take one, so that a consumer that falls behind holds up the parser\n\
+ * instead of letting the events pile up without limit.\n\
+ */\n\
+YY_LOCAL(void) yyPost(yycontext *yy, int kind, int id, const char *name, int begin, int end, const char *text)\n\
+{\n\
+  unsigned head= yy->_ringhead, tail;\n\
+  yyevent *event;\n\
+  if (!yy->_ring)\n\
+    yy->_ring= (yyevent *)YY_MALLOC(yy, sizeof(yyevent) * YY_EVENT_RING);\n\
+  while (head - (tail= yyLoadAcquire(&yy->_ringtail)) >= YY_EVENT_RING)\n\
+    yyRingWait(&yy->_ringtail, tail, &yy->_tailwait);\n\
+  event= &yy->_ring[head & (YY_EVENT_RING - 1)];\n\
+  event->kind= kind;\n\
+  event->id=   id;\n\
+  event->name= name;\n\
+  event->begin= yy->_offset + begin;\n\
+  event->end=   yy->_offset + end;\n\
+  event->text= text;\n\
+  event->leng= end - begin;\n\
+  yyStoreOrdered(&yy->_ringhead, head + 1);\n\
+  yyRingWake(&yy->_ringhead, &yy->_headwait);\n\
+}\n\
+\n\
+/* Post the pending actions as events instead of running them.  The\n\
+ * text that they capture is copied to a chunk of its own that is pinned\n\
+ * until the consumer has seen every event that refers to it.\n\
+ */\n\
+YY_LOCAL(void) yyPostEvents(yycontext *yy)\n\
+{\n\
+  int   pos, lo= yy->_limit, hi= 0;\n\
+  char *chunk= 0;\n\
+  for (pos= 0;  pos < yy->_thunkpos;  ++pos)\n\
+    {\n\
+      yythunk *thunk= &yy->_thunks[pos];\n\
+#ifdef YY_LAZY\n\
+      if (thunk->action >= YY_LAZY) continue;\n\
+#endif\n\
+      if (thunk->action >= yyThunkActions && thunk->action < YY_EVENT_ENTER && thunk->end > thunk->begin)\n\
+	{\n\
+	  if (thunk->begin < lo) lo= thunk->begin;\n\
+	  if (thunk->end   > hi) hi= thunk->end;\n\
+	}\n\
+    }\n\
+  if (hi > lo)\n\
+    {\n\
+      chunk= (char *)YY_MALLOC(yy, hi - lo);\n\
+      memcpy(chunk, yy->_buf + lo, hi - lo);\n\
+    }\n\
+  for (pos= 0;  pos < yy->_thunkpos;  ++pos)\n\
+    {\n\
+      yythunk *thunk= &yy->_thunks[pos];\n\
+      int      id;\n\
+      if (thunk->action == YY_EVENT_ENTER || thunk->action == YY_EVENT_LEAVE)\n\
+	yyPost(yy, (thunk->action == YY_EVENT_ENTER) ? YYEVENT_ENTER : YYEVENT_LEAVE,\n\
+	       thunk->end, yyrulenames[thunk->end], thunk->begin, thunk->begin, 0);\n\
+#ifdef YY_LAZY\n\
+      else if (thunk->action >= YY_LAZY)\n\
+	yySpan(yy, thunk->action - YY_LAZY, thunk->begin, thunk->end);\n\
+#endif\n\
+      else if (thunk->action >= yyThunkActions)\n\
+	{\n\
+	  id= thunk->action - yyThunkActions + 1;\n\
+	  if (thunk->end > thunk->begin)\n\
+	    yyPost(yy, YYEVENT_CAPTURE, id, yyactionrules[id], thunk->begin, thunk->end, chunk + thunk->begin - lo);\n\
+	  else\n\
+	    yyPost(yy, YYEVENT_CAPTURE, id, yyactionrules[id], thunk->begin, thunk->begin, \"\");\n\
+	}\n\
+    }\n\
+  if (chunk)\n\
+    yyPost(yy, YYEVENT_UNPIN, 0, 0, 0, 0, chunk);\n\
+  yy->_thunkpos= 0;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+YY_LOCAL(void) yyDone(yycontext *yy)\n\
+{\n\
+  int pos;\n\
+#ifdef YY_PARALLEL\n\
+  if (yy->_chunk) return;	/* run later, in order, by yyChunkDone() */\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+  yyPostEvents(yy);\n\
+  return;\n\
+#endif\n\
+  for (pos= 0;  pos < yy->_thunkpos;  ++pos)\n\
+    {\n\
+      yythunk *thunk= &yy->_thunks[pos];\n\
+      int yyleng;\n\
+#ifdef YY_LAZY\n\
+      if (thunk->action >= YY_LAZY)\n\
+	{\n\
+	  yySpan(yy, thunk->action - YY_LAZY, thunk->begin, thunk->end);\n\
+	  continue;\n\
+	}\n\
+#endif\n\
+#ifdef YY_SEGMENTS\n\
+      if (thunk->end && thunk->begin >= 0)\n\
+	{\n\
+	  yy->_viewbegin= yy->_offset + thunk->begin;\n\
+	  yy->_viewend= yy->_offset + ((thunk->end > thunk->begin) ? thunk->end : thunk->begin);\n\
+	}\n\
+      else				/* no text, and nothing to view */\n\
+	yy->_viewbegin= yy->_viewend= 0;\n\
+#endif\n\
+#ifdef YY_SEGMENTS_NOCOPY\n\
+      if (yy->_viewend > yy->_viewbegin)	/* the action can use yyview(); empty text is copied, to end it */\n\
+	{\n\
+	  yyDispatch(yy, thunk->action, yy->_buf + thunk->begin, (int)(yy->_viewend - yy->_viewbegin));\n\
+	  continue;\n\
+	}\n\
+#endif\n\
+      yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;\n\
+      yyprintf((stderr, \"DO [%d] %d %s\\n\", pos, thunk->action, yy->_text));\n\
+      yyDispatch(yy, thunk->action, yy->_text, yyleng);\n\
+    }\n\
+  yy->_thunkpos= 0;\n\
+}\n\
+\n\
+#ifdef YY_TOKENS\n\
+/* Forget the tokens that begin before the buffer, which can no longer\n\
+ * be matched again.\n\
+ */\n\
+YY_LOCAL(void) yyDropTokens(yycontext *yy)\n\
+{\n\
+  int n= 0;\n\
+  while (n < yy->_tokencount && yy->_tokens[n].begin < yy->_offset) ++n;\n\
+  if (n) memmove(yy->_tokens, yy->_tokens + n, sizeof(yytoken) * (yy->_tokencount -= n));\n\
+  yy->_token= 0;\n\
+}\n\
+#endif\n\
+\n\
+YY_LOCAL(void) yyCommit(yycontext *yy)\n\
+{\n\
+  yy->_limit -= yy->_pos;\n\
+#ifdef YY_SEGMENTS\n\
+  if (!yySegmentsShift(yy, yy->_pos))\n\
+#endif\n\
+  if (yy->_limit)\n\
+    memmove(yy->_buf, yy->_buf + yy->_pos, yy->_limit);\n\
+  yy->_begin -= yy->_pos;\n\
+  yy->_end -= yy->_pos;\n\
+  yy->_offset += yy->_pos;\n\
+  yy->_pos= yy->_thunkpos= 0;\n\
+#ifdef YY_STRUCTURAL\n\
+  yy->_indexed= 0;\n\
+#endif\n\
+#ifdef YY_TOKENS\n\
+  yyDropTokens(yy);\n\
+#endif\n\
+}\n\
+\n\
+#ifdef YY_STREAM\n\
+YY_LOCAL(void) yyStream(yycontext *yy)\n\
+{\n\
+  int keep= yy->_pos;\n\
+#ifdef YY_PARALLEL\n\
+  if (yy->_chunk) return;\n\
+#endif\n\
+  if (yy->_begin >= 0 && yy->_begin < keep) keep= yy->_begin;\n\
+  if (yy->_end   >= 0 && yy->_end   < keep) keep= yy->_end;\n\
+  yyDone(yy);\n\
+  if (keep > 0 && keep >= yy->_limit - keep)\n\
+    {\n\
+      yyprintf((stderr, \"stream %d of %d\\n\", keep, yy->_limit));\n\
+      yy->_limit -= keep;\n\
+#ifdef YY_SEGMENTS\n\
+      if (!yySegmentsShift(yy, keep))\n\
+#endif\n\
+      memmove(yy->_buf, yy->_buf + keep, yy->_limit);\n\
+      yy->_pos -= keep;\n\
+      yy->_begin -= keep;\n\
+      yy->_end -= keep;\n\
+      yy->_maxpos= (yy->_maxpos > keep) ? yy->_maxpos - keep : 0;\n\
+      yy->_offset += keep;\n\
+#ifdef YY_STRUCTURAL\n\
+      yy->_indexed= 0;\n\
+#endif\n\
+#ifdef YY_TOKENS\n\
+      yyDropTokens(yy);\n\
+#endif\n\
+    }\n\
+}\n\
+#endif\n\
+\n\
+YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)\n\
+{\n\
+  if (tp0)\n\
+    {\n\
+      fprintf(stderr, \"accept denied at %d\\n\", tp0);\n\
+      return 0;\n\
+    }\n\
+#ifdef YY_PARALLEL\n\
+  else if (yy->_chunk)\n\
+    ;\n\
+#endif\n\
+  else\n\
+    {\n\
+      yyDone(yy);\n\
+      yyCommit(yy);\n\
+    }\n\
+  return 1;\n\
+}\n\
+\n\
+YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)\n\
+{\n\
+#ifdef __cplusplus\n\
+  yy->_vals->resize(yy->_vals->size() + count);\n\
+  yy->_val = &yy->_vals->back();\n\
+#else\n\
+  yy->_val += count;\n\
+  while (yy->_valslen <= yy->_val - yy->_vals)\n\
+    {\n\
+      long offset= yy->_val - yy->_vals;\n\
+      size_t oldlen = yy->_valslen;\n\
+      yy->_valslen *= 2;\n\
+      yy->_vals= (YYSTYPE *)YY_REALLOC(yy, yy->_vals, sizeof(YYSTYPE) * yy->_valslen);\n\
+      memset(&yy->_vals[oldlen], 0, sizeof(YYSTYPE) * oldlen);\n\
+      yy->_val= yy->_vals + offset;\n\
+    }\n\
+#endif\n\
+}\n\
+YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)\n\
+{\n\
+#ifdef __cplusplus\n\
+  yy->_vals->resize(yy->_vals->size() - count);\n\
+  yy->_val = &yy->_vals->back();\n\
+#else\n\
+  yy->_val -= count;\n\
+#endif\n\
+}\n\
+YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)   { yy->_val[count]= yy->_; }\n\
+\n\
+#ifdef YY_LAZY\n\
+#ifndef YY_LAZY_QUOTE\n\
+#define YY_LAZY_QUOTE(c)	('\"' == (c) || '\\'' == (c))\n\
+#define YY_LAZY_WORDS		/* the quotes are known, so eight bytes can be tested at once */\n\
+#endif\n\
+#ifndef YY_LAZY_COMMENTS\n\
+#define YY_LAZY_COMMENTS	1\n\
+#endif\n\
+#ifdef YY_LAZY_WORDS\n\
+#define yyLazyHas(w, c)	((((w) ^ 0x0101010101010101ULL * (c)) - 0x0101010101010101ULL) & ~((w) ^ 0x0101010101010101ULL * (c)) & 0x8080808080808080ULL)\n\
+#endif\n\
+/* Move over a balanced region without parsing it, and remember where\n\
+ * it was so that it can be parsed later.  Brackets within quotes or\n\
+ * C comments are not counted.  Unless the program has its own quotes,\n\
+ * text between the bytes that matter is passed over a word at a time.\n\
+ */\n\
+YY_LOCAL(int) yyskipLazy(yycontext *yy, int rule, int open, int close)\n\
+{\n\
+  int pos= yy->_pos, p= pos, depth= 0, c;\n\
+  yyStep(yy);\n\
+  if (!yyAvail(yy, p) || yyByte(yy, p) != open)\n\
+    {\n\
+      yy->_pos= pos;\n\
+      return 0;\n\
+    }\n\
+  for (;;)\n\
+    {\n\
+#ifdef YY_LAZY_WORDS\n\
+      for (;  p + 8 <= yy->_limit;  p += 8)\n\
+	{\n\
+	  unsigned long long w;\n\
+	  memcpy(&w, yy->_buf + p, 8);\n\
+	  if (yyLazyHas(w, open) | yyLazyHas(w, close) | yyLazyHas(w, '\"') | yyLazyHas(w, '\\'') | yyLazyHas(w, '/'))\n\
+	    break;\n\
+	}\n\
+#endif\n\
+      while (p < yy->_limit && (c= yyByte(yy, p)) != open && c != close && !YY_LAZY_QUOTE(c) && '/' != c)\n\
+	++p;\n\
+      if (!yyAvail(yy, p))\n\
+	{\n\
+	  yy->_pos= pos;\n\
+	  return 0;\n\
+	}\n\
+      c= yyByte(yy, p++);\n\
+      if (c == open)\n\
+	++depth;\n\
+      else if (c == close)\n\
+	{\n\
+	  if (!--depth) break;\n\
+	}\n\
+      else if (YY_LAZY_QUOTE(c))\n\
+	{\n\
+	  int d;\n\
+	  while (yyAvail(yy, p) && (d= yyByte(yy, p++)) != c)\n\
+	    if ('\\\\' == d && yyAvail(yy, p)) ++p;\n\
+	}\n\
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '/' == yyByte(yy, p))\n\
+	{\n\
+	  while (yyAvail(yy, p) && '\\n' != yyByte(yy, p)) ++p;\n\
+	}\n\
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '*' == yyByte(yy, p))\n\
+	{\n\
+	  for (++p;  yyAvail(yy, p) && !('*' == yyByte(yy, p) && yyAvail(yy, p + 1) && '/' == yyByte(yy, p + 1));  ++p);\n\
+	  if (yyAvail(yy, p)) p += 2;\n\
+	}\n\
+    }\n\
+  yy->_pos= p;\n\
+  yyrecordMaxPos(yy);\n\
+  yyDo(yy, YY_LAZY + rule, pos, p);\n\
+  return 1;\n\
+}\n\
+#endif\n\
+\n\
+\n\
+#endif /* YY_PART */\n\
+\n\
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)\n\
+\n\
+";
+
+static char *tokenRuntime= "\
+\n\
+/* The token at the current position, found by trying every token rule\n\
+ * there and keeping the longest match.  Tokens are kept in order of\n\
+ * their absolute offset in the input, so each is scanned only once.\n\
+ */\n\
+YY_LOCAL(yytoken *) yyScanToken(yycontext *yy)\n\
+{\n\
+  size_t at= yy->_offset + yy->_pos;\n\
+  int lo= yy->_token, hi= yy->_tokencount, kind, pos, thunkpos, maxpos, begin, end, best= 0, bestpos;\n\
+  if (lo < hi && yy->_tokens[lo].begin == at) return yy->_tokens + lo;\n\
+  if (++lo < hi && yy->_tokens[lo].begin == at) return yy->_tokens + (yy->_token= lo);\n\
+  for (lo= 0;  lo < hi;  )\n\
+    {\n\
+      int mid= (lo + hi) / 2;\n\
+      if (yy->_tokens[mid].begin < at) lo= mid + 1;\n\
+      else hi= mid;\n\
+    }\n\
+  if (lo < yy->_tokencount && yy->_tokens[lo].begin == at) return yy->_tokens + (yy->_token= lo);\n\
+  pos= bestpos= yy->_pos;  thunkpos= yy->_thunkpos;  maxpos= yy->_maxpos;  begin= yy->_begin;  end= yy->_end;\n\
+  ++yy->_choices;\n\
+  for (kind= 1;  kind < YYTOKEN_COUNT;  ++kind)\n\
+    {\n\
+      if (yytokenrules[kind](yy) && yy->_pos > bestpos)\n\
+	{\n\
+	  best= kind;\n\
+	  bestpos= yy->_pos;\n\
+	}\n\
+      yy->_pos= pos;\n\
+      yy->_thunkpos= thunkpos;\n\
+    }\n\
+  --yy->_choices;\n\
+  yy->_maxpos= maxpos;  yy->_begin= begin;  yy->_end= end;\n\
+  yyprintf((stderr, \"token %d @ %d-%d\\n\", best, pos, bestpos));\n\
+  if (yy->_tokencount == yy->_tokenslen)\n\
+    {\n\
+      yy->_tokenslen= yy->_tokenslen ? 2 * yy->_tokenslen : YY_STACK_SIZE;\n\
+      yy->_tokens= (yytoken *)YY_REALLOC(yy, yy->_tokens, sizeof(yytoken) * yy->_tokenslen);\n\
+    }\n\
+  memmove(yy->_tokens + lo + 1, yy->_tokens + lo, sizeof(yytoken) * (yy->_tokencount++ - lo));\n\
+  yy->_tokens[lo].kind=  best;\n\
+  yy->_tokens[lo].begin= at;\n\
+  yy->_tokens[lo].end=   at + (bestpos - pos);\n\
+  return yy->_tokens + (yy->_token= lo);\n\
+}\n\
+\n\
+/* Match a token of the given kind by running its rule, for the actions. */\n\
+YY_LOCAL(int) yymatchToken(yycontext *yy, int kind, int (*rule)(yycontext *yy))\n\
+{\n\
+  return yyScanToken(yy)->kind == kind && rule(yy);\n\
+}\n\
+\n\
+/* Match a token of the given kind, whose rule has no effect but to move. */\n\
+YY_LOCAL(int) yyskipToken(yycontext *yy, int kind)\n\
+{\n\
+  yytoken *token= yyScanToken(yy);\n\
+  if (token->kind != kind) return 0;\n\
+  yy->_pos += token->end - token->begin;\n\
+  yyrecordMaxPos(yy);\n\
+  return 1;\n\
+}\n\
+\n\
+";
+
+static char *structuralRuntime= "\
+#if defined(__SSE2__)\n\
+#include <emmintrin.h>\n\
+#endif\n\
+\n\
+/* Index the structural characters in the buffer, one bit for each\n\
+ * byte, in blocks of 64 bytes up to the last complete block.\n\
+ */\n\
+YY_LOCAL(void) yyIndex(yycontext *yy)\n\
+{\n\
+  int end= yy->_limit & ~63, p, i;\n\
+  if ((end >> 6) > yy->_indexlen)\n\
+    {\n\
+      yy->_indexlen= (yy->_buflen >> 6) + 1;\n\
+      yy->_index= (uint64_t *)YY_REALLOC(yy, yy->_index, sizeof(uint64_t) * yy->_indexlen);\n\
+    }\n\
+  for (p= yy->_indexed;  p < end;  p += 64)\n\
+    {\n\
+      uint64_t bits= 0;\n\
+#if defined(__SSE2__)\n\
+      int k;\n\
+      for (k= 0;  k < 64;  k += 16)\n\
+	{\n\
+	  __m128i v= _mm_loadu_si128((const __m128i *)(yy->_buf + p + k)), m= _mm_setzero_si128();\n\
+	  for (i= 0;  i < yystructuralcount;  ++i)\n\
+	    m= _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(yystructurals[i])));\n\
+	  bits |= (uint64_t)(unsigned)_mm_movemask_epi8(m) << k;\n\
+	}\n\
+#else\n\
+      for (i= 0;  i < 64;  ++i)\n\
+	if (yyInClass(yystructural, yyByte(yy, p + i)))\n\
+	  bits |= (uint64_t)1 << i;\n\
+#endif\n\
+      yy->_index[p >> 6]= bits;\n\
+    }\n\
+  if (end > yy->_indexed)\n\
+    yy->_indexed= end;\n\
+}\n\
+\n\
+/* The position of the first structural character at or after p, if the\n\
+ * index reaches that far, otherwise p.\n\
+ */\n\
+YY_LOCAL(int) yyStructural(yycontext *yy, int p)\n\
+{\n\
+  if (p >= yy->_indexed)\n\
+    {\n\
+      if (yy->_limit - yy->_indexed < 64) return p;\n\
+      yyIndex(yy);\n\
+    }\n\
+  while (p < yy->_indexed)\n\
+    {\n\
+      uint64_t bits= yy->_index[p >> 6] >> (p & 63);\n\
+      if (bits)\n\
+	{\n\
+#ifdef __GNUC__\n\
+	  return p + __builtin_ctzll(bits);\n\
+#else\n\
+	  while (!(bits & 1)) ++p, bits >>= 1;\n\
+	  return p;\n\
+#endif\n\
+	}\n\
+      p= (p | 63) + 1;\n\
+    }\n\
+  return p;\n\
+}\n\
+\n\
+";
+
+static char *footer= "\n\
+\n\
+#ifndef YY_PART\n\
+\n\
+typedef int (*yyrule)(yycontext *yy);\n\
+\n\
+YY_LOCAL(void) yyInit(yycontext *yy)\n\
+{\n\
+  yy->_buflen= YY_BUFFER_SIZE;\n\
+  yy->_buf= (char *)YY_MALLOC(yy, yy->_buflen);\n\
+  yy->_textlen= YY_BUFFER_SIZE;\n\
+  yy->_text= (char *)YY_MALLOC(yy, yy->_textlen);\n\
+  yy->_thunkslen= YY_STACK_SIZE;\n\
+  yy->_thunks= (yythunk *)YY_MALLOC(yy, sizeof(yythunk) * yy->_thunkslen);\n\
+#ifdef __cplusplus\n\
+  yy->_vals = new std::vector<YYSTYPE>();\n\
+  yy->_vals->reserve(YY_STACK_SIZE);\n\
+#else\n\
+  yy->_valslen= YY_STACK_SIZE;\n\
+  yy->_vals= (YYSTYPE *)YY_MALLOC(yy, sizeof(YYSTYPE) * yy->_valslen);\n\
+  memset(yy->_vals, 0, sizeof(YYSTYPE) * yy->_valslen);\n\
+#endif\n\
+  yy->_begin= yy->_end= yy->_pos= yy->_limit= yy->_maxpos= yy->_thunkpos= 0;\n\
+}\n\
+\n\
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)\n\
+{\n\
+  int yyok, yystartthunk= 0;\n\
+  size_t yyoffset;\n\
+#ifdef YY_LIMITS\n\
+  int yystartpos;\n\
+#endif\n\
+  if (!yyctx->_buflen)\n\
+    yyInit(yyctx);\n\
+  yyctx->_begin= yyctx->_end= -1;		/* no text yet */\n\
+#ifdef YY_PARALLEL\n\
+  if (yyctx->_chunk) yystartthunk= yyctx->_thunkpos;	/* actions accumulate until the chunk is done */\n\
+#endif\n\
+  yyctx->_thunkpos= yystartthunk;\n\
+  yyctx->_choices= 0;\n\
+  yyctx->_frametop= 0;\n\
+  yyoffset= yyctx->_offset;\n\
+#ifdef YY_STRUCTURAL\n\
+  yyctx->_indexed= 0;\n\
+#endif\n\
+#ifdef YY_LIMITS\n\
+  yyctx->_error= yyctx->_depth= 0;\n\
+  yyctx->_stepcount= 0;\n\
+  yystartpos= yyctx->_pos;\n\
+  if (setjmp(yyctx->_abort))\n\
+    {\n\
+      if (YYLIMIT_CANCEL == yyctx->_error) yyctx->_cancel= 0;\n\
+      yyctx->_pos= (yyctx->_offset != yyoffset) ? 0 : yystartpos;\n\
+      yyctx->_thunkpos= yystartthunk;\n\
+#ifdef YY_PARALLEL\n\
+      if (yyctx->_chunk) return 0;\n\
+#endif\n\
+      yyCommit(yyctx);\n\
+#ifdef YY_EVENTS\n\
+      yyPost(yyctx, YYEVENT_END, 0, 0, 0, 0, 0);\n\
+#endif\n\
+      return 0;\n\
+    }\n\
+#endif\n\
+#ifdef __cplusplus\n\
+  yyctx->_vals->resize(1);\n\
+  yyctx->_val = &yyctx->_vals->back();\n\
+#else\n\
+  yyctx->_val= yyctx->_vals;\n\
+#endif\n\
+  yyok= yystart(yyctx);\n\
+#ifdef YY_PARALLEL\n\
+  if (yyctx->_chunk) return yyok;\n\
+#endif\n\
+  if (yyok) yyDone(yyctx);\n\
+  else if (yyctx->_offset != yyoffset) yyctx->_pos= 0;	/* start of parse already discarded */\n\
+  yyCommit(yyctx);\n\
+#ifdef YY_EVENTS\n\
+  yyPost(yyctx, YYEVENT_END, yyok, 0, 0, 0, 0);\n\
+#endif\n\
+  return yyok;\n\
+}\n\
+\n\
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)\n\
+{\n\
+  return YYPARSEFROM(YY_CTX_ARG_ yyr%s);\n\
+}\n\
+\n\
+#ifdef YY_LAZY\n\
+\n\
+/* Parse the text of a span that was skipped with the rule that it\n\
+ * belongs to.  Spans within it are recorded with their offsets in the\n\
+ * whole input.  Input that the parser has buffered is left alone.\n\
+ */\n\
+YY_PARSE(int) YYPARSESPAN(YY_CTX_PARAM_ const yyspan *yyspan, const char *yytext)\n\
+{\n\
+  char *yybuf;\n\
+  int yybuflen, yypos, yylimit, yymaxpos, yyok;\n\
+  size_t yyoffset;\n\
+  if (!yyctx->_buflen)\n\
+    yyInit(yyctx);\n\
+  yybuf= yyctx->_buf;  yybuflen= yyctx->_buflen;  yypos= yyctx->_pos;  yylimit= yyctx->_limit;\n\
+  yymaxpos= yyctx->_maxpos;  yyoffset= yyctx->_offset;\n\
+  yyctx->_limit= yyspan->end - yyspan->begin;\n\
+  yyctx->_buflen= yyctx->_limit + 1;\n\
+  yyctx->_buf= (char *)YY_MALLOC(yyctx, yyctx->_buflen);\n\
+  memcpy(yyctx->_buf, yytext, yyctx->_limit);\n\
+  yyctx->_pos= yyctx->_maxpos= 0;\n\
+  yyctx->_offset= yyspan->begin;\n\
+  yyctx->_spanning= 1;\n\
+  yyok= YYPARSEFROM(YY_CTX_ARG_ yylazyrules[yyspan->rule]) && !yyctx->_limit;\n\
+  yyctx->_spanning= 0;\n\
+  YY_FREE(yyctx, yyctx->_buf);\n\
+  yyctx->_buf= yybuf;  yyctx->_buflen= yybuflen;  yyctx->_pos= yypos;  yyctx->_limit= yylimit;\n\
+  yyctx->_maxpos= yymaxpos;  yyctx->_offset= yyoffset;\n\
+  return yyok;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+\n\
+#ifdef YY_COROUTINE\n\
+\n\
+/* The parser's stack.  Where anonymous mappings are available it sits\n\
+ * above a page that cannot be touched, so that a parse recursing too\n\
+ * deeply faults, as it would on the thread's own stack, instead of\n\
+ * writing over the heap.\n\
+ */\n\
+#ifdef MAP_ANONYMOUS\n\
+#define yyStackGuard()	((size_t)sysconf(_SC_PAGESIZE))\n\
+#define yyStackSize()	((YY_COROUTINE_STACK_SIZE + yyStackGuard() - 1) / yyStackGuard() * yyStackGuard())\n\
+\n\
+YY_LOCAL(char *) yyStackAlloc(yycontext *yy)\n\
+{\n\
+  char *stack= (char *)mmap(0, yyStackGuard() + yyStackSize(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);\n\
+  if (MAP_FAILED == stack) return 0;\n\
+  if (mprotect(stack, yyStackGuard(), PROT_NONE))\n\
+    {\n\
+      munmap(stack, yyStackGuard() + yyStackSize());\n\
+      return 0;\n\
+    }\n\
+  return stack;\n\
+}\n\
+\n\
+#define yyStackFree(yy, stack)	munmap((stack), yyStackGuard() + yyStackSize())\n\
+#else\n\
+#define yyStackGuard()		0\n\
+#define yyStackSize()		YY_COROUTINE_STACK_SIZE\n\
+#define yyStackAlloc(yy)	(char *)YY_MALLOC((yy), YY_COROUTINE_STACK_SIZE)\n\
+#define yyStackFree(yy, stack)	YY_FREE((yy), (stack))\n\
+#endif\n\
+\n\
+static void yyCoroutine(unsigned int yyhi, unsigned int yylo)\n\
+{\n\
+  yycontext *yyctx= (yycontext *)((((uintptr_t)yyhi << 16) << 16) | (uintptr_t)yylo);\n\
+  for (;;)\n\
+    {\n\
+      yyctx->_status= YYPARSEFROM(YY_CTX_ARG_ yyr%s) ? YYPARSE_ACCEPT : YYPARSE_REJECT;\n\
+      swapcontext(&yyctx->_parser, &yyctx->_caller);\n\
+    }\n\
+}\n\
+\n\
+YY_LOCAL(int) yyResume(yycontext *yy)\n\
+{\n\
+  if (!yy->_stack)\n\
+    {\n\
+      uintptr_t yyarg= (uintptr_t)yy;\n\
+      if (!(yy->_stack= yyStackAlloc(yy)))\n\
+	return YYPARSE_REJECT;\n\
+      getcontext(&yy->_parser);\n\
+      yy->_parser.uc_stack.ss_sp= yy->_stack + yyStackGuard();\n\
+      yy->_parser.uc_stack.ss_size= yyStackSize();\n\
+      yy->_parser.uc_link= 0;\n\
+      makecontext(&yy->_parser, (void (*)(void))yyCoroutine, 2, (unsigned int)((yyarg >> 16) >> 16), (unsigned int)yyarg);\n\
+    }\n\
+#ifdef YY_QUOTA\n\
+  yy->_steps= yy->_quota;\n\
+#endif\n\
+  swapcontext(&yy->_caller, &yy->_parser);\n\
+  return yy->_status;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+#ifdef YY_PUSH\n\
+\n\
+YY_PARSE(int) YYPUSH(YY_CTX_PARAM_ const char *yychunk, int yylen, int yyfinal)\n\
+{\n\
+  if (!yyctx->_buflen)\n\
+    yyInit(yyctx);\n\
+#ifdef YY_LIMITS\n\
+  if (yyctx->_maxbuf && yyctx->_limit + yylen >= yyctx->_maxbuf)\n\
+    {\n\
+      yyctx->_error= YYLIMIT_BUFFER;\n\
+      return YYPARSE_REJECT;\n\
+    }\n\
+#endif\n\
+  while (yyctx->_buflen - yyctx->_limit <= yylen)\n\
+    {\n\
+      yyctx->_buflen *= 2;\n\
+#ifdef YY_LIMITS\n\
+      if (yyctx->_maxbuf && yyctx->_buflen > yyctx->_maxbuf)\n\
+	yyctx->_buflen= yyctx->_maxbuf;\n\
+#endif\n\
+      yyctx->_buf= (char *)YY_REALLOC(yyctx, yyctx->_buf, yyctx->_buflen);\n\
+    }\n\
+  memcpy(yyctx->_buf + yyctx->_limit, yychunk, yylen);\n\
+  yyctx->_limit += yylen;\n\
+  yyctx->_final= yyfinal;\n\
+  return yyResume(yyctx);\n\
+}\n\
+\n\
+#endif\n\
+\n\
+#ifdef YY_LIMITS\n\
+\n\
+YY_PARSE(void) YYCANCEL(YY_CTX_PARAM)\n\
+{\n\
+#ifdef __GNUC__\n\
+  __atomic_store_n(&yyctx->_cancel, 1, __ATOMIC_RELAXED);\n\
+#else\n\
+  *(volatile int *)&yyctx->_cancel= 1;\n\
+#endif\n\
+}\n\
+\n\
+#endif\n\
+\n\
+#ifdef YY_QUOTA\n\
+\n\
+YY_PARSE(int) YYPARSEQUOTA(YY_CTX_PARAM_ int yysteps)\n\
+{\n\
+  if (!yyctx->_buflen)\n\
+    yyInit(yyctx);\n\
+  yyctx->_quota= yysteps;\n\
+  return yyResume(yyctx);\n\
+}\n\
+\n\
+#endif\n\
+\n\
+/* Forget the last parse and any input left in the buffer, keeping the\n\
+ * storage that the context has grown, so that the next parse starts\n\
+ * afresh without allocating.\n\
+ */\n\
+YY_PARSE(void) YYRESET(YY_CTX_PARAM)\n\
+{\n\
+  yyctx->_begin= yyctx->_end= yyctx->_pos= yyctx->_limit= yyctx->_maxpos= yyctx->_thunkpos= yyctx->_choices= 0;\n\
+  yyctx->_offset= 0;\n\
+#ifdef YY_PUSH\n\
+  yyctx->_final= 0;\n\
+#endif\n\
+#ifdef YY_LIMITS\n\
+  yyctx->_error= yyctx->_cancel= 0;\n\
+#endif\n\
+#ifdef YY_TOKENS\n\
+  yyctx->_tokencount= yyctx->_token= 0;\n\
+#endif\n\
+#ifdef YY_LAZY\n\
+  yyctx->_spancount= 0;\n\
+#endif\n\
+#ifdef YY_STRUCTURAL\n\
+  yyctx->_indexed= 0;\n\
+#endif\n\
+#ifdef YY_SEGMENTS\n\
+  if (yyctx->_ownbuf)\n\
+    yySegmentsOwn(yyctx);\n\
+  yyctx->_segments= 0;\n\
+  yyctx->_segmentcount= 0;\n\
+#endif\n\
+}\n\
+\n\
+YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)\n\
+{\n\
+#ifdef YY_SEGMENTS\n\
+  if (yyctx->_ownbuf)\n\
+    yySegmentsOwn(yyctx);\n\
+#endif\n\
+  if (yyctx->_buflen)\n\
+    {\n\
+      yyctx->_buflen= 0;\n\
+      YY_FREE(yyctx, yyctx->_buf);\n\
+      YY_FREE(yyctx, yyctx->_text);\n\
+      YY_FREE(yyctx, yyctx->_thunks);\n\
+#ifdef __cplusplus\n\
+      delete yyctx->_vals;\n\
+#else\n\
+      YY_FREE(yyctx, yyctx->_vals);\n\
+#endif\n\
+    }\n\
+  if (yyctx->_frames)\n\
+    {\n\
+      YY_FREE(yyctx, yyctx->_frames);\n\
+      yyctx->_frames= 0;\n\
+      yyctx->_frameslen= 0;\n\
+    }\n\
+#ifdef YY_COROUTINE\n\
+  if (yyctx->_stack)\n\
+    {\n\
+      yyStackFree(yyctx, yyctx->_stack);\n\
+      yyctx->_stack= 0;\n\
+    }\n\
+#endif\n\
+#ifdef YY_STRUCTURAL\n\
+  if (yyctx->_index)\n\
+    {\n\
+      YY_FREE(yyctx, yyctx->_index);\n\
+      yyctx->_index= 0;\n\
+      yyctx->_indexlen= yyctx->_indexed= 0;\n\
+    }\n\
+#endif\n\
+#ifdef YY_LAZY\n\
+  if (yyctx->_spans)\n\
+    {\n\
+      YY_FREE(yyctx, yyctx->_spans);\n\
+      yyctx->_spans= 0;\n\
+      yyctx->_spanslen= yyctx->_spancount= 0;\n\
+    }\n\
+#endif\n\
+#ifdef YY_TOKENS\n\
+  if (yyctx->_tokens)\n\
+    {\n\
+      YY_FREE(yyctx, yyctx->_tokens);\n\
+      yyctx->_tokens= 0;\n\
+      yyctx->_tokenslen= yyctx->_tokencount= yyctx->_token= 0;\n\
+    }\n\
+#endif\n\
+#ifdef YY_READAHEAD\n\
+  if (yyctx->_ahead)\n\
+    {\n\
+      yyAheadStop(yyctx, yyctx->_ahead);\n\
+      yyctx->_ahead= 0;\n\
+    }\n\
+#endif\n\
+#ifdef YY_EVENTS\n\
+  for (;  yyctx->_ringtail != yyctx->_ringhead;  ++yyctx->_ringtail)	/* events never taken */\n\
+    {\n\
+      yyevent *yyevent= &yyctx->_ring[yyctx->_ringtail & (YY_EVENT_RING - 1)];\n\
+      if (YYEVENT_UNPIN == yyevent->kind)\n\
+	YY_FREE(yyctx, (char *)yyevent->text);\n\
+    }\n\
+  if (yyctx->_ring)\n\
+    {\n\
+      YY_FREE(yyctx, yyctx->_ring);\n\
+      yyctx->_ring= 0;\n\
+    }\n\
+  if (yyctx->_pinned)\n\
+    {\n\
+      YY_FREE(yyctx, (char *)yyctx->_pinned);\n\
+      yyctx->_pinned= 0;\n\
+    }\n\
+#endif\n\
+  return yyctx;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyrecordMaxPos(yycontext *yy)\n\
+#ifdef YY_EVENTS\n\
+\n\
+/* Take the next event that the parser has posted into event, waiting\n\
+ * for one if wait is non-zero.  Return zero if there is none.  The text\n\
+ * of an event remains valid until the next call.\n\
+ */\n\
+YY_PARSE(int) YYNEXTEVENT(YY_CTX_PARAM_ yyevent *yyevent, int yywait)\n\
 {\n\
-  if (yy->_pos > yy->_maxpos) {\n\
-    yy->_maxpos = yy->_pos;\n\
-    yyprintf((stderr, \"       maxpos=%d [after '%c']\\n\", yy->_maxpos, yy->_buf[yy->_maxpos-1]));\n\
-  }\n\
+  for (;;)\n\
+    {\n\
+      unsigned yytail= yyctx->_ringtail, yyhead;\n\
+      while (yytail == (yyhead= yyLoadAcquire(&yyctx->_ringhead)))\n\
+	{\n\
+	  if (!yywait) return 0;\n\
+	  yyRingWait(&yyctx->_ringhead, yyhead, &yyctx->_headwait);\n\
+	}\n\
+      *yyevent= yyctx->_ring[yytail & (YY_EVENT_RING - 1)];\n\
+      yyStoreOrdered(&yyctx->_ringtail, yytail + 1);\n\
+      yyRingWake(&yyctx->_ringtail, &yyctx->_tailwait);\n\
+      if (YYEVENT_UNPIN != yyevent->kind)\n\
+	return 1;\n\
+      if (yyctx->_pinned)			/* every event that uses it has been seen */\n\
+	YY_FREE(yyctx, (char *)yyctx->_pinned);\n\
+      yyctx->_pinned= yyevent->text;\n\
+    }\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchDot(yycontext *yy)\n\
+#endif\n\
+\n\
+#ifdef YY_RECORDS\n\
+\n\
+YY_LOCAL(double) yySeconds(void)\n\
 {\n\
-  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
-  ++yy->_pos;\n\
-  yyrecordMaxPos(yy);\n\
-  return 1;\n\
+#ifdef CLOCK_MONOTONIC\n\
+  struct timespec t;\n\
+  clock_gettime(CLOCK_MONOTONIC, &t);\n\
+  return t.tv_sec + t.tv_nsec / 1e9;\n\
+#else\n\
+  return (double)clock() / CLOCKS_PER_SEC;\n\
+#endif\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchChar(yycontext *yy, int c)\n\
+/* Parse each record of text, up to but not including its separator,\n\
+ * from the start rule, and return the number that matched.  The\n\
+ * context's buffer only grows to hold the longest record, and each\n\
+ * record is parsed with its offset in text.\n\
+ */\n\
+YY_PARSE(long) YYPARSERECORDS(YY_CTX_PARAM_ const char *yytext, size_t yylen)\n\
 {\n\
-  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
-  if ((unsigned char)yy->_buf[yy->_pos] == c)\n\
+  double      yystart= yySeconds();\n\
+  size_t      yypos= 0;\n\
+  long	      yyn= 0;\n\
+  const char *yyeol;\n\
+  int	      yyreclen;\n\
+  if (!yyctx->_buflen)\n\
+    yyInit(yyctx);\n\
+  yyctx->_document= 1;\n\
+  while (yypos < yylen)\n\
     {\n\
-      ++yy->_pos;\n\
-      yyrecordMaxPos(yy);\n\
-      yyprintf((stderr, \"  ok   yymatchChar(yy, %c) @ %s\\n\", c, yy->_buf+yy->_pos));\n\
-      return 1;\n\
+      yyeol= (const char *)memchr(yytext + yypos, YY_RECORD_SEPARATOR, yylen - yypos);\n\
+      yyreclen= (int)((yyeol ? (size_t)(yyeol - yytext) : yylen) - yypos);\n\
+      if (yyreclen >= yyctx->_buflen)\n\
+	{\n\
+	  while (yyreclen >= yyctx->_buflen) yyctx->_buflen *= 2;\n\
+	  yyctx->_buf= (char *)YY_REALLOC(yyctx, yyctx->_buf, yyctx->_buflen);\n\
+	}\n\
+      memcpy(yyctx->_buf, yytext + yypos, yyreclen);\n\
+      yyctx->_pos= yyctx->_maxpos= 0;\n\
+      yyctx->_limit= yyreclen;\n\
+      yyctx->_offset= yypos;\n\
+      if (YYPARSE(YY_CTX_ARG))\n\
+	++yyn;\n\
+      else\n\
+	++yyctx->_rejected;\n\
+      yypos += yyreclen + (yyeol != 0);\n\
     }\n\
-  yyprintf((stderr, \"  fail yymatchChar(yy, %c) @ %s\\n\", c, yy->_buf+yy->_pos));\n\
-  return 0;\n\
+  yyctx->_limit= yyctx->_pos= 0;\n\
+  yyctx->_document= 0;\n\
+  yyctx->_records += yyn;\n\
+  yyctx->_seconds += yySeconds() - yystart;\n\
+  return yyn;\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchString(yycontext *yy, const char *s)\n\
+/* The number of records matched for each second spent in\n\
+ * yyparserecords, over all of its calls with this context.\n\
+ */\n\
+YY_PARSE(double) YYRECORDRATE(YY_CTX_PARAM)\n\
 {\n\
-  int yysav= yy->_pos;\n\
-  while (*s)\n\
+  return (yyctx->_seconds > 0) ? yyctx->_records / yyctx->_seconds : 0;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+#ifdef YY_PARALLEL\n\
+\n\
+/* Parsing a large input of independent records in parallel.  The input\n\
+ * is split into chunks at record boundaries, each chunk is parsed into\n\
+ * a context of its own by a pool of threads, and then the actions of\n\
+ * every chunk are run in the caller's context in the order of the\n\
+ * input.\n\
+ */\n\
+\n\
+typedef struct _yychunk\n\
+{\n\
+  yycontext ctx;\n\
+  size_t    begin, end;\n\
+  int	    ok;\n\
+} yychunk;\n\
+\n\
+typedef struct _yyparallel\n\
+{\n\
+  const char	 *text;\n\
+  yychunk	 *chunks;\n\
+  int		  count, next;\n\
+  pthread_mutex_t lock;\n\
+} yyparallel;\n\
+\n\
+/* The position just after the first separator at or after pos. */\n\
+YY_LOCAL(size_t) yySync(const char *text, size_t len, size_t pos, int sep)\n\
+{\n\
+  const char *p= (pos < len) ? (const char *)memchr(text + pos, sep, len - pos) : 0;\n\
+  return p ? (size_t)(p - text) + 1 : len;\n\
+}\n\
+\n\
+YY_LOCAL(void) yyParseChunk(yychunk *chunk, const char *text)\n\
+{\n\
+  yycontext *yy= &chunk->ctx;\n\
+  int len= (int)(chunk->end - chunk->begin), pos;\n\
+  yyInit(yy);\n\
+  if (yy->_buflen <= len)\n\
     {\n\
-      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
-      if (yy->_buf[yy->_pos] != *s)\n\
+      yy->_buflen= len + 1;\n\
+      yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);\n\
+    }\n\
+  memcpy(yy->_buf, text + chunk->begin, len);\n\
+  yy->_limit= len;\n\
+  yy->_offset= chunk->begin;\n\
+  yy->_chunk= 1;\n\
+  chunk->ok= 1;\n\
+  while (yy->_pos < yy->_limit)\n\
+    {\n\
+      pos= yy->_pos;\n\
+      if (!YYPARSE(yy) || yy->_pos == pos)\n\
 	{\n\
-	  yy->_pos= yysav;\n\
-	  return 0;\n\
+	  chunk->ok= 0;\n\
+	  break;\n\
 	}\n\
-      ++s;\n\
-      ++yy->_pos;\n\
     }\n\
-  yyrecordMaxPos(yy);\n\
-  return 1;\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchIString(yycontext *yy, const char *s)\n\
+static void *yyParallelWorker(void *arg)\n\
 {\n\
-  int yysav= yy->_pos;\n\
-  while (*s)\n\
+  yyparallel *yyp= (yyparallel *)arg;\n\
+  for (;;)\n\
     {\n\
-      if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
-      if (tolower(yy->_buf[yy->_pos]) != *s)\n\
-        {\n\
-          yy->_pos= yysav;\n\
-          return 0;\n\
-        }\n\
-      ++s;\n\
-      ++yy->_pos;\n\
+      int i;\n\
+      pthread_mutex_lock(&yyp->lock);\n\
+      i= yyp->next++;\n\
+      pthread_mutex_unlock(&yyp->lock);\n\
+      if (i >= yyp->count) return 0;\n\
+      yyParseChunk(&yyp->chunks[i], yyp->text);\n\
     }\n\
-  yyrecordMaxPos(yy);\n\
-  return 1;\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchClass(yycontext *yy, unsigned char *bits)\n\
+/* Run the actions of a parsed chunk in the caller's context. */\n\
+YY_LOCAL(void) yyChunkDone(yycontext *yy, yycontext *chunk)\n\
 {\n\
-  int c;\n\
-  if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;\n\
-  c= (unsigned char)yy->_buf[yy->_pos];\n\
-  if (bits[c >> 3] & (1 << (c & 7)))\n\
+  char	  *buf= yy->_buf;\n\
+  int	   buflen= yy->_buflen, thunkslen= yy->_thunkslen;\n\
+  yythunk *thunks= yy->_thunks;\n\
+  size_t   offset= yy->_offset;\n\
+  yy->_buf= chunk->_buf;  yy->_buflen= chunk->_buflen;  yy->_offset= chunk->_offset;\n\
+  yy->_thunks= chunk->_thunks;  yy->_thunkslen= chunk->_thunkslen;  yy->_thunkpos= chunk->_thunkpos;\n\
+#ifdef __cplusplus\n\
+  yy->_vals->resize(1);\n\
+  yy->_val = &yy->_vals->back();\n\
+#else\n\
+  yy->_val= yy->_vals;\n\
+#endif\n\
+  yyDone(yy);\n\
+  yy->_buf= buf;  yy->_buflen= buflen;  yy->_offset= offset;\n\
+  yy->_thunks= thunks;  yy->_thunkslen= thunkslen;\n\
+}\n\
+\n\
+/* Parse the records in text with up to threads threads (if zero or\n\
+ * less, one for each processor) and run their actions in order.  Return\n\
+ * non-zero if every record matched.  Otherwise the actions of the\n\
+ * records before the first that failed have been run, and the context's\n\
+ * _offset is the position in text of that record.\n\
+ */\n\
+YY_PARSE(int) YYPARSEPARALLEL(yycontext *yyctx, const char *yytext, size_t yylen, int yythreads)\n\
+{\n\
+  yyparallel yyp;\n\
+  pthread_t *yyworkers;\n\
+  size_t     yypos;\n\
+  int	     yyok= 1, yyn= 0, i;\n\
+  if (!yyctx->_buflen)\n\
+    yyInit(yyctx);\n\
+  if (yythreads <= 0 && (yythreads= (int)sysconf(_SC_NPROCESSORS_ONLN)) <= 0)\n\
+    yythreads= 1;\n\
+  yyp.count= yythreads * YY_PARALLEL_CHUNKS;\n\
+  if ((size_t)yyp.count > yylen / YY_PARALLEL_MIN_CHUNK + 1)\n\
+    yyp.count= (int)(yylen / YY_PARALLEL_MIN_CHUNK + 1);\n\
+  if ((size_t)yyp.count < yylen / (1 << 30) + 1)\n\
+    yyp.count= (int)(yylen / (1 << 30) + 1);		/* positions in a chunk are ints */\n\
+  yyp.text= yytext;\n\
+  yyp.next= 0;\n\
+  yyp.chunks= (yychunk *)YY_MALLOC(yyctx, sizeof(yychunk) * yyp.count);\n\
+  memset(yyp.chunks, 0, sizeof(yychunk) * yyp.count);\n\
+  for (yypos= 0, i= 0;  i < yyp.count;  ++i)\n\
     {\n\
-      ++yy->_pos;\n\
-      yyrecordMaxPos(yy);\n\
-      yyprintf((stderr, \"  ok   yymatchClass @ %s\\n\", yy->_buf+yy->_pos));\n\
-      return 1;\n\
+      yyp.chunks[i].begin= yypos;\n\
+      if (i == yyp.count - 1)\n\
+	yypos= yylen;\n\
+      else if (yypos < yylen / yyp.count * (i + 1))\n\
+	yypos= YY_PARALLEL_SYNC(yytext, yylen, yylen / yyp.count * (i + 1));\n\
+      yyp.chunks[i].end= yypos;\n\
+      YY_PARALLEL_INIT(&yyp.chunks[i].ctx, yyctx);\n\
+    }\n\
+  pthread_mutex_init(&yyp.lock, 0);\n\
+  if (yythreads > yyp.count) yythreads= yyp.count;\n\
+  yyworkers= (pthread_t *)YY_MALLOC(yyctx, sizeof(pthread_t) * yythreads);\n\
+  while (yyn < yythreads - 1 && !pthread_create(&yyworkers[yyn], 0, yyParallelWorker, &yyp))\n\
+    ++yyn;\n\
+  yyParallelWorker(&yyp);\n\
+  for (i= 0;  i < yyn;  ++i)\n\
+    pthread_join(yyworkers[i], 0);\n\
+  pthread_mutex_destroy(&yyp.lock);\n\
+  for (i= 0;  i < yyp.count;  ++i)\n\
+    {\n\
+      yycontext *yychunkctx= &yyp.chunks[i].ctx;\n\
+      if (yyok)\n\
+	{\n\
+	  yyChunkDone(yyctx, yychunkctx);\n\
+	  if (!(yyok= yyp.chunks[i].ok))\n\
+	    yyctx->_offset= yychunkctx->_offset + yychunkctx->_pos;\n\
+	}\n\
+      YYRELEASE(yychunkctx);\n\
+    }\n\
+  YY_FREE(yyctx, yyworkers);\n\
+  YY_FREE(yyctx, yyp.chunks);\n\
+  return yyok;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+#ifdef YY_BATCH\n\
+\n\
+/* Parsing many independent documents on a pool of threads.  Each\n\
+ * worker owns a range of the documents and a context that it reuses for\n\
+ * all of them; a worker whose range is empty steals the upper half of\n\
+ * the range of another.\n\
+ */\n\
+\n\
+typedef struct _yydocument\n\
+{\n\
+  const char *text;\n\
+  size_t      len;\n\
+} yydocument;\n\
+\n\
+typedef struct _yybatch yybatch;\n\
+\n\
+typedef struct _yybatchworker\n\
+{\n\
+  yycontext	  ctx;\n\
+  yybatch	 *batch;\n\
+  int		  next, end;	/* the documents not yet taken */\n\
+  int		  ok;\n\
+  pthread_mutex_t lock;\n\
+} yybatchworker;\n\
+\n\
+struct _yybatch\n\
+{\n\
+  const yydocument *docs;\n\
+  yybatchworker	   *workers;\n\
+  int		    count;\n\
+  void		  (*callback)(yycontext *yy, int doc, int ok);\n\
+};\n\
+\n\
+YY_LOCAL(int) yyParseDocument(yycontext *yy, const yydocument *doc)\n\
+{\n\
+  int len= (int)doc->len;\n\
+  if (!yy->_buflen)\n\
+    yyInit(yy);\n\
+  if (yy->_buflen <= len)\n\
+    {\n\
+      yy->_buflen= len + 1;\n\
+      yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);\n\
+    }\n\
+  memcpy(yy->_buf, doc->text, len);\n\
+  yy->_pos= yy->_maxpos= 0;\n\
+  yy->_limit= len;\n\
+  yy->_offset= 0;\n\
+  yy->_document= 1;\n\
+#ifdef YY_TOKENS\n\
+  yy->_tokencount= yy->_token= 0;\n\
+#endif\n\
+#ifdef YY_LAZY\n\
+  yy->_spancount= 0;\n\
+#endif\n\
+  return YYPARSE(yy);\n\
+}\n\
+\n\
+YY_LOCAL(int) yyTakeDocument(yybatch *yyb, yybatchworker *self)\n\
+{\n\
+  int doc= -1, end= 0, i;\n\
+  pthread_mutex_lock(&self->lock);\n\
+  if (self->next < self->end) doc= self->next++;\n\
+  pthread_mutex_unlock(&self->lock);\n\
+  for (i= 1;  doc < 0 && i < yyb->count;  ++i)\n\
+    {\n\
+      yybatchworker *victim= &yyb->workers[(self - yyb->workers + i) %% yyb->count];\n\
+      pthread_mutex_lock(&victim->lock);\n\
+      if (victim->next < victim->end)\n\
+	{\n\
+	  end= victim->end;\n\
+	  doc= victim->end= victim->next + (victim->end - victim->next) / 2;\n\
+	}\n\
+      pthread_mutex_unlock(&victim->lock);\n\
+      if (doc >= 0)\n\
+	{\n\
+	  pthread_mutex_lock(&self->lock);\n\
+	  self->next= doc + 1;\n\
+	  self->end= end;\n\
+	  pthread_mutex_unlock(&self->lock);\n\
+	}\n\
+    }\n\
+  return doc;\n\
+}\n\
+\n\
+static void *yyBatchWorker(void *arg)\n\
+{\n\
+  yybatchworker *self= (yybatchworker *)arg;\n\
+  yybatch	*yyb= self->batch;\n\
+  int		 doc, ok;\n\
+  while ((doc= yyTakeDocument(yyb, self)) >= 0)\n\
+    {\n\
+      self->ok += (ok= yyParseDocument(&self->ctx, &yyb->docs[doc]));\n\
+      if (yyb->callback) yyb->callback(&self->ctx, doc, ok);\n\
     }\n\
-  yyprintf((stderr, \"  fail yymatchClass @ %s\\n\", yy->_buf+yy->_pos));\n\
   return 0;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)\n\
-{\n\
-  while (yy->_thunkpos >= yy->_thunkslen)\n\
-    {\n\
-      yy->_thunkslen *= 2;\n\
-      yy->_thunks= (yythunk *)YY_REALLOC(yy, yy->_thunks, sizeof(yythunk) * yy->_thunkslen);\n\
-    }\n\
-  yy->_thunks[yy->_thunkpos].begin=  begin;\n\
-  yy->_thunks[yy->_thunkpos].end=    end;\n\
-  yy->_thunks[yy->_thunkpos].action= action;\n\
-  ++yy->_thunkpos;\n\
-}\n\
+/* Parse each of the n documents with up to threads threads (if zero or\n\
+ * less, one for each processor), calling callback (if not null) on the\n\
+ * worker's thread with the worker's context after each document, and\n\
+ * return the number of documents for which the start rule matched.\n\
+ */\n\
+YY_PARSE(int) YYPARSEBATCH(yycontext *yyctx, const yydocument *yydocs, int yyn, int yythreads, void (*yycallback)(yycontext *yy, int yydoc, int yyok))\n\
+{\n\
+  yybatch    yyb;\n\
+  pthread_t *yyids;\n\
+  int	     yyok= 0, yystarted, i;\n\
+  if (yythreads <= 0 && (yythreads= (int)sysconf(_SC_NPROCESSORS_ONLN)) <= 0)\n\
+    yythreads= 1;\n\
+  if (yythreads > yyn) yythreads= yyn;\n\
+  if (yythreads < 1) return 0;\n\
+  yyb.docs= yydocs;\n\
+  yyb.count= yythreads;\n\
+  yyb.callback= yycallback;\n\
+  yyb.workers= (yybatchworker *)YY_MALLOC(yyctx, sizeof(yybatchworker) * yythreads);\n\
+  memset(yyb.workers, 0, sizeof(yybatchworker) * yythreads);\n\
+  yyids= (pthread_t *)YY_MALLOC(yyctx, sizeof(pthread_t) * yythreads);\n\
+  for (i= 0;  i < yythreads;  ++i)\n\
+    {\n\
+      yybatchworker *w= &yyb.workers[i];\n\
+      w->batch= &yyb;\n\
+      w->next= (int)((long long)yyn * i / yythreads);\n\
+      w->end=  (int)((long long)yyn * (i + 1) / yythreads);\n\
+      pthread_mutex_init(&w->lock, 0);\n\
+      YY_BATCH_INIT(&w->ctx, yyctx);\n\
+    }\n\
+  for (yystarted= 1;  yystarted < yythreads;  ++yystarted)	/* a worker that cannot start is robbed by the others */\n\
+    if (pthread_create(&yyids[yystarted], 0, yyBatchWorker, &yyb.workers[yystarted]))\n\
+      break;\n\
+  yyBatchWorker(&yyb.workers[0]);\n\
+  for (i= 1;  i < yystarted;  ++i)\n\
+    pthread_join(yyids[i], 0);\n\
+  for (i= 0;  i < yythreads;  ++i)\n\
+    {\n\
+      yyok += yyb.workers[i].ok;\n\
+      pthread_mutex_destroy(&yyb.workers[i].lock);\n\
+      YYRELEASE(&yyb.workers[i].ctx);\n\
+    }\n\
+  YY_FREE(yyctx, yyids);\n\
+  YY_FREE(yyctx, yyb.workers);\n\
+  return yyok;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+#ifdef YY_POOL\n\
+\n\
+/* A fixed set of contexts, initialised once, that threads take and give\n\
+ * back without locking.  The free list is a stack of indices whose head\n\
+ * carries a generation count, so that a context taken and given back\n\
+ * between another thread's read of the head and its update of it cannot\n\
+ * corrupt the list.\n\
+ */\n\
+\n\
+typedef struct _yypool\n\
+{\n\
+  yycontext *owner;\n\
+  yycontext *contexts;\n\
+  int	    *next;		/* the free list, as indices plus one */\n\
+  int	     count;\n\
+  uint64_t   head;		/* a generation count and the first free index plus one */\n\
+#ifndef __GNUC__\n\
+  pthread_mutex_t lock;\n\
+#endif\n\
+} yypool;\n\
+\n\
+/* Make count contexts, each initialised from yyctx and with room for\n\
+ * buffer bytes of input.\n\
+ */\n\
+YY_PARSE(yypool *) YYPOOLCREATE(yycontext *yyctx, int yycount, int yybuffer)\n\
+{\n\
+  yypool *yyp= (yypool *)YY_MALLOC(yyctx, sizeof(yypool));\n\
+  int	  i;\n\
+  yyp->owner= yyctx;\n\
+  yyp->count= yycount;\n\
+  yyp->contexts= (yycontext *)YY_MALLOC(yyctx, sizeof(yycontext) * yycount);\n\
+  yyp->next= (int *)YY_MALLOC(yyctx, sizeof(int) * yycount);\n\
+  memset(yyp->contexts, 0, sizeof(yycontext) * yycount);\n\
+  for (i= 0;  i < yycount;  ++i)\n\
+    {\n\
+      yycontext *yy= &yyp->contexts[i];\n\
+      YY_POOL_INIT(yy, yyctx);\n\
+      yyInit(yy);\n\
+#ifdef YY_FRAMES\n\
+      yyGrowFrames(yy, YY_STACK_SIZE);\n\
+#endif\n\
+      if (yybuffer > yy->_buflen)\n\
+	{\n\
+	  yy->_buflen= yybuffer;\n\
+	  yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);\n\
+	}\n\
+      yyp->next[i]= i + 2 <= yycount ? i + 2 : 0;\n\
+    }\n\
+  yyp->head= yycount ? 1 : 0;\n\
+#ifndef __GNUC__\n\
+  pthread_mutex_init(&yyp->lock, 0);\n\
+#endif\n\
+  return yyp;\n\
+}\n\
+\n\
+/* Take a context from the pool, or return null if all are in use. */\n\
+YY_PARSE(yycontext *) YYPOOLACQUIRE(yypool *yyp)\n\
+{\n\
+  uint64_t head, next;\n\
+  int	   i;\n\
+#ifdef __GNUC__\n\
+  head= __atomic_load_n(&yyp->head, __ATOMIC_ACQUIRE);\n\
+  do\n\
+    {\n\
+      if (!(i= (int)(uint32_t)head)) return 0;\n\
+      next= (((head >> 32) + 1) << 32) | (uint32_t)__atomic_load_n(&yyp->next[i - 1], __ATOMIC_RELAXED);\n\
+    }\n\
+  while (!__atomic_compare_exchange_n(&yyp->head, &head, next, 1, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));\n\
+#else\n\
+  pthread_mutex_lock(&yyp->lock);\n\
+  head= yyp->head;\n\
+  if ((i= (int)(uint32_t)head))\n\
+    yyp->head= (((head >> 32) + 1) << 32) | (uint32_t)yyp->next[i - 1];\n\
+  pthread_mutex_unlock(&yyp->lock);\n\
+  if (!i) return 0;\n\
+#endif\n\
+  return &yyp->contexts[i - 1];\n\
+}\n\
+\n\
+/* Give a context back to the pool, ready for its next parse. */\n\
+YY_PARSE(void) YYPOOLRELEASE(yypool *yyp, yycontext *yyctx)\n\
+{\n\
+  uint64_t head, next;\n\
+  int	   i= (int)(yyctx - yyp->contexts) + 1;\n\
+  YYRESET(yyctx);\n\
+  YY_POOL_RESET(yyctx);\n\
+#ifdef __GNUC__\n\
+  head= __atomic_load_n(&yyp->head, __ATOMIC_RELAXED);\n\
+  do\n\
+    {\n\
+      __atomic_store_n(&yyp->next[i - 1], (int)(uint32_t)head, __ATOMIC_RELAXED);\n\
+      next= (((head >> 32) + 1) << 32) | (uint32_t)i;\n\
+    }\n\
+  while (!__atomic_compare_exchange_n(&yyp->head, &head, next, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));\n\
+#else\n\
+  pthread_mutex_lock(&yyp->lock);\n\
+  yyp->next[i - 1]= (int)(uint32_t)yyp->head;\n\
+  yyp->head= (((yyp->head >> 32) + 1) << 32) | (uint32_t)i;\n\
+  pthread_mutex_unlock(&yyp->lock);\n\
+#endif\n\
+}\n\
+\n\
+/* Release every context, none of which may be in use, and the pool. */\n\
+YY_PARSE(void) YYPOOLDESTROY(yypool *yyp)\n\
+{\n\
+  int i;\n\
+  for (i= 0;  i < yyp->count;  ++i)\n\
+    YYRELEASE(&yyp->contexts[i]);\n\
+#ifndef __GNUC__\n\
+  pthread_mutex_destroy(&yyp->lock);\n\
+#endif\n\
+  YY_FREE(yyp->owner, yyp->next);\n\
+  YY_FREE(yyp->owner, yyp->contexts);\n\
+  YY_FREE(yyp->owner, yyp);\n\
+}\n\
+\n\
+#endif\n\
+\n\
+\n\
+#endif\n\
+";
+
+static char *cppHeader= "\
+#include <cctype>\n\
+#include <cstdio>\n\
+#include <cstdlib>\n\
+#include <cstring>\n\
+#include <utility>\n\
+#include <vector>\n\
+";
+
+static char *cppPreamble= "\
+#ifndef YY_LOCAL\n\
+#define YY_LOCAL(T)	static T\n\
+#endif\n\
+#ifndef YY_RULE\n\
+#define YY_RULE(T)	static T\n\
+#endif\n\
+#ifndef YY_ACTION\n\
+#define YY_ACTION(T)	static T\n\
+#endif\n\
+#ifndef YYPARSER\n\
+#define YYPARSER	yyparser\n\
+#endif\n\
+#ifndef YY_BEGIN\n\
+#define YY_BEGIN	( yy->_begin= yy->_pos, 1)\n\
+#endif\n\
+#ifndef YY_END\n\
+#define YY_END		( yy->_end= yy->_pos, 1)\n\
+#endif\n\
+#ifdef YY_DEBUG\n\
+# define yyprintf(args)	fprintf args\n\
+#else\n\
+# define yyprintf(args)\n\
+#endif\n\
+#ifndef YYSTYPE\n\
+#define YYSTYPE	int\n\
+#endif\n\
+#ifndef YY_STACK_SIZE\n\
+#define YY_STACK_SIZE 128\n\
+#endif\n\
+#ifndef YY_BUFFER_SIZE\n\
+#define YY_BUFFER_SIZE 1024\n\
+#endif\n\
+\n\
+";
+
+/* The input policies and yymatcher, shared with src/peg.hh and copied
+ * from it into a string when leg is built.
+ */
+static char *cppShared=
+#include "cppruntime.h"
+;
+
+static char *cppClass= "\
+\n\
+template <class Input>\n\
+class YYPARSER : public Input, public yymatcher<YYPARSER<Input> >\n\
+{\n\
+public:\n\
+  typedef YYPARSER yycontext;\n\
+  YY_MATCHER(YYPARSER);\n\
+\n\
+  template <class... Args>\n\
+  explicit YYPARSER(Args &&... args) : Input(std::forward<Args>(args)...) {}\n\
+  ~YYPARSER()	{ free(_text); }\n\
+  YYPARSER(const YYPARSER &)= delete;\n\
+  YYPARSER &operator=(const YYPARSER &)= delete;\n\
+\n\
+  /* Match the start rule against the input that follows the previous\n\
+   * match, run its actions, and answer whether it matched.\n\
+   */\n\
+";
+
+static char *cppMembers= "\
+  /* The offset in the input of the text following the previous match. */\n\
+  size_t offset() const	{ return _offset; }\n\
+\n\
+  int	   _pos= 0;\n\
+  int	   _maxpos= 0;\n\
+  char	  *_text= 0;\n\
+  int	   _textlen= 0;\n\
+  int	   _begin= 0;\n\
+  int	   _end= 0;\n\
+  int	   _choices= 0;\n\
+  size_t   _offset= 0;\n\
+  std::vector<yythunk> _thunks;\n\
+  int	   _thunkpos= 0;\n\
+#ifdef YY_CTX_MEMBERS\n\
+  YY_CTX_MEMBERS\n\
+#endif\n\
+";
+
+static char *cppRuntime= "\
+#define yyEnter(yy)\n\
+#define yyLeave(yy)\n\
+#define yyPoll(yy)\n\
+#define yyStep(yy)\n\
+#define yyAvail(yy, p)		((p) < (yy)->_limit || ((yy)->_pos= (p), (yy)->refill()))\n\
+#define yyByte(yy, p)		((unsigned char)(yy)->_buf[p])\n\
+#define yyInClass(bits, c)	((bits)[(c) >> 3] & (1 << ((c) & 7)))\n\
+\n\
+  static void yyDo(yycontext *yy, int action, int begin, int end)\n\
+  {\n\
+    if (yy->_thunkpos >= (int)yy->_thunks.size())\n\
+      yy->_thunks.resize(yy->_thunks.empty() ? YY_STACK_SIZE : 2 * yy->_thunks.size());\n\
+    yythunk &thunk= yy->_thunks[yy->_thunkpos++];\n\
+    thunk.begin=  begin;\n\
+    thunk.end=    end;\n\
+    thunk.action= action;\n\
+  }\n\
+\n\
+  /* Semantic values live in one stack per type.  A rule with variables\n\
+   * pushes a frame on the stack of each of their types when it starts and\n\
+   * pops it when it succeeds; a variable is set from y_ of the same type.\n\
+   */\n\
+  template <class T>\n\
+  static void yyValues(std::vector<T> &vals, int &val, T &value, int action, int count)\n\
+  {\n\
+    switch (action)\n\
+      {\n\
+      case yyThunkPush:\n\
+	val += count;\n\
+	if ((int)vals.size() <= val)\n\
+	  vals.resize(vals.empty() ? YY_STACK_SIZE : 2 * vals.size());\n\
+	break;\n\
+      case yyThunkPop:	val -= count;		break;\n\
+      case yyThunkSet:	vals[val + count]= value;	break;\n\
+      }\n\
+  }\n\
+\n\
+  static void yyDone(yycontext *yy)\n\
+  {\n\
+    int pos;\n\
+    for (pos= 0;  pos < yy->_thunkpos;  ++pos)\n\
+      {\n\
+	yythunk *thunk= &yy->_thunks[pos];\n\
+	if (thunk->action < yyThunkActions)\n\
+	  yyValue(yy, thunk->action, thunk->begin, thunk->end);\n\
+	else\n\
+	  {\n\
+	    int yyleng= yyText(yy, thunk->begin, thunk->end);\n\
+	    yyprintf((stderr, \"DO [%d] %d %s\\n\", pos, thunk->action, yy->_text));\n\
+	    yyDispatch(yy, thunk->action, yy->_text, yyleng);\n\
+	  }\n\
+      }\n\
+    yy->_thunkpos= 0;\n\
+  }\n\
+\n\
+  static void yyStream(yycontext *yy)\n\
+  {\n\
+    int keep= yy->_pos;\n\
+    if (yy->_begin >= 0 && yy->_begin < keep) keep= yy->_begin;\n\
+    if (yy->_end   >= 0 && yy->_end   < keep) keep= yy->_end;\n\
+    yyDone(yy);\n\
+    if (keep > 0 && keep >= yy->_limit - keep)\n\
+      {\n\
+	yyprintf((stderr, \"stream %d of %d\\n\", keep, yy->_limit));\n\
+	yy->discard(keep);\n\
+	yy->_pos -= keep;\n\
+	yy->_begin -= keep;\n\
+	yy->_end -= keep;\n\
+	yy->_maxpos= (yy->_maxpos > keep) ? yy->_maxpos - keep : 0;\n\
+	yy->_offset += keep;\n\
+      }\n\
+  }\n\
+\n\
+  static int yyAccept(yycontext *yy, int tp0)\n\
+  {\n\
+    if (tp0)\n\
+      {\n\
+	fprintf(stderr, \"accept denied at %d\\n\", tp0);\n\
+	return 0;\n\
+      }\n\
+    yyDone(yy);\n\
+    yyCommit(yy);\n\
+    return 1;\n\
+  }\n\
+\n\
+  bool yyParseFrom(int (*yystart)(yycontext *yy))\n\
+  {\n\
+    int	   yyok;\n\
+    size_t yyoffset= _offset;\n\
+    _begin= _end= -1;\n\
+    _thunkpos= _choices= 0;\n\
+    yyClear(this);\n\
+    yyok= yystart(this);\n\
+    if (yyok) yyDone(this);\n\
+    else if (_offset != yyoffset) _pos= 0;	/* start of parse already discarded */\n\
+    yyCommit(this);\n\
+    return yyok;\n\
+  }\n\
 \n\
-YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)\n\
-{\n\
-  int yyleng= end - begin;\n\
-  if (yyleng <= 0)\n\
-    yyleng= 0;\n\
-  else\n\
-    {\n\
-      while (yy->_textlen < (yyleng + 1))\n\
-	{\n\
-	  yy->_textlen *= 2;\n\
-	  yy->_text= (char *)YY_REALLOC(yy, yy->_text, yy->_textlen);\n\
-	}\n\
-      memcpy(yy->_text, yy->_buf + begin, yyleng);\n\
-    }\n\
-  yy->_text[yyleng]= '\\0';\n\
-  return yyleng;\n\
-}\n\
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)\n\
+\n\
+";
+
+static char *cppFooter= "\
+\n\
+};\n\
+\n\
+#undef yyEnter\n\
+#undef yyLeave\n\
+#undef yyPoll\n\
+#undef YYACCEPT\n\
+";
+
+void Rule_compile_c_header(void)
+{
+  fprintf(output, "/* A recursive-descent parser generated by peg %d.%d.%d */\n", PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
+  fprintf(output, "\n");
+  if (constexprFlag)
+    fprintf(output, "#include <string_view>\n");
+  else
+    fprintf(output, "%s", cppFlag ? cppHeader : header);
+  fprintf(output, "#define YYRULECOUNT %d\n", ruleCount);
+}
+
+int consumesInput(Node *node)
+{
+  if (!node) return 0;
+
+  switch (node->type)
+    {
+    case Rule:
+      {
+	int result= 0;
+	if (RuleReached & node->rule.flags)
+	  fprintf(stderr, "possible infinite left recursion in rule '%s'\n", node->rule.name);
+	else
+	  {
+	    node->rule.flags |= RuleReached;
+	    result= consumesInput(node->rule.expression);
+	    node->rule.flags &= ~RuleReached;
+	  }
+	return result;
+      }
+      break;
+
+    case Dot:		return 1;
+    case Name:		return consumesInput(node->name.rule);
+    case Character:
+    case String:	return strlen(node->string.value) > 0;
+    case Class:		return 1;
+    case Action:	return 0;
+    case Inline:	return 0;
+    case Predicate:	return 0;
+    case Error:		return consumesInput(node->error.element);
+
+    case Alternate:
+      {
+	Node *n;
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  if (!consumesInput(n))
+	    return 0;
+      }
+      return 1;
+
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  if (consumesInput(n))
+	    return 1;
+      }
+      return 0;
+
+    case PeekFor:	return 0;
+    case PeekNot:	return 0;
+    case Query:		return 0;
+    case Star:		return 0;
+    case Plus:		return consumesInput(node->plus.element);
+    case Cut:		return 0;
+
+    default:
+      fprintf(stderr, "\nconsumesInput: illegal node type %d\n", node->type);
+      exit(1);
+    }
+  return 0;
+}
+
+
+static void Action_compile_c(int nolines)
+{
+  Node *n;
+  int   id= 0;
+
+  for (n= actions;  n;  n= n->action.list)
+    ++id;
+  if (id + lazies > 0xffff - 5)	/* below YY_EVENT_ENTER, with the lazy rules after them */
+    {
+      fprintf(stderr, "too many actions (%d) in grammar\n", id + lazies);
+      exit(1);
+    }
+
+  if (actions)
+    {
+      fprintf(output, "enum {\n");
+      for (n= actions;  n;  n= n->action.list)
+	fprintf(output, "  yy%s= yyThunkActions + %d,\n", n->action.name, --id);
+      fprintf(output, "};\n\n");
+    }
+
+  fprintf(output, "YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng)\n{\n");
+  fprintf(output, "  switch (yyaction)\n    {\n");
+  if (!cppFlag)
+    {
+      fprintf(output, "    case yyThunkPush:\tyyPush(yy, yytext, yyleng);\tbreak;\n");
+      fprintf(output, "    case yyThunkPop:\tyyPop(yy, yytext, yyleng);\tbreak;\n");
+      fprintf(output, "    case yyThunkSet:\tyySet(yy, yytext, yyleng);\tbreak;\n");
+    }
+  for (n= actions;  n;  n= n->action.list)
+    {
+      fprintf(output, "    case yy%s:\n      {\n", n->action.name);
+      defineVariables(n->action.rule);
+      fprintf(output, "  yyprintf((stderr, \"do yy%s\\n\"));\n", n->action.name);
+      fprintf(output, "  {\n");
+      if (!nolines)
+	fprintf(output, "#line %i\n", n->action.line);
+      fprintf(output, "  %s;\n", n->action.text);
+      fprintf(output, "  }\n");
+      undefineVariables(n->action.rule);
+      fprintf(output, "      }\n      break;\n");
+    }
+  fprintf(output, "    }\n}\n");
+}
+/* Conservatively decide whether node can fail to match.
+ */
+static int mayFail(Node *node)
+{
+  switch (node->type)
+    {
+    case Rule:
+      {
+	int result= 1;
+	if (node->rule.expression && !(RuleReached & node->rule.flags))
+	  {
+	    node->rule.flags |= RuleReached;
+	    result= mayFail(node->rule.expression);
+	    node->rule.flags &= ~RuleReached;
+	  }
+	return result;
+      }
+
+    case Dot:		return 1;
+    case Name:		return mayFail(node->name.rule);
+    case Character:
+    case String:	return strlen(node->string.value) > 0;
+    case Class:		return 1;
+    case Action:	return 0;
+    case Inline:	return 0;
+    case Predicate:	return strcmp(node->predicate.text, "YY_BEGIN") && strcmp(node->predicate.text, "YY_END") && strcmp(node->predicate.text, "1");
+    case Error:		return mayFail(node->error.element);
+
+    case Alternate:
+      {
+	Node *n;
+	for (n= node->alternate.first;  n->alternate.next;  n= n->alternate.next)
+	  if (hasCut(n))			/* then the alternatives after it might not be tried */
+	    return 1;
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  if (!mayFail(n))
+	    return 0;
+      }
+      return 1;
+
+    case Sequence:
+      {
+	Node *n;
+	for (n= node->sequence.first;  n;  n= n->sequence.next)
+	  if (mayFail(n))
+	    return 1;
+      }
+      return 0;
+
+    case PeekFor:	return mayFail(node->peekFor.element);
+    case PeekNot:	return 1;
+    case Query:
+    case Star:		return hasCut(node->query.element);
+    case Plus:		return mayFail(node->plus.element);
+    case Cut:		return 0;
+
+    default:
+      fprintf(stderr, "\nmayFail: illegal node type %d\n", node->type);
+      exit(1);
+    }
+  return 1;
+}
+
+/* Find the actions that no choice point can ever backtrack past.
+ *
+ * noRetry: a failure at this point propagates out of the top-level rule.
+ * noUndo:  the innermost choice point enclosing this point will never
+ *	    backtrack past it once everything up to its end has matched.
+ * rest:    everything after this point up to the end of the innermost
+ *	    enclosing choice point is certain to match.
+ *
+ * An action is eager if noRetry || (noUndo && rest).  Rules inherit
+ * RuleNoRetry and RuleNoUndo from the most restrictive of their call
+ * sites.  Returns non-zero if any rule flag was cleared.
+ */
+static int markEager(Node *node, int noRetry, int noUndo, int rest)
+{
+  int changed= 0;
+
+  switch (node->type)
+    {
+    case Name:
+      {
+	Node *rule= node->name.rule;
+	int   flags= rule->rule.flags;
+	if (!noRetry)			rule->rule.flags &= ~RuleNoRetry;
+	if (!noRetry && !(noUndo && rest))	rule->rule.flags &= ~RuleNoUndo;
+	changed= (flags != rule->rule.flags);
+      }
+      break;
+
+    case Action:
+      if (!noRetry && !(noUndo && rest))
+	node->action.eager= 0;
+      break;
+
+    case Error:
+      changed= markEager(node->error.element, noRetry, noUndo, rest);
+      break;
+
+    case Alternate:
+      {
+	Node *n;
+	int   end= noRetry || (noUndo && rest);
+	for (n= node->alternate.first;  n;  n= n->alternate.next)
+	  if (n->alternate.next)
+	    changed |= markEager(n, 0, end, 1);
+	  else
+	    changed |= markEager(n, noRetry, noUndo, rest);
+      }
+      break;
+
+    case Sequence:
+      {
+	Node *n, *m;
+	for (n= node->sequence.first;  n;  n= n->sequence.next)
+	  {
+	    int after= rest;
+	    for (m= n->sequence.next;  m && after;  m= m->sequence.next)
+	      after= !mayFail(m);
+	    changed |= markEager(n, noRetry, noUndo, after);
+	  }
+      }
+      break;
+
+    case PeekFor:
+    case PeekNot:
+      changed= markEager(node->peekFor.element, 0, 0, 0);
+      break;
+
+    case Query:
+    case Star:
+      changed= markEager(node->query.element, 0, noRetry || (noUndo && rest), 1);
+      break;
+
+    case Plus:
+      changed=  markEager(node->plus.element, noRetry, noUndo, rest);
+      changed |= markEager(node->plus.element, 0, noRetry || (noUndo && rest), 1);
+      break;
+
+    default:
+      break;
+    }
+  return changed;
+}
+
+static void Rule_markEager(void)
+{
+  Node *n;
+  int   changed;
+
+  for (n= rules;  n;  n= n->rule.next)
+    n->rule.flags |= RuleNoRetry | RuleNoUndo;
+  do
+    {
+      changed= 0;
+      for (n= actions;  n;  n= n->action.list)
+	n->action.eager= 1;
+      for (n= rules;  n;  n= n->rule.next)
+	if (n->rule.expression)
+	  changed |= markEager(n->rule.expression, RuleNoRetry & n->rule.flags, RuleNoUndo & n->rule.flags, 1);
+    }
+  while (changed);
+}
+
+
+/* Emit the rules as labelled blocks within a single function,
+ * yyMachine, that calls and returns between them through an explicit
+ * stack of frames.  The usual yyr* functions become wrappers that
+ * enter the machine at the corresponding rule.
+ */
+static void Goto_compile_c(Node *node)
+{
+  FILE *out= output, *body= tmpfile();
+  Node *n;
+  int   c, i;
+
+  if (!body)
+    {
+      perror("tmpfile");
+      exit(1);
+    }
+  output= body;
+  Rule_compile_c2(node);
+  output= out;
+
+  fprintf(output, "enum {\n");
+  for (n= node;  n;  n= n->rule.next)
+    if (n->rule.expression)
+      fprintf(output, "  yyframe_%s= %d,\n", n->rule.name, n->rule.frame);
+  fprintf(output, "};\n\n");
+  fprintf(output, "#define yyF(N)\tyy->_frames[yyfp + (N)]\n");
+  fprintf(output, "#define yythunkpos0\tyyF(3)\n");
+  fprintf(output, "#define yyPushFrame(N)\tif (yy->_frametop + (N) > yy->_frameslen) yyGrowFrames(yy, yy->_frametop + (N));  yy->_frames[yy->_frametop]= yyret;  yy->_frames[yy->_frametop + 1]= yyfp;  yyfp= yy->_frametop;  yy->_frametop += (N)\n\n");
+  fprintf(output, "/* The frames live in the context, above any frames of an enclosing\n");
+  fprintf(output, " * yyMachine that a predicate or action has re-entered from.\n");
+  fprintf(output, " */\n");
+  fprintf(output, "YY_LOCAL(int) yyMachine(yycontext *yy, int yystart)\n{\n");
+  fprintf(output, "  int yyfp= yy->_frametop, yyret= -1, yyok= 0;\n");
+  fprintf(output, "  switch (yystart)\n    {\n");
+  for (n= node;  n;  n= n->rule.next)
+    if (n->rule.expression)
+      fprintf(output, "    case %d:\tgoto yy_%s;\n", n->rule.id, n->rule.name);
+  fprintf(output, "    }\n  return 0;");
+
+  rewind(body);
+  while (EOF != (c= getc(body)))
+    putc(c, output);
+  fclose(body);
+
+  fprintf(output, "\n\n yyreturn:;\n  yy->_frametop= yyfp;  yyret= yyF(0);  yyfp= yyF(1);\n");
+  if (returns)
+    {
+      fprintf(output, "#ifdef __GNUC__\n  {\n    static void *const yyreturns[]= {");
+      for (i= 0;  i < returns;  ++i)
+	fprintf(output, "%s&&yyret%d,", (i % 8) ? " " : "\n      ", i);
+      fprintf(output, "\n    };\n    if (yyret >= 0) goto *yyreturns[yyret];\n  }\n#else\n");
+      fprintf(output, "  switch (yyret)\n    {\n");
+      for (i= 0;  i < returns;  ++i)
+	fprintf(output, "    case %d:\tgoto yyret%d;\n", i, i);
+      fprintf(output, "    }\n#endif\n");
+    }
+  fprintf(output, "  return yyok;\n}\n\n");
+  fprintf(output, "#undef yyPushFrame\n#undef yythunkpos0\n#undef yyF\n\n");
+
+  for (n= node;  n;  n= n->rule.next)
+    if (n->rule.expression)
+      fprintf(output, "YY_RULE(int) yyr%s(yycontext *yy) { return yyMachine(yy, %d); }\n", n->rule.name, n->rule.id);
+}
+
+static char *machineOps= "\
+enum {\n\
+  yyOpChar= 0, yyOpString, yyOpIString, yyOpClass, yyOpSpan, yyOpAny,\n\
+  yyOpChoice, yyOpNotChoice, yyOpCommit, yyOpBackCommit, yyOpFail, yyOpFailTwice,\n\
+  yyOpCut, yyOpCall, yyOpReturn, yyOpJump, yyOpBegin, yyOpEnd,\n\
+  yyOpPush, yyOpPop, yyOpAssign, yyOpAction, yyOpEager, yyOpPredicate, yyOpCode, yyOpStream\n\
+};\n\
+\n\
+";
+
+static char *machine= "\
+#ifdef __GNUC__\n\
+# define yyCASE(OP)	yyL##OP:\n\
+# define yyNEXT		goto *yyops[yybytecode[yypc]]\n\
+#else\n\
+# define yyCASE(OP)	case OP:\n\
+# define yyNEXT		goto yynext\n\
+#endif\n\
 \n\
-YY_LOCAL(void) yyDone(yycontext *yy)\n\
+#define yyPUSH(PC, POS, TP, MP)					\\\n\
+  if (yysp + 4 > yy->_frameslen) yys= yyGrowFrames(yy, yysp + 4);	\\\n\
+  yys[yysp]= (PC);  yys[yysp + 1]= (POS);  yys[yysp + 2]= (TP);  yys[yysp + 3]= (MP);  yysp += 4\n\
+\n\
+/* Run the parsing machine from the rule at yypc.  The stack holds\n\
+ * four ints per entry: a choice point is {pc, pos, thunkpos, maxpos or\n\
+ * -1} and a call is {-2 - return pc, pos, thunkpos, caller's call}.\n\
+ * The outermost call has -1 in place of its return pc.\n\
+ */\n\
+YY_LOCAL(int) yyVM(yycontext *yy, int yypc)\n\
 {\n\
-  int pos;\n\
-  for (pos= 0;  pos < yy->_thunkpos;  ++pos)\n\
+  int *yys= yyGrowFrames(yy, 4), yysp= 4, yyfp= 0, yychoices= 0;\n\
+#ifdef __GNUC__\n\
+  static void *const yyops[]= {\n\
+    &&yyLyyOpChar, &&yyLyyOpString, &&yyLyyOpIString, &&yyLyyOpClass, &&yyLyyOpSpan, &&yyLyyOpAny,\n\
+    &&yyLyyOpChoice, &&yyLyyOpNotChoice, &&yyLyyOpCommit, &&yyLyyOpBackCommit, &&yyLyyOpFail, &&yyLyyOpFailTwice,\n\
+    &&yyLyyOpCut, &&yyLyyOpCall, &&yyLyyOpReturn, &&yyLyyOpJump, &&yyLyyOpBegin, &&yyLyyOpEnd,\n\
+    &&yyLyyOpPush, &&yyLyyOpPop, &&yyLyyOpAssign, &&yyLyyOpAction, &&yyLyyOpEager, &&yyLyyOpPredicate, &&yyLyyOpCode,\n\
+    &&yyLyyOpStream,\n\
+  };\n\
+#endif\n\
+  yys[0]= -1;  yys[1]= yy->_pos;  yys[2]= yy->_thunkpos;  yys[3]= -1;\n\
+  yyEnter(yy);\n\
+#ifdef __GNUC__\n\
+  yyNEXT;\n\
+#else\n\
+ yynext:\n\
+  switch (yybytecode[yypc])\n\
     {\n\
-      yythunk *thunk= &yy->_thunks[pos];\n\
-      int yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;\n\
-      yyprintf((stderr, \"DO [%d] %p %s\\n\", pos, thunk->action, yy->_text));\n\
-      thunk->action(yy, yy->_text, yyleng);\n\
+#endif\n\
+    yyCASE(yyOpChar)	if (!yymatchChar(yy, yybytecode[yypc + 1])) goto yyfail;  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpString)	if (!yymatchString(yy, yystrings[yybytecode[yypc + 1]])) goto yyfail;  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpIString)	if (!yymatchIString(yy, yystrings[yybytecode[yypc + 1]])) goto yyfail;  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpClass)	if (!yymatchClass(yy, (unsigned char *)yyclasses[yybytecode[yypc + 1]])) goto yyfail;  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpSpan)	while (yymatchClass(yy, (unsigned char *)yyclasses[yybytecode[yypc + 1]])) yyPoll(yy);  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpAny)	if (!yymatchDot(yy)) goto yyfail;  yypc += 1;  yyNEXT;\n\
+    yyCASE(yyOpChoice)	yyPUSH(yybytecode[yypc + 1], yy->_pos, yy->_thunkpos, -1);  ++yychoices;  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpNotChoice)	yyPUSH(yybytecode[yypc + 1], yy->_pos, yy->_thunkpos, yy->_maxpos);  ++yychoices;  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpCommit)	yysp -= 4;  --yychoices;  yypc= yybytecode[yypc + 1];  yyPoll(yy);  yyNEXT;\n\
+    yyCASE(yyOpBackCommit)\n\
+      yysp -= 4;\n\
+      --yychoices;\n\
+      yy->_pos= yys[yysp + 1];\n\
+      yy->_thunkpos= yys[yysp + 2];\n\
+      yypc= yybytecode[yypc + 1];\n\
+      yyNEXT;\n\
+    yyCASE(yyOpFail)	goto yyfail;\n\
+    yyCASE(yyOpFailTwice)\n\
+      yysp -= 4;\n\
+      --yychoices;\n\
+      yy->_maxpos= yys[yysp + 3];\n\
+      goto yyfail;\n\
+    yyCASE(yyOpCut)	yysp -= 4;  --yychoices;  yypc += 1;  yyNEXT;\n\
+    yyCASE(yyOpCall)\n\
+      yyprintf((stderr, \"call %d @ %s\\n\", yybytecode[yypc + 1], yy->_buf+yy->_pos));\n\
+      yyPUSH(-2 - (yypc + 2), yy->_pos, yy->_thunkpos, yyfp);\n\
+      yyfp= yysp - 4;\n\
+      yyEnter(yy);\n\
+      yypc= yybytecode[yypc + 1];\n\
+      yyNEXT;\n\
+    yyCASE(yyOpReturn)\n\
+      yysp -= 4;\n\
+      yyLeave(yy);\n\
+      if (yys[yysp] == -1) return 1;\n\
+      yypc= -2 - yys[yysp];\n\
+      yyfp= yys[yysp + 3];\n\
+      yyNEXT;\n\
+    yyCASE(yyOpJump)	yypc= yybytecode[yypc + 1];  yyNEXT;\n\
+    yyCASE(yyOpBegin)	yy->_begin= yy->_pos;  yypc += 1;  yyNEXT;\n\
+    yyCASE(yyOpEnd)	yy->_end= yy->_pos;  yypc += 1;  yyNEXT;\n\
+    yyCASE(yyOpPush)	yyDo(yy, yyThunkPush, yybytecode[yypc + 1], 0);  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpPop)	yyDo(yy, yyThunkPop, yybytecode[yypc + 1], 0);  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpAssign)	yyDo(yy, yyThunkSet, yybytecode[yypc + 1], 0);  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpAction)	yyDo(yy, yybytecode[yypc + 1], yy->_begin, yy->_end);  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpEager)	yyDo(yy, yybytecode[yypc + 1], yy->_begin, yy->_end);  yyDone(yy);  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpPredicate)	if (!yyCode(yy, yybytecode[yypc + 1], yys[yyfp + 2])) goto yyfail;  yypc += 2;  yyNEXT;\n\
+    yyCASE(yyOpCode)	yyCode(yy, yybytecode[yypc + 1], yys[yyfp + 2]);  yypc += 2;  yyNEXT;\n\
+#ifdef YY_STREAM\n\
+    yyCASE(yyOpStream)	if (!yychoices) yyStream(yy);  yypc += 1;  yyNEXT;\n\
+#else\n\
+    yyCASE(yyOpStream)	yypc += 1;  yyNEXT;\n\
+#endif\n\
+#ifndef __GNUC__\n\
     }\n\
-  yy->_thunkpos= 0;\n\
+#endif\n\
+ yyfail:\n\
+  yyprintf((stderr, \"  fail @ %s\\n\", yy->_buf+yy->_pos));\n\
+  for (;;)\n\
+    {\n\
+      yysp -= 4;\n\
+      if (yys[yysp] >= 0)\n\
+	break;\n\
+      yyLeave(yy);\n\
+      yy->_pos= yys[yysp + 1];\n\
+      yy->_thunkpos= yys[yysp + 2];\n\
+      if (yys[yysp] == -1)\n\
+	return 0;\n\
+      yyfp= yys[yysp + 3];\n\
+    }\n\
+  --yychoices;\n\
+  yypc= yys[yysp];\n\
+  yy->_pos= yys[yysp + 1];\n\
+  yy->_thunkpos= yys[yysp + 2];\n\
+  if (yys[yysp + 3] >= 0)\n\
+    yy->_maxpos= yys[yysp + 3];\n\
+  yyNEXT;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyCommit(yycontext *yy)\n\
+#undef yyPUSH\n\
+#undef yyNEXT\n\
+#undef yyCASE\n\
+";
+
+/* With -b, or when a grammar is loaded at run time, the rules are
+ * lowered to a program for a small parsing machine.  Each instruction
+ * is an opcode followed by at most one operand.  Branch targets are
+ * recorded as references to labels and patched once every label has
+ * an address.
+ */
+static Program *program= 0;
+static int     *vmLabels= 0, vmLabelsMax= 0, vmLabelBase= 0;
+static int     *vmFixups= 0, vmFixupCount= 0, vmFixupMax= 0;
+static int      vmCut= 0;	/* the current scope has a counted choice point */
+static int      vmCutSeen= 0;	/* a cut has been compiled in the current scope */
+
+static int opOperands[]= {
+  1, 1, 1, 1, 1, 0,	/* Char String IString Class Span Any */
+  1, 1, 1, 1, 0, 0,	/* Choice NotChoice Commit BackCommit Fail FailTwice */
+  0, 1, 0, 1, 0, 0,	/* Cut Call Return Jump Begin End */
+  1, 1, 1, 1, 1, 1, 1,	/* Push Pop Assign Action Eager Predicate Code */
+  0,			/* Stream */
+};
+
+static char *opNames[]= {
+  "yyOpChar", "yyOpString", "yyOpIString", "yyOpClass", "yyOpSpan", "yyOpAny",
+  "yyOpChoice", "yyOpNotChoice", "yyOpCommit", "yyOpBackCommit", "yyOpFail", "yyOpFailTwice",
+  "yyOpCut", "yyOpCall", "yyOpReturn", "yyOpJump", "yyOpBegin", "yyOpEnd",
+  "yyOpPush", "yyOpPop", "yyOpAssign", "yyOpAction", "yyOpEager", "yyOpPredicate", "yyOpCode",
+  "yyOpStream",
+};
+
+static void vmEmit(int value)
+{
+  if (0 == (program->codeCount & (program->codeCount - 1)))
+    program->code= (int *)realloc(program->code, sizeof(int) * (program->codeCount ? program->codeCount * 2 : 1));
+  program->code[program->codeCount++]= value;
+}
+
+static void vmOp(int op)			{ vmEmit(op); }
+static void vmArg(int op, int arg)		{ vmEmit(op);  vmEmit(arg); }
+
+static void vmJump(int op, int label)
+{
+  if (vmFixupCount == vmFixupMax)
+    {
+      vmFixupMax= vmFixupMax ? vmFixupMax * 2 : 1024;
+      vmFixups= (int *)realloc(vmFixups, sizeof(int) * vmFixupMax);
+    }
+  vmEmit(op);
+  vmFixups[vmFixupCount++]= program->codeCount;
+  vmEmit(label);
+}
+
+static void vmLabel(int label)
+{
+  label -= vmLabelBase;
+  while (label >= vmLabelsMax)
+    {
+      vmLabelsMax= vmLabelsMax ? vmLabelsMax * 2 : 1024;
+      vmLabels= (int *)realloc(vmLabels, sizeof(int) * vmLabelsMax);
+    }
+  vmLabels[label]= program->codeCount;
+}
+
+static int vmString(char *text)
+{
+  int i;
+  for (i= 0;  i < program->stringCount;  ++i)
+    if (!strcmp(program->strings[i], text))
+      return i;
+  program->strings= (char **)realloc(program->strings, sizeof(char *) * (program->stringCount + 1));
+  program->strings[program->stringCount]= text;
+  return program->stringCount++;
+}
+
+static int vmClass(unsigned char *cclass)
+{
+  unsigned char bits[32];
+  int		i;
+  makeCharBits(cclass, bits);
+  for (i= 0;  i < program->classCount;  ++i)
+    if (!memcmp(program->classes[i], bits, 32))
+      return i;
+  program->classes= (unsigned char **)realloc(program->classes, sizeof(unsigned char *) * (program->classCount + 1));
+  program->classes[program->classCount]= (unsigned char *)malloc(32);
+  memcpy(program->classes[program->classCount], bits, 32);
+  return program->classCount++;
+}
+
+static int vmNode(Node *node)
+{
+  program->nodes= (Node **)realloc(program->nodes, sizeof(Node *) * (program->nodeCount + 1));
+  program->nodes[program->nodeCount]= node;
+  return program->nodeCount++;
+}
+
+static void Node_compile_vm(Node *node);
+
+static int Node_compile_vm_scope(Node *node, int counted)
+{
+  int cut0= vmCut, seen;
+  vmCut= counted;
+  vmCutSeen= 0;
+  Node_compile_vm(node);
+  seen= vmCutSeen;
+  vmCut= cut0;
+  vmCutSeen= 0;
+  return seen;
+}
+
+static void Node_compile_vm(Node *node)
+{
+  assert(node);
+  switch (node->type)
+    {
+    case Dot:
+      vmOp(OpAny);
+      break;
+
+    case Name:
+      vmJump(OpCall, program->rules[node->name.rule->rule.id]);
+      if (node->name.variable)
+	vmArg(OpAssign, node->name.variable->variable.offset);
+      break;
+
+    case Character:
+    case String:
+      {
+	int len= strlen(node->string.value);
+	if (String == node->type && node->string.casefold)
+	  vmArg(OpIString, vmString(node->string.value));
+	else if (1 == len || (2 == len && '\\' == node->string.value[0]))
+	  {
+	    unsigned char *ptr= (unsigned char *)node->string.value;
+	    vmArg(OpChar, cnext(&ptr));
+	  }
+	else
+	  vmArg(OpString, vmString(node->string.value));
+      }
+      break;
+
+    case Class:
+      vmArg(OpClass, vmClass(node->cclass.value));
+      break;
+
+    case Action:
+      vmArg(node->action.eager ? OpEager : OpAction, vmNode(node));
+      break;
+
+    case Inline:
+      vmArg(OpCode, vmNode(node));
+      break;
+
+    case Predicate:
+      if (!strcmp(node->predicate.text, "YY_BEGIN"))
+	vmOp(OpBegin);
+      else if (!strcmp(node->predicate.text, "YY_END"))
+	vmOp(OpEnd);
+      else
+	vmArg(OpPredicate, vmNode(node));
+      break;
+
+    case Error:
+      {
+	int eok= yyl(), eko= yyl();
+	vmJump(OpChoice, eko);
+	Node_compile_vm_scope(node->error.element, 0);
+	vmJump(OpCommit, eok);
+	vmLabel(eko);
+	vmArg(OpCode, vmNode(node));
+	vmOp(OpFail);
+	vmLabel(eok);
+      }
+      break;
+
+    case Alternate:
+      {
+	int ok= yyl();
+	for (node= node->alternate.first;  node;  node= node->alternate.next)
+	  if (node->alternate.next)
+	    {
+	      int next= yyl();
+	      vmJump(OpChoice, next);
+	      vmJump(Node_compile_vm_scope(node, 1) ? OpJump : OpCommit, ok);
+	      vmLabel(next);
+	    }
+	  else
+	    Node_compile_vm_scope(node, 0);
+	vmLabel(ok);
+      }
+      break;
+
+    case Sequence:
+      {
+	int cut= 0;
+	for (node= node->sequence.first;  node;  node= node->sequence.next)
+	  {
+	    vmCutSeen= 0;
+	    Node_compile_vm(node);
+	    cut |= vmCutSeen;
+	  }
+	vmCutSeen= cut;
+      }
+      break;
+
+    case Cut:
+      if (vmCut)
+	{
+	  vmOp(OpCut);
+	  vmCut= 0;
+	}
+      if (streamFlag)
+	vmOp(OpStream);
+      vmCutSeen= 1;
+      break;
+
+    case PeekFor:
+      {
+	int pko= yyl(), pok= yyl();
+	vmJump(OpChoice, pko);
+	Node_compile_vm_scope(node->peekFor.element, 0);
+	vmJump(OpBackCommit, pok);
+	vmLabel(pko);
+	vmOp(OpFail);
+	vmLabel(pok);
+      }
+      break;
+
+    case PeekNot:
+      {
+	int ok= yyl();
+	vmJump(OpNotChoice, ok);
+	Node_compile_vm_scope(node->peekNot.element, 0);
+	vmOp(OpFailTwice);
+	vmLabel(ok);
+      }
+      break;
+
+    case Query:
+      {
+	int qok= yyl();
+	vmJump(OpChoice, qok);
+	vmJump(Node_compile_vm_scope(node->query.element, 1) ? OpJump : OpCommit, qok);
+	vmLabel(qok);
+      }
+      break;
+
+    case Star:
+    case Plus:
+      {
+	int again= yyl(), out= yyl();
+	Node *element= node->star.element;
+	if (Plus == node->type)
+	  Node_compile_vm_scope(element, 0);
+	if (Class == element->type && !streamFlag)
+	  {
+	    vmArg(OpSpan, vmClass(element->cclass.value));
+	    break;
+	  }
+	vmLabel(again);
+	if (streamFlag)
+	  vmOp(OpStream);
+	vmJump(OpChoice, out);
+	vmJump(Node_compile_vm_scope(element, 1) ? OpJump : OpCommit, again);
+	vmLabel(out);
+      }
+      break;
+
+    default:
+      fprintf(stderr, "\nNode_compile_vm: illegal node type %d\n", node->type);
+      exit(1);
+    }
+}
+
+/* Lower the rules to a program for the parsing machine.  On return
+ * program->rules[id] holds the address of each rule; an undefined rule
+ * is compiled as a single Fail.
+ */
+Program *Rule_compile_program(Node *node)
+{
+  Node *n;
+  int   i;
+
+  program= (Program *)calloc(1, sizeof(Program));
+  program->rules= (int *)calloc(ruleCount + 1, sizeof(int));
+  vmFixupCount= 0;
+  vmLabelBase= yyl();
+  for (n= node;  n;  n= n->rule.next)
+    program->rules[n->rule.id]= yyl();
+
+  for (n= node;  n;  n= n->rule.next)
+    {
+      vmLabel(program->rules[n->rule.id]);
+      if (!n->rule.expression)
+	{
+	  fprintf(stderr, "rule '%s' used but not defined\n", n->rule.name);
+	  vmOp(OpFail);
+	  continue;
+	}
+      if ((!(RuleUsed & n->rule.flags)) && (n != start))
+	fprintf(stderr, "rule '%s' defined but not used\n", n->rule.name);
+      if (n->rule.variables)
+	vmArg(OpPush, countVariables(n->rule.variables, 0));
+      Node_compile_vm_scope(n->rule.expression, 0);
+      if (n->rule.variables)
+	vmArg(OpPop, countVariables(n->rule.variables, 0));
+      vmOp(OpReturn);
+    }
+
+  for (i= 0;  i < vmFixupCount;  ++i)
+    program->code[vmFixups[i]]= vmLabels[program->code[vmFixups[i]] - vmLabelBase];
+  for (n= node;  n;  n= n->rule.next)
+    program->rules[n->rule.id]= vmLabels[program->rules[n->rule.id] - vmLabelBase];
+
+  return program;
+}
+
+static void Rule_compile_vm(Node *node)
+{
+  Program *p= Rule_compile_program(node);
+  Node	  *n;
+  int	   i, j;
+
+  fprintf(output, "%s", machineOps);
+  fprintf(output, "static const int yybytecode[]= {");
+  for (i= 0;  i < p->codeCount;  i += 1 + opOperands[p->code[i]])
+    {
+      int op= p->code[i];
+      for (n= node;  n;  n= n->rule.next)
+	if (n->rule.expression && p->rules[n->rule.id] == i)
+	  fprintf(output, "\n  /* %s */", n->rule.name);
+      fprintf(output, "\n  /* %d */ %s,", i, opNames[op]);
+      if (OpAction == op || OpEager == op)
+	fprintf(output, " yy%s,", p->nodes[p->code[i + 1]]->action.name);
+      else if (opOperands[op])
+	fprintf(output, " %d,", p->code[i + 1]);
+    }
+  fprintf(output, "\n};\n\n");
+
+  fprintf(output, "static const char *yystrings[]= {\n");
+  for (i= 0;  i < p->stringCount;  ++i)
+    fprintf(output, "  \"%s\",\n", p->strings[i]);
+  fprintf(output, "  0\n};\n\n");
+
+  fprintf(output, "static const char *yyclasses[]= {\n");
+  for (i= 0;  i < p->classCount;  ++i)
+    fprintf(output, "  \"%s\",\n", formatCharBits(p->classes[i]));
+  fprintf(output, "  0\n};\n\n");
+
+  fprintf(output, "YY_LOCAL(int) yyCode(yycontext *yy, int yyn, int yythunkpos0)\n{\n");
+  fprintf(output, "  yyText(yy, yy->_begin, yy->_end);\n");
+  fprintf(output, "#define yytext yy->_text\n");
+  fprintf(output, "#define yyleng yy->_textlen\n");
+  fprintf(output, "  switch (yyn)\n    {\n");
+  for (j= 0;  j < p->nodeCount;  ++j)
+    switch (p->nodes[j]->type)
+      {
+      case Predicate:	fprintf(output, "    case %d:\treturn (%s);\n", j, p->nodes[j]->predicate.text);		break;
+      case Inline:	fprintf(output, "    case %d:\t{ %s; }  break;\n", j, p->nodes[j]->inLine.text);	break;
+      case Error:	fprintf(output, "    case %d:\t{ %s; }  break;\n", j, p->nodes[j]->error.text);	break;
+      }
+  fprintf(output, "    }\n");
+  fprintf(output, "#undef yytext\n");
+  fprintf(output, "#undef yyleng\n");
+  fprintf(output, "  return 1;\n}\n\n");
+
+  fprintf(output, "%s\n", machine);
+  for (n= node;  n;  n= n->rule.next)
+    if (n->rule.expression)
+      fprintf(output, "YY_RULE(int) yyr%s(yycontext *yy) { return yyVM(yy, %d); }\n", n->rule.name, p->rules[n->rule.id]);
+}
+
+/* Compile the grammar to a class template, parameterised by the input
+ * policy, whose members are the rules and the runtime.  Each type named
+ * by %type has its own value stack; see Rule_typeVariables().
+ */
+static void Rule_compile_cpp(Node *node, int nolines)
+{
+  int type;
+
+  Rule_typeVariables(node);
+  fprintf(output, "%s%s%s", cppPreamble, cppShared, cppClass);
+  fprintf(output, "  bool parse()\t\t{ return yyParseFrom(yyr%s); }\n\n", start->rule.name);
+  fprintf(output, "  /* The semantic value of the start rule after a match. */\n");
+  type= valueType(start->rule.valueType);
+  fprintf(output, "  %s &value()\t\t{ return _%d; }\n\n", valueTypes[type], type);
+  fprintf(output, "%s", cppMembers);
+  for (type= 0;  type < valueTypeCount;  ++type)
+    {
+      fprintf(output, "  %s _%d{};\n", valueTypes[type], type);
+      fprintf(output, "  std::vector<%s > _vals%d;\n", valueTypes[type], type);
+      fprintf(output, "  int _val%d= 0;\n", type);
+    }
+  fprintf(output, "\n%s", cppRuntime);
+  fprintf(output, "  static void yyValue(yycontext *yy, int action, int count, int type)\n  {\n");
+  fprintf(output, "    switch (type)\n      {\n");
+  for (type= 0;  type < valueTypeCount;  ++type)
+    fprintf(output, "      case %d:\tyyValues(yy->_vals%d, yy->_val%d, yy->_%d, action, count);\tbreak;\n", type, type, type, type);
+  fprintf(output, "      }\n  }\n\n");
+  fprintf(output, "  static void yyClear(yycontext *yy)\n  {\n");
+  for (type= 0;  type < valueTypeCount;  ++type)
+    fprintf(output, "    yy->_val%d= 0;\n", type);
+  fprintf(output, "  }\n\n");
+  Action_compile_c(nolines);
+  Rule_compile_scanners(node);
+  Rule_compile_c2(node);
+  fprintf(output, "%s", cppFooter);
+}
+
+/* With -R the grammar is compiled to a constexpr recognizer.  C++20 does
+ * not allow goto in a constexpr function, so instead of labels each
+ * compound expression becomes a member function of its own.  These
+ * return 1 for a match and 0 for a failure, or -1 for a failure after a
+ * cut, which makes the enclosing alternative, option or repetition fail
+ * as a whole.
+ */
+static int Node_compile_cx(Node *node);
+
+static void Node_compile_cx_call(Node *node, int id)
+{
+  if (id)
+    {
+      fprintf(output, "yy%d(yy)", id);
+      return;
+    }
+  switch (node->type)
+    {
+    case Dot:
+      fprintf(output, "yymatchDot(yy)");
+      break;
+
+    case Name:
+      fprintf(output, "yyr%s(yy)", node->name.rule->rule.name);
+      break;
+
+    case Character:
+    case String:
+      {
+	int len= strlen(node->string.value);
+	if (String == node->type && node->string.casefold)
+	  fprintf(output, "yymatchIString(yy, \"%s\")", node->string.value);
+	else if (1 == len && '\'' == node->string.value[0])
+	  fprintf(output, "yymatchChar(yy, '\\'')");
+	else if (1 == len || (2 == len && '\\' == node->string.value[0]))
+	  fprintf(output, "yymatchChar(yy, '%s')", node->string.value);
+	else
+	  fprintf(output, "yymatchString(yy, \"%s\")", node->string.value);
+      }
+      break;
+
+    case Class:
+      fprintf(output, "yymatchClass(yy, \"%s\")", makeCharClass(node->cclass.value));
+      break;
+
+    case Predicate:
+      fprintf(output, "(%s)", node->predicate.text);
+      break;
+
+    default:		/* actions, inline code and cuts match the empty string */
+      fprintf(output, "1");
+      break;
+    }
+}
+
+static void Node_compile_cx_begin(int id)
+{
+  fprintf(output, "\nstatic constexpr int yy%d(yycontext *yy)\n{", id);
+}
+
+/* Answer whether node can return -1 with -R: a cut commits the
+ * sequence that holds it and the sequences around that one, but the
+ * alternatives, repetitions and predicates between catch it.
+ */
+static int cutsSequence(Node *node)
+{
+  Node *n;
+  if (Sequence == node->type)
+    for (n= node->sequence.first;  n;  n= n->sequence.next)
+      if (Cut == n->type || cutsSequence(n))
+	return 1;
+  return 0;
+}
+
+static int Node_compile_cx(Node *node)
+{
+  int  id, *ids, count= 0, i;
+  Node *n;
+
+  switch (node->type)
+    {
+    case Alternate:
+    case Sequence:
+      for (n= node->alternate.first;  n;  n= n->alternate.next)
+	++count;
+      ids= (int *)malloc(sizeof(int) * count);
+      for (i= 0, n= node->alternate.first;  n;  n= n->alternate.next)
+	ids[i++]= Node_compile_cx(n);
+      Node_compile_cx_begin(id= yyl());
+      if (Alternate == node->type)
+	{
+	  fprintf(output, "\n  int yypos= yy->_pos, yyr;");
+	  for (i= 0, n= node->alternate.first;  n->alternate.next;  n= n->alternate.next, ++i)
+	    {
+	      fprintf(output, "\n  if ((yyr= ");
+	      Node_compile_cx_call(n, ids[i]);
+	      fprintf(output, ") > 0) return 1;");
+	      if (cutsSequence(n))
+		fprintf(output, "\n  if (yyr < 0) return 0;");
+	      fprintf(output, "\n  yy->_pos= yypos;");
+	    }
+	  fprintf(output, "\n  return ");
+	  Node_compile_cx_call(n, ids[i]);
+	  fprintf(output, " > 0;");
+	}
+      else
+	{
+	  char *fail= "yyr";
+	  fprintf(output, "\n  int yyr;");
+	  for (i= 0, n= node->sequence.first;  n;  n= n->sequence.next, ++i)
+	    if (Cut == n->type)
+	      fail= "-1";
+	    else
+	      {
+		fprintf(output, "\n  if ((yyr= ");
+		Node_compile_cx_call(n, ids[i]);
+		fprintf(output, ") <= 0) return %s;", fail);
+		if (cutsSequence(n))
+		  fail= "-1";
+	      }
+	  fprintf(output, "\n  return 1;");
+	}
+      fprintf(output, "\n}\n");
+      free(ids);
+      return id;
+
+    case PeekFor:
+      i= Node_compile_cx(node->peekFor.element);
+      Node_compile_cx_begin(id= yyl());
+      fprintf(output, "\n  int yypos= yy->_pos, yyr= ");
+      Node_compile_cx_call(node->peekFor.element, i);
+      fprintf(output, ";\n  yy->_pos= yypos;\n  return yyr > 0;\n}\n");
+      return id;
+
+    case PeekNot:
+      i= Node_compile_cx(node->peekNot.element);
+      Node_compile_cx_begin(id= yyl());
+      fprintf(output, "\n  int yypos= yy->_pos, yymaxpos= yy->_maxpos, yyr= ");
+      Node_compile_cx_call(node->peekNot.element, i);
+      fprintf(output, ";\n  yy->_pos= yypos;\n  yy->_maxpos= yymaxpos;\n  return yyr <= 0;\n}\n");
+      return id;
+
+    case Query:
+      i= Node_compile_cx(node->query.element);
+      Node_compile_cx_begin(id= yyl());
+      fprintf(output, "\n  int yypos= yy->_pos, yyr= ");
+      Node_compile_cx_call(node->query.element, i);
+      fprintf(output, ";\n  if (yyr < 0) return 0;\n  if (!yyr) yy->_pos= yypos;\n  return 1;\n}\n");
+      return id;
+
+    case Star:
+    case Plus:
+      i= Node_compile_cx(node->star.element);
+      Node_compile_cx_begin(id= yyl());
+      if (Plus == node->type)
+	{
+	  fprintf(output, "\n  if (");
+	  Node_compile_cx_call(node->plus.element, i);
+	  fprintf(output, " <= 0) return 0;");
+	}
+      fprintf(output, "\n  for (;;)\n    {\n      int yypos= yy->_pos, yyr= ");
+      Node_compile_cx_call(node->star.element, i);
+      fprintf(output, ";\n      if (yyr < 0) return 0;");
+      fprintf(output, "\n      if (!yyr)\n\t{\n\t  yy->_pos= yypos;\n\t  return 1;\n\t}\n    }\n}\n");
+      return id;
+
+    case Error:		/* the error action is not run */
+      i= Node_compile_cx(node->error.element);
+      Node_compile_cx_begin(id= yyl());
+      fprintf(output, "\n  return ");
+      Node_compile_cx_call(node->error.element, i);
+      fprintf(output, " > 0;\n}\n");
+      return id;
+
+    default:
+      return 0;
+    }
+}
+
+static char *cxPreamble= "\
+#ifndef YYRECOGNIZER\n\
+#define YYRECOGNIZER	yyrecognizer\n\
+#endif\n\
+#ifndef YY_BEGIN\n\
+#define YY_BEGIN	( yy->_begin= yy->_pos, 1)\n\
+#endif\n\
+#ifndef YY_END\n\
+#define YY_END		( yy->_end= yy->_pos, 1)\n\
+#endif\n\
+#define yytext		yyText(yy)\n\
+#define yyleng		((int)yyText(yy).size())\n\
+\n\
+class YYRECOGNIZER\n\
 {\n\
-  if ((yy->_limit -= yy->_pos))\n\
-    {\n\
-      memmove(yy->_buf, yy->_buf + yy->_pos, yy->_limit);\n\
-    }\n\
-  yy->_begin -= yy->_pos;\n\
-  yy->_end -= yy->_pos;\n\
-  yy->_pos= yy->_thunkpos= 0;\n\
-}\n\
+public:\n\
+  typedef YYRECOGNIZER yycontext;\n\
 \n\
-YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)\n\
-{\n\
-  if (tp0)\n\
-    {\n\
-      fprintf(stderr, \"accept denied at %d\\n\", tp0);\n\
-      return 0;\n\
-    }\n\
-  else\n\
-    {\n\
-      yyDone(yy);\n\
-      yyCommit(yy);\n\
-    }\n\
-  return 1;\n\
-}\n\
+  constexpr explicit YYRECOGNIZER(std::string_view text) : _buf(text) {}\n\
 \n\
-YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)\n\
-{\n\
-#ifdef __cplusplus\n\
-  yy->_vals->resize(yy->_vals->size() + count);\n\
-  yy->_val = &yy->_vals->back();\n\
-#else\n\
-  yy->_val += count;\n\
-  while (yy->_valslen <= yy->_val - yy->_vals)\n\
-    {\n\
-      long offset= yy->_val - yy->_vals;\n\
-      size_t oldlen = yy->_valslen;\n\
-      yy->_valslen *= 2;\n\
-      yy->_vals= (YYSTYPE *)YY_REALLOC(yy, yy->_vals, sizeof(YYSTYPE) * yy->_valslen);\n\
-      memset(&yy->_vals[oldlen], 0, sizeof(YYSTYPE) * oldlen);\n\
-      yy->_val= yy->_vals + offset;\n\
-    }\n\
-#endif\n\
-}\n\
-YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)\n\
-{\n\
-#ifdef __cplusplus\n\
-  yy->_vals->resize(yy->_vals->size() - count);\n\
-  yy->_val = &yy->_vals->back();\n\
-#else\n\
-  yy->_val -= count;\n\
-#endif\n\
-}\n\
-YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)   { yy->_val[count]= yy->_; }\n\
+  /* The position furthest into the text reached by the last match. */\n\
+  constexpr int furthest() const	{ return _maxpos; }\n\
 \n\
-#endif /* YY_PART */\n\
+  /* Answer whether the start rule matches the whole of text. */\n\
+  static constexpr bool valid(std::string_view text)\n\
+  {\n\
+    YYRECOGNIZER yy(text);\n\
+    return yy.match() == (int)text.size();\n\
+  }\n\
 \n\
-#define	YYACCEPT	yyAccept(yy, yythunkpos0)\n\
+  std::string_view _buf;\n\
+  int		   _pos= 0;\n\
+  int		   _maxpos= 0;\n\
+  int		   _begin= 0;\n\
+  int		   _end= 0;\n\
 \n\
-";
-
-static char *footer= "\n\
+  static constexpr void yyrecordMaxPos(yycontext *yy)\n\
+  {\n\
+    if (yy->_pos > yy->_maxpos)\n\
+      yy->_maxpos= yy->_pos;\n\
+  }\n\
 \n\
-#ifndef YY_PART\n\
+  static constexpr int yymatchDot(yycontext *yy)\n\
+  {\n\
+    if (yy->_pos >= (int)yy->_buf.size()) return 0;\n\
+    ++yy->_pos;\n\
+    yyrecordMaxPos(yy);\n\
+    return 1;\n\
+  }\n\
 \n\
-typedef int (*yyrule)(yycontext *yy);\n\
+  static constexpr int yymatchChar(yycontext *yy, int c)\n\
+  {\n\
+    if (yy->_pos >= (int)yy->_buf.size() || (unsigned char)yy->_buf[yy->_pos] != c) return 0;\n\
+    ++yy->_pos;\n\
+    yyrecordMaxPos(yy);\n\
+    return 1;\n\
+  }\n\
 \n\
-YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)\n\
-{\n\
-  int yyok;\n\
-  if (!yyctx->_buflen)\n\
-    {\n\
-      yyctx->_buflen= YY_BUFFER_SIZE;\n\
-      yyctx->_buf= (char *)YY_MALLOC(yyctx, yyctx->_buflen);\n\
-      yyctx->_textlen= YY_BUFFER_SIZE;\n\
-      yyctx->_text= (char *)YY_MALLOC(yyctx, yyctx->_textlen);\n\
-      yyctx->_thunkslen= YY_STACK_SIZE;\n\
-      yyctx->_thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * yyctx->_thunkslen);\n\
-#ifdef __cplusplus\n\
-      yyctx->_vals = new std::vector<YYSTYPE>();\n\
-      yyctx->_vals->reserve(YY_STACK_SIZE);\n\
-#else\n\
-      yyctx->_valslen= YY_STACK_SIZE;\n\
-      yyctx->_vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * yyctx->_valslen);\n\
-      memset(yyctx->_vals, 0, sizeof(YYSTYPE) * yyctx->_valslen);\n\
-#endif\n\
-      yyctx->_begin= yyctx->_end= yyctx->_pos= yyctx->_limit= yyctx->_maxpos= yyctx->_thunkpos= 0;\n\
-    }\n\
-  yyctx->_begin= yyctx->_end= yyctx->_pos;\n\
-  yyctx->_thunkpos= 0;\n\
-#ifdef __cplusplus\n\
-  yyctx->_vals->resize(1);\n\
-  yyctx->_val = &yyctx->_vals->back();\n\
-#else\n\
-  yyctx->_val= yyctx->_vals;\n\
-#endif\n\
-  yyok= yystart(yyctx);\n\
-  if (yyok) yyDone(yyctx);\n\
-  yyCommit(yyctx);\n\
-  return yyok;\n\
-}\n\
+  static constexpr int yymatchString(yycontext *yy, const char *s)\n\
+  {\n\
+    int yysav= yy->_pos;\n\
+    for (;  *s;  ++s, ++yy->_pos)\n\
+      if (yy->_pos >= (int)yy->_buf.size() || yy->_buf[yy->_pos] != *s)\n\
+	{\n\
+	  yy->_pos= yysav;\n\
+	  return 0;\n\
+	}\n\
+    yyrecordMaxPos(yy);\n\
+    return 1;\n\
+  }\n\
 \n\
-YY_PARSE(int) YYPARSE(YY_CTX_PARAM)\n\
-{\n\
-  return YYPARSEFROM(YY_CTX_ARG_ yyr%s);\n\
-}\n\
+  static constexpr int yymatchIString(yycontext *yy, const char *s)\n\
+  {\n\
+    int yysav= yy->_pos;\n\
+    for (;  *s;  ++s, ++yy->_pos)\n\
+      {\n\
+	int c= yy->_pos < (int)yy->_buf.size() ? (unsigned char)yy->_buf[yy->_pos] : -1;\n\
+	if (('A' <= c && c <= 'Z' ? c - 'A' + 'a' : c) != *s)\n\
+	  {\n\
+	    yy->_pos= yysav;\n\
+	    return 0;\n\
+	  }\n\
+      }\n\
+    yyrecordMaxPos(yy);\n\
+    return 1;\n\
+  }\n\
 \n\
-YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)\n\
-{\n\
-  if (yyctx->_buflen)\n\
-    {\n\
-      yyctx->_buflen= 0;\n\
-      YY_FREE(yyctx, yyctx->_buf);\n\
-      YY_FREE(yyctx, yyctx->_text);\n\
-      YY_FREE(yyctx, yyctx->_thunks);\n\
-#ifdef __cplusplus\n\
-      delete yyctx->_vals;\n\
-#else\n\
-      YY_FREE(yyctx, yyctx->_vals);\n\
-#endif\n\
-    }\n\
-  return yyctx;\n\
-}\n\
+  static constexpr int yymatchClass(yycontext *yy, const char *bits)\n\
+  {\n\
+    int c;\n\
+    if (yy->_pos >= (int)yy->_buf.size()) return 0;\n\
+    c= (unsigned char)yy->_buf[yy->_pos];\n\
+    if (!((unsigned char)bits[c >> 3] & (1 << (c & 7)))) return 0;\n\
+    ++yy->_pos;\n\
+    yyrecordMaxPos(yy);\n\
+    return 1;\n\
+  }\n\
 \n\
-#endif\n\
+  static constexpr std::string_view yyText(yycontext *yy)\n\
+  {\n\
+    return yy->_end > yy->_begin ? yy->_buf.substr(yy->_begin, yy->_end - yy->_begin) : std::string_view();\n\
+  }\n\
 ";
 
-void Rule_compile_c_header(void)
+/* Compile the grammar to a recognizer whose members are all constexpr.
+ * It matches without allocating or running actions, so a literal can be
+ * checked by the compiler with static_assert.
+ */
+static void Rule_compile_cx(Node *node)
 {
-  fprintf(output, "/* A recursive-descent parser generated by peg %d.%d.%d */\n", PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
-  fprintf(output, "\n");
-  fprintf(output, "%s", header);
-  fprintf(output, "#define YYRULECOUNT %d\n", ruleCount);
+  Node *n;
+  int	id;
+
+  fprintf(output, "%s", cxPreamble);
+  fprintf(output, "\n  /* Match the start rule at the start of the text and answer the length\n");
+  fprintf(output, "   * of the match, or -1 if it fails.\n   */\n");
+  fprintf(output, "  constexpr int match()\t{ return yyr%s(this) ? _pos : -1; }\n", start->rule.name);
+  for (n= node;  n;  n= n->rule.next)
+    if (!n->rule.expression)
+      fprintf(stderr, "rule '%s' used but not defined\n", n->rule.name);
+    else
+      {
+	if ((!(RuleUsed & n->rule.flags)) && (n != start))
+	  fprintf(stderr, "rule '%s' defined but not used\n", n->rule.name);
+	id= Node_compile_cx(n->rule.expression);
+	fprintf(output, "\nstatic constexpr int yyr%s(yycontext *yy)\n{", n->rule.name);
+	fprintf(output, "\n  int yypos= yy->_pos;\n  if (");
+	Node_compile_cx_call(n->rule.expression, id);
+	fprintf(output, " > 0) return 1;\n  yy->_pos= yypos;\n  return 0;\n}\n");
+      }
+  fprintf(output, "\n};\n\n#undef yytext\n#undef yyleng\n");
 }
 
-int consumesInput(Node *node)
+/* Token rules are run speculatively by the scanner, so any action
+ * that they reach must be deferred even with -e.
+ */
+static void Node_deferActions(Node *node)
 {
-  if (!node) return 0;
-
   switch (node->type)
     {
-    case Rule:
+    case Name:
       {
-	int result= 0;
-	if (RuleReached & node->rule.flags)
-	  fprintf(stderr, "possible infinite left recursion in rule '%s'\n", node->rule.name);
-	else
+	Node *rule= node->name.rule;
+	if (rule->rule.expression && !(RuleReached & rule->rule.flags))
 	  {
-	    node->rule.flags |= RuleReached;
-	    result= consumesInput(node->rule.expression);
-	    node->rule.flags &= ~RuleReached;
+	    rule->rule.flags |= RuleReached;
+	    Node_deferActions(rule->rule.expression);
 	  }
-	return result;
       }
       break;
-
-    case Dot:		return 1;
-    case Name:		return consumesInput(node->name.rule);
-    case Character:
-    case String:	return strlen(node->string.value) > 0;
-    case Class:		return 1;
-    case Action:	return 0;
-    case Inline:	return 0;
-    case Predicate:	return 0;
-    case Error:		return consumesInput(node->error.element);
-
+    case Action:	node->action.eager= 0;			break;
+    case Error:		Node_deferActions(node->error.element);	break;
     case Alternate:
+    case Sequence:
       {
 	Node *n;
 	for (n= node->alternate.first;  n;  n= n->alternate.next)
-	  if (!consumesInput(n))
-	    return 0;
+	  Node_deferActions(n);
       }
-      return 1;
+      break;
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		Node_deferActions(node->query.element);	break;
+    default:							break;
+    }
+}
 
-    case Sequence:
+static void Rule_deferTokenActions(void)
+{
+  Node *n;
+  for (n= rules;  n;  n= n->rule.next)
+    if (n->rule.token && n->rule.expression && !(RuleReached & n->rule.flags))
       {
-	Node *n;
-	for (n= node->alternate.first;  n;  n= n->alternate.next)
-	  if (consumesInput(n))
-	    return 1;
+	n->rule.flags |= RuleReached;
+	Node_deferActions(n->rule.expression);
       }
-      return 0;
+  for (n= rules;  n;  n= n->rule.next)
+    n->rule.flags &= ~RuleReached;
+}
 
-    case PeekFor:	return 0;
-    case PeekNot:	return 0;
-    case Query:		return 0;
-    case Star:		return 0;
-    case Plus:		return consumesInput(node->plus.element);
+/* Emit the token kinds, the token rules in order of kind, and the
+ * scanner that finds the token at a position with them.
+ */
+static void Rule_compile_tokens(void)
+{
+  Node **kinds= calloc(tokens + 1, sizeof(Node *)), *n;
+  int    kind;
 
-    default:
-      fprintf(stderr, "\nconsumesInput: illegal node type %d\n", node->type);
-      exit(1);
-    }
+  for (n= rules;  n;  n= n->rule.next)
+    if (n->rule.token)
+      kinds[n->rule.token]= n;
+  fprintf(output, "enum {\n  YYTOKEN_NONE= 0,\n");
+  for (kind= 1;  kind <= tokens;  ++kind)
+    fprintf(output, "  YYTOKEN_%s,\n", kinds[kind]->rule.name);
+  fprintf(output, "  YYTOKEN_COUNT\n};\n\n");
+  fprintf(output, "static int (*yytokenrules[])(yycontext *yy)= {\n  0,\n");
+  for (kind= 1;  kind <= tokens;  ++kind)
+    fprintf(output, "  yyr%s,\n", kinds[kind]->rule.name);
+  fprintf(output, "};\n");
+  fprintf(output, "%s", tokenRuntime);
+  free(kinds);
+}
+
+/* Emit the names of the rules, by id, and of the rule containing each
+ * action, by number, for the events of YY_EVENTS.
+ */
+static void Rule_compile_eventnames(void)
+{
+  const char **names= calloc(ruleCount + 1, sizeof(char *));
+  Node	      *n;
+  int	       id, count= 0;
+
+  for (n= rules;  n;  n= n->rule.next)
+    names[n->rule.id]= n->rule.name;
+  fprintf(output, "static const char *const yyrulenames[]= {\n  0,\n");
+  for (id= 1;  id <= ruleCount;  ++id)
+    fprintf(output, names[id] ? "  \"%s\",\n" : "  0,\n", names[id]);
+  fprintf(output, "};\nstatic const char *const yyactionrules[]= {\n  0,\n");
+  for (n= actions;  n;  n= n->action.list)
+    ++count;
+  names= realloc(names, (count + 1) * sizeof(char *));
+  for (id= count, n= actions;  n;  n= n->action.list)	/* the newest action is first */
+    names[id--]= n->action.rule->rule.name;
+  for (id= 1;  id <= count;  ++id)
+    fprintf(output, "  \"%s\",\n", names[id]);
+  fprintf(output, "};\n");
+  free(names);
+}
+
+/* Emit the structural characters, as a class and as a list, and the
+ * functions that index them.
+ */
+static void Rule_compile_structural(void)
+{
+  int c, n= 0;
+  makeCharBits((unsigned char *)structuralClass, structuralBits);
+  fprintf(output, "static const unsigned char *yystructural= (const unsigned char *)\"%s\";\n", formatCharBits(structuralBits));
+  fprintf(output, "static const char yystructurals[]= \"");
+  for (c= 0;  c < 256;  ++c)
+    if (structuralBits[c >> 3] & (1 << (c & 7)))
+      {
+	fprintf(output, "\\%03o", c);
+	++n;
+      }
+  fprintf(output, "\";\n");
+  fprintf(output, "static const int yystructuralcount= %d;\n\n", n);
+  fprintf(output, "%s\n", structuralRuntime);
+}
+
+/* Emit the kinds of lazy rule, and the rules themselves in order of
+ * kind for yyparsespan().
+ */
+static void Rule_compile_lazies(void)
+{
+  Node **kinds= calloc(lazies + 1, sizeof(Node *)), *n;
+  int    kind;
+
+  for (n= rules;  n;  n= n->rule.next)
+    if (n->rule.lazy)
+      kinds[n->rule.lazy]= n;
+  fprintf(output, "enum {\n  YYLAZY_NONE= 0,\n");
+  for (kind= 1;  kind <= lazies;  ++kind)
+    fprintf(output, "  YYLAZY_%s,\n", kinds[kind]->rule.name);
+  fprintf(output, "  YYLAZY_COUNT\n};\n\n");
+  fprintf(output, "static int (*yylazyrules[])(yycontext *yy)= {\n  0,\n");
+  for (kind= 1;  kind <= lazies;  ++kind)
+    fprintf(output, "  yyr%s,\n", kinds[kind]->rule.name);
+  fprintf(output, "};\n\n");
+  free(kinds);
+}
+
+/* The optional drivers, requested with -x, and the symbols that guard
+ * their parts of the runtime.  YY_SEGMENTS_NOCOPY is a variant of
+ * YY_SEGMENTS that the grammar defines for itself.
+ */
+static struct {
+  char *name;
+  char *symbol;
+  int	flag;
+} drivers[]= {
+  { "parallel",	 "YY_PARALLEL",	       1 << 0 },
+  { "batch",	 "YY_BATCH",	       1 << 1 },
+  { "pool",	 "YY_POOL",	       1 << 2 },
+  { "records",	 "YY_RECORDS",	       1 << 3 },
+  { "events",	 "YY_EVENTS",	       1 << 4 },
+  { "readahead", "YY_READAHEAD",       1 << 5 },
+  { "segments",	 "YY_SEGMENTS",	       1 << 6 },
+  { "segments",	 "YY_SEGMENTS_NOCOPY", 1 << 6 },
+  { 0 }
+};
+
+/* The flag for the driver called name, or zero if there is none.
+ */
+int driverFlag(char *name)
+{
+  int i;
+  for (i= 0;  drivers[i].name;  ++i)
+    if (!strcmp(name, drivers[i].name))
+      return drivers[i].flag;
+  return 0;
+}
+
+static int driverSymbol(char *symbol, int length)
+{
+  int i;
+  for (i= 0;  drivers[i].name;  ++i)
+    if ((int)strlen(drivers[i].symbol) == length && !strncmp(symbol, drivers[i].symbol, length))
+      return drivers[i].flag;
   return 0;
 }
 
+/* Whether line is a conditional that can only be true for drivers that
+ * were not requested: '#ifdef' of a driver symbol, or a disjunction of
+ * 'defined()' of them.
+ */
+static int unwanted(char *line)
+{
+  int flag, length;
+
+  if (!strncmp(line, "#ifdef ", 7))
+    return (flag= driverSymbol(line + 7, strcspn(line + 7, "\n"))) && !(flag & driverFlags);
+  if (strncmp(line, "#if ", 4))
+    return 0;
+  for (line += 4;  ;  line += 4)
+    {
+      if (strncmp(line, "defined(", 8))
+	return 0;
+      line += 8;
+      length= strcspn(line, ")");
+      if (!(flag= driverSymbol(line, length)) || (flag & driverFlags))
+	return 0;
+      line += length + 1;
+      if ('\n' == *line || !*line)
+	return 1;
+      if (strncmp(line, " || ", 4))
+	return 0;
+    }
+}
+
+/* A copy of the runtime text, without the code of the drivers that were
+ * not requested.  Where such a conditional has an #else its alternative
+ * is kept.
+ */
+static char *Runtime_select(char *text)
+{
+  char *copy= malloc(strlen(text) + 1), *out= copy, *next;
+  char	state[64];	/* for each open conditional: 0 kept, 1 dropped, 2 the #else of one dropped */
+  int	depth= 0, dropping= 0, keep;
+
+  for (;  *text;  text= next)
+    {
+      next= strchr(text, '\n');
+      next= next ? next + 1 : text + strlen(text);
+      keep= !dropping;
+      if (!strncmp(text, "#if", 3))
+	{
+	  assert(depth < (int)sizeof(state));
+	  state[depth]= !dropping && unwanted(text);
+	  keep= !dropping && !state[depth];
+	  dropping += state[depth++];
+	}
+      else if (!strncmp(text, "#else", 5) && depth && 1 == state[depth - 1])
+	{
+	  state[depth - 1]= 2;
+	  --dropping;
+	  keep= 0;
+	}
+      else if (!strncmp(text, "#endif", 6) && depth)
+	{
+	  if (state[--depth])
+	    {
+	      dropping -= (1 == state[depth]);
+	      keep= 0;
+	    }
+	}
+      if (keep)
+	{
+	  memcpy(out, text, next - text);
+	  out += next - text;
+	}
+    }
+  *out= '\0';
+  return copy;
+}
 
 void Rule_compile_c(Node *node, int nolines)
 {
   Node *n;
+  char *runtime;
+  int	i;
 
   for (n= rules;  n;  n= n->rule.next)
     consumesInput(n);
 
-  fprintf(output, "%s", preamble);
+  tokens= (bytecodeFlag || gotoFlag || cppFlag || constexprFlag) ? 0 : lastToken;
+  lazies= (bytecodeFlag || cppFlag || constexprFlag) ? 0 : lastLazy;
+  structural= !(bytecodeFlag || cppFlag || constexprFlag) && structuralClass;
+  events= !(cppFlag || constexprFlag) && (driverFlags & driverFlag("events"));
+  compiling= 0;
+
+  if (eagerFlag)
+    {
+      Rule_markEager();
+      if (tokens)
+	Rule_deferTokenActions();
+    }
+
+  if (constexprFlag)
+    {
+      Rule_compile_cx(node);
+      return;
+    }
+  if (cppFlag)
+    {
+      Rule_compile_cpp(node, nolines);
+      return;
+    }
+
+  if (streamFlag)
+    fprintf(output, "#define YY_STREAM\n");
+  if (gotoFlag || bytecodeFlag)
+    fprintf(output, "#define YY_FRAMES\n");
+  if (tokens)
+    fprintf(output, "#define YY_TOKENS\n");
+  if (lazies)
+    {
+      int count= 0;
+      for (n= actions;  n;  n= n->action.list)
+	++count;
+      fprintf(output, "#define YY_LAZY\t(yyThunkActions + %d)\n", count);
+    }
+  if (structural)
+    fprintf(output, "#define YY_STRUCTURAL\n");
+  if (reentrantFlag)
+    fprintf(output, "#ifndef YY_CTX_LOCAL\n#define YY_CTX_LOCAL\n#endif\n");
+  for (i= 0;  drivers[i].name;  ++i)
+    if ((drivers[i].flag & driverFlags) && (!i || drivers[i].flag != drivers[i - 1].flag))
+      fprintf(output, "#ifndef %s\n#define %s\n#endif\n", drivers[i].symbol, drivers[i].symbol);
+  if (events)
+    Rule_compile_eventnames();
+  fprintf(output, "%s", runtime= Runtime_select(preamble));
+  free(runtime);
   for (n= node;  n;  n= n->rule.next)
     fprintf(output, "YY_RULE(int) yyr%s(yycontext *yy); /* %d */\n", n->rule.name, n->rule.id);
   fprintf(output, "\n");
-  for (n= actions;  n;  n= n->action.list)
+  if (tokens)
+    Rule_compile_tokens();
+  if (lazies)
+    Rule_compile_lazies();
+  if (structural)
+    Rule_compile_structural();
+  Action_compile_c(nolines);
+  if (bytecodeFlag)
+    Rule_compile_vm(node);
+  else
     {
-      fprintf(output, "YY_ACTION(void) yy%s(yycontext *yy, char *yytext, int yyleng)\n{\n", n->action.name);
-      defineVariables(n->action.rule->rule.variables);
-      fprintf(output, "  yyprintf((stderr, \"do yy%s\\n\"));\n", n->action.name);
-      fprintf(output, "  {\n");
-      if (!nolines)
-	fprintf(output, "#line %i\n", n->action.line);
-      fprintf(output, "  %s;\n", n->action.text);
-      fprintf(output, "  }\n");
-      undefineVariables(n->action.rule->rule.variables);
-      fprintf(output, "}\n");
+      Rule_compile_scanners(node);
+      if (gotoFlag)
+	Goto_compile_c(node);
+      else
+	Rule_compile_c2(node);
     }
-  Rule_compile_c2(node);
-  fprintf(output, footer, start->rule.name);
+  fprintf(output, runtime= Runtime_select(footer), start->rule.name, start->rule.name);
+  free(runtime);
 }
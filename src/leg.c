@@ -7,7 +7,7 @@
 #ifdef __cplusplus
   #include <vector>
 #endif
-#define YYRULECOUNT 38
+#define YYRULECOUNT 45
 #line 20 "src/leg.leg"
 
 # include "tree.h"
@@ -19,6 +19,10 @@
 # include <string.h>
 # include <libgen.h>
 # include <assert.h>
+# ifdef PEG_LIBRARY
+#   include <errno.h>
+#   include <setjmp.h>
+# endif
 
   typedef struct Header Header;
 
@@ -40,6 +44,7 @@
   static int	 trailerLine= 0;
   static char	*trailer= 0;
   static Header	*headers= 0;
+  static char	*typeName= 0;
 
   void makeHeader(int line, char *text);
   void makeTrailer(int line, char *text);
@@ -77,6 +82,13 @@
 #ifndef YY_PARSE
 #define YY_PARSE(T)	T
 #endif
+#ifndef YY_UNUSED
+# ifdef __GNUC__
+#  define YY_UNUSED	__attribute__((unused))
+# else
+#  define YY_UNUSED
+# endif
+#endif
 #ifndef YYPARSE
 #define YYPARSE		yyparse
 #endif
@@ -86,6 +98,12 @@
 #ifndef YYRELEASE
 #define YYRELEASE	yyrelease
 #endif
+#ifndef YYRESET
+#define YYRESET		yyreset
+#endif
+#if defined(YY_LAZY) && !defined(YYPARSESPAN)
+#define YYPARSESPAN	yyparsespan
+#endif
 #ifndef YY_BEGIN
 #define YY_BEGIN	( yy->_begin= yy->_pos, 1)
 #endif
@@ -108,11 +126,65 @@
 #define YY_BUFFER_SIZE 1024
 #endif
 
+#if defined(YY_PUSH) || defined(YY_QUOTA)
+#define YY_COROUTINE
+#if defined(__has_include)
+#if !__has_include(<ucontext.h>)
+#error "YY_PUSH needs ucontext, which this platform does not provide"
+#endif
+#elif defined(_WIN32)
+#error "YY_PUSH needs ucontext, which this platform does not provide"
+#endif
+#include <stdint.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#if !defined(YY_COROUTINE_STACK_SIZE) && defined(YY_PUSH_STACK_SIZE)
+#define YY_COROUTINE_STACK_SIZE YY_PUSH_STACK_SIZE
+#endif
+#ifndef YY_COROUTINE_STACK_SIZE
+#define YY_COROUTINE_STACK_SIZE (256 * 1024)
+#endif
+enum { YYPARSE_NEED_MORE= 0, YYPARSE_ACCEPT, YYPARSE_REJECT, YYPARSE_YIELD };
+#define YYPUSH_NEED_MORE	YYPARSE_NEED_MORE	/* the names used before YY_QUOTA */
+#define YYPUSH_ACCEPT		YYPARSE_ACCEPT
+#define YYPUSH_REJECT		YYPARSE_REJECT
+#endif
+#ifdef YY_PUSH
+#ifndef YYPUSH
+#define YYPUSH		yypush
+#endif
+#endif
+#ifdef YY_QUOTA
+#ifndef YYPARSEQUOTA
+#define YYPARSEQUOTA	yyparsequota
+#endif
+#endif
+#ifdef YY_STRUCTURAL
+#include <stdint.h>
+#endif
+#define yyEventEnter(yy, rule)
+#define yyEventLeave(yy, rule)
+#ifdef YY_LIMITS
+#include <setjmp.h>
+#ifndef YYCANCEL
+#define YYCANCEL	yycancel
+#endif
+enum { YYLIMIT_NONE= 0, YYLIMIT_STEPS, YYLIMIT_DEPTH, YYLIMIT_BUFFER, YYLIMIT_THUNKS, YYLIMIT_CANCEL };
+#endif
+
 #ifndef YY_PART
 
 typedef struct _yycontext yycontext;
-typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);
-typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+typedef struct _yythunk { int begin, end;  unsigned short action; } yythunk;
+#ifdef YY_TOKENS
+typedef struct _yytoken { int kind;  size_t begin, end; } yytoken;
+#endif
+#ifdef YY_LAZY
+typedef struct _yyspan { int rule;  size_t begin, end; } yyspan;
+#endif
+
+enum { yyThunkPush= 0, yyThunkPop, yyThunkSet, yyThunkActions };
 
 struct _yycontext {
   char     *_buf;
@@ -128,6 +200,8 @@ struct _yycontext {
   yythunk  *_thunks;
   int       _thunkslen;
   int       _thunkpos;
+  int       _choices;
+  size_t    _offset;
   YYSTYPE   _;
   YYSTYPE  *_val;
 #ifdef __cplusplus
@@ -135,6 +209,48 @@ struct _yycontext {
 #else
   YYSTYPE  *_vals;
   int       _valslen;
+#endif
+  int      *_frames;
+  int       _frameslen;
+  int       _frametop;
+#ifdef YY_COROUTINE
+  int       _final;
+  int       _status;
+  char     *_stack;
+  ucontext_t _parser;
+  ucontext_t _caller;
+#endif
+#ifdef YY_QUOTA
+  int       _quota;
+  int       _steps;
+#endif
+#ifdef YY_LIMITS
+  long      _maxsteps;
+  int       _maxdepth;
+  int       _maxbuf;
+  int       _maxthunks;
+  int       _cancel;
+  int       _error;
+  long      _stepcount;
+  int       _depth;
+  jmp_buf   _abort;
+#endif
+#ifdef YY_TOKENS
+  yytoken  *_tokens;
+  int       _tokenslen;
+  int       _tokencount;
+  int       _token;
+#endif
+#ifdef YY_STRUCTURAL
+  uint64_t *_index;
+  int       _indexlen;
+  int       _indexed;
+#endif
+#ifdef YY_LAZY
+  yyspan   *_spans;
+  int       _spanslen;
+  int       _spancount;
+  int       _spanning;
 #endif
 #ifdef YY_CTX_MEMBERS
   YY_CTX_MEMBERS
@@ -171,12 +287,59 @@ yycontext *yyctx= &yyctx_;
 #endif
 #endif
 
+#ifdef YY_LIMITS
+#ifdef __GNUC__
+#define yyCancelled(yy)	__atomic_load_n(&yy->_cancel, __ATOMIC_RELAXED)
+#else
+#define yyCancelled(yy)	(*(volatile int *)&yy->_cancel)
+#endif
+YY_LOCAL(void) yyAbort(yycontext *yy, int error)
+{
+  yyprintf((stderr, "limit: abort %d\n", error));
+  yy->_error= error;
+  longjmp(yy->_abort, 1);
+}
+#define yyEnter(yy)	do { if (++yy->_depth > yy->_maxdepth && yy->_maxdepth) yyAbort(yy, YYLIMIT_DEPTH); } while (0)
+#define yyLeave(yy)	--yy->_depth
+#define yyPoll(yy)	do { if (yyCancelled(yy)) yyAbort(yy, YYLIMIT_CANCEL); } while (0)
+#define yyGrow(yy, size, max, error)	do { if ((max) && (size) > (max)) yyAbort(yy, error); } while (0)
+#else
+#define yyEnter(yy)
+#define yyLeave(yy)
+#define yyPoll(yy)
+#define yyGrow(yy, size, max, error)
+#endif
+
+
+
 YY_LOCAL(int) yyrefill(yycontext *yy)
 {
   int yyn;
+#ifdef YY_LAZY
+  if (yy->_spanning) return 0;
+#endif
+#ifdef YY_PUSH
+  while (yy->_pos >= yy->_limit && !yy->_final)
+    {
+      yyprintf((stderr, "push: need more\n"));
+      yy->_status= YYPARSE_NEED_MORE;
+      swapcontext(&yy->_parser, &yy->_caller);
+    }
+  return yy->_pos < yy->_limit;
+#endif
   while (yy->_buflen - yy->_pos < 512)
     {
-      yy->_buflen *= 2;
+      int yylen= yy->_buflen * 2;
+#ifdef YY_LIMITS
+      if (yy->_maxbuf && yylen > yy->_maxbuf)
+	{
+	  if (yy->_buflen >= yy->_maxbuf && yy->_buflen > yy->_pos)
+	    break;					/* read into what room is left */
+	  yyGrow(yy, yy->_pos + 1, yy->_maxbuf, YYLIMIT_BUFFER);
+	  yylen= yy->_maxbuf;
+	}
+#endif
+      yy->_buflen= yylen;
       yy->_buf= (char *)YY_REALLOC(yy, yy->_buf, yy->_buflen);
     }
 #ifdef YY_CTX_LOCAL
@@ -197,16 +360,39 @@ YY_LOCAL(void) yyrecordMaxPos(yycontext *yy)
   }
 }
 
-YY_LOCAL(int) yymatchDot(yycontext *yy)
+#if defined(YY_QUOTA) || defined(YY_LIMITS)
+YY_LOCAL(void) yyStep(yycontext *yy)
+{
+#ifdef YY_LIMITS
+  if (yy->_maxsteps && ++yy->_stepcount > yy->_maxsteps)
+    yyAbort(yy, YYLIMIT_STEPS);
+#endif
+#ifdef YY_QUOTA
+  if (yy->_quota && --yy->_steps < 0)
+    {
+      yyprintf((stderr, "quota: yield\n"));
+      yy->_status= YYPARSE_YIELD;
+      swapcontext(&yy->_parser, &yy->_caller);
+    }
+#endif
+}
+#else
+#define yyStep(yy)
+#endif
+
+/* Scanners match most terminals in place, so any of these may go unused. */
+YY_LOCAL(int) YY_UNUSED yymatchDot(yycontext *yy)
 {
+  yyStep(yy);
   if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
   ++yy->_pos;
   yyrecordMaxPos(yy);
   return 1;
 }
 
-YY_LOCAL(int) yymatchChar(yycontext *yy, int c)
+YY_LOCAL(int) YY_UNUSED yymatchChar(yycontext *yy, int c)
 {
+  yyStep(yy);
   if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
   if ((unsigned char)yy->_buf[yy->_pos] == c)
     {
@@ -219,9 +405,10 @@ YY_LOCAL(int) yymatchChar(yycontext *yy, int c)
   return 0;
 }
 
-YY_LOCAL(int) yymatchString(yycontext *yy, const char *s)
+YY_LOCAL(int) YY_UNUSED yymatchString(yycontext *yy, const char *s)
 {
   int yysav= yy->_pos;
+  yyStep(yy);
   while (*s)
     {
       if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
@@ -237,9 +424,10 @@ YY_LOCAL(int) yymatchString(yycontext *yy, const char *s)
   return 1;
 }
 
-YY_LOCAL(int) yymatchIString(yycontext *yy, const char *s)
+YY_LOCAL(int) YY_UNUSED yymatchIString(yycontext *yy, const char *s)
 {
   int yysav= yy->_pos;
+  yyStep(yy);
   while (*s)
     {
       if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
@@ -255,9 +443,10 @@ YY_LOCAL(int) yymatchIString(yycontext *yy, const char *s)
   return 1;
 }
 
-YY_LOCAL(int) yymatchClass(yycontext *yy, unsigned char *bits)
+YY_LOCAL(int) YY_UNUSED yymatchClass(yycontext *yy, unsigned char *bits)
 {
   int c;
+  yyStep(yy);
   if (yy->_pos >= yy->_limit && !yyrefill(yy)) return 0;
   c= (unsigned char)yy->_buf[yy->_pos];
   if (bits[c >> 3] & (1 << (c & 7)))
@@ -271,11 +460,37 @@ YY_LOCAL(int) yymatchClass(yycontext *yy, unsigned char *bits)
   return 0;
 }
 
-YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)
+#define yyAvail(yy, p)		((p) < (yy)->_limit || ((yy)->_pos= (p), yyrefill(yy)))
+#define yyByte(yy, p)		((unsigned char)(yy)->_buf[p])
+#define yyInClass(bits, c)	((bits)[(c) >> 3] & (1 << ((c) & 7)))
+
+#ifdef YY_FRAMES
+YY_LOCAL(int *) yyGrowFrames(yycontext *yy, int size)
+{
+  if (!yy->_frameslen)
+    {
+      yy->_frameslen= YY_STACK_SIZE;
+      yy->_frames= (int *)YY_MALLOC(yy, sizeof(int) * yy->_frameslen);
+    }
+  while (yy->_frameslen < size)
+    {
+      yy->_frameslen *= 2;
+      yy->_frames= (int *)YY_REALLOC(yy, yy->_frames, sizeof(int) * yy->_frameslen);
+    }
+  return yy->_frames;
+}
+#endif
+
+YY_LOCAL(void) yyDo(yycontext *yy, int action, int begin, int end)
 {
+  yyGrow(yy, yy->_thunkpos + 1, yy->_maxthunks, YYLIMIT_THUNKS);
   while (yy->_thunkpos >= yy->_thunkslen)
     {
       yy->_thunkslen *= 2;
+#ifdef YY_LIMITS
+      if (yy->_maxthunks && yy->_thunkslen > yy->_maxthunks)
+	yy->_thunkslen= yy->_maxthunks;
+#endif
       yy->_thunks= (yythunk *)YY_REALLOC(yy, yy->_thunks, sizeof(yythunk) * yy->_thunkslen);
     }
   yy->_thunks[yy->_thunkpos].begin=  begin;
@@ -302,29 +517,102 @@ YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)
   return yyleng;
 }
 
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng);
+
+#ifdef YY_LAZY
+YY_LOCAL(void) yySpan(yycontext *yy, int rule, int begin, int end)
+{
+  yyspan *span;
+  if (yy->_spancount == yy->_spanslen)
+    {
+      yy->_spanslen= yy->_spanslen ? 2 * yy->_spanslen : YY_STACK_SIZE;
+      yy->_spans= (yyspan *)YY_REALLOC(yy, yy->_spans, sizeof(yyspan) * yy->_spanslen);
+    }
+  span= yy->_spans + yy->_spancount++;
+  span->rule=  rule;
+  span->begin= yy->_offset + begin;
+  span->end=   yy->_offset + end;
+}
+#endif
+
+
 YY_LOCAL(void) yyDone(yycontext *yy)
 {
   int pos;
   for (pos= 0;  pos < yy->_thunkpos;  ++pos)
     {
       yythunk *thunk= &yy->_thunks[pos];
-      int yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
-      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, yy->_text));
-      thunk->action(yy, yy->_text, yyleng);
+      int yyleng;
+#ifdef YY_LAZY
+      if (thunk->action >= YY_LAZY)
+	{
+	  yySpan(yy, thunk->action - YY_LAZY, thunk->begin, thunk->end);
+	  continue;
+	}
+#endif
+      yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %d %s\n", pos, thunk->action, yy->_text));
+      yyDispatch(yy, thunk->action, yy->_text, yyleng);
     }
   yy->_thunkpos= 0;
 }
 
+#ifdef YY_TOKENS
+/* Forget the tokens that begin before the buffer, which can no longer
+ * be matched again.
+ */
+YY_LOCAL(void) yyDropTokens(yycontext *yy)
+{
+  int n= 0;
+  while (n < yy->_tokencount && yy->_tokens[n].begin < yy->_offset) ++n;
+  if (n) memmove(yy->_tokens, yy->_tokens + n, sizeof(yytoken) * (yy->_tokencount -= n));
+  yy->_token= 0;
+}
+#endif
+
 YY_LOCAL(void) yyCommit(yycontext *yy)
 {
-  if ((yy->_limit -= yy->_pos))
-    {
-      memmove(yy->_buf, yy->_buf + yy->_pos, yy->_limit);
-    }
+  yy->_limit -= yy->_pos;
+  if (yy->_limit)
+    memmove(yy->_buf, yy->_buf + yy->_pos, yy->_limit);
   yy->_begin -= yy->_pos;
   yy->_end -= yy->_pos;
+  yy->_offset += yy->_pos;
   yy->_pos= yy->_thunkpos= 0;
+#ifdef YY_STRUCTURAL
+  yy->_indexed= 0;
+#endif
+#ifdef YY_TOKENS
+  yyDropTokens(yy);
+#endif
+}
+
+#ifdef YY_STREAM
+YY_LOCAL(void) yyStream(yycontext *yy)
+{
+  int keep= yy->_pos;
+  if (yy->_begin >= 0 && yy->_begin < keep) keep= yy->_begin;
+  if (yy->_end   >= 0 && yy->_end   < keep) keep= yy->_end;
+  yyDone(yy);
+  if (keep > 0 && keep >= yy->_limit - keep)
+    {
+      yyprintf((stderr, "stream %d of %d\n", keep, yy->_limit));
+      yy->_limit -= keep;
+      memmove(yy->_buf, yy->_buf + keep, yy->_limit);
+      yy->_pos -= keep;
+      yy->_begin -= keep;
+      yy->_end -= keep;
+      yy->_maxpos= (yy->_maxpos > keep) ? yy->_maxpos - keep : 0;
+      yy->_offset += keep;
+#ifdef YY_STRUCTURAL
+      yy->_indexed= 0;
+#endif
+#ifdef YY_TOKENS
+      yyDropTokens(yy);
+#endif
+    }
 }
+#endif
 
 YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)
 {
@@ -370,1134 +658,2005 @@ YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)
 }
 YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)   { yy->_val[count]= yy->_; }
 
+#ifdef YY_LAZY
+#ifndef YY_LAZY_QUOTE
+#define YY_LAZY_QUOTE(c)	('"' == (c) || '\'' == (c))
+#define YY_LAZY_WORDS		/* the quotes are known, so eight bytes can be tested at once */
+#endif
+#ifndef YY_LAZY_COMMENTS
+#define YY_LAZY_COMMENTS	1
+#endif
+#ifdef YY_LAZY_WORDS
+#define yyLazyHas(w, c)	((((w) ^ 0x0101010101010101ULL * (c)) - 0x0101010101010101ULL) & ~((w) ^ 0x0101010101010101ULL * (c)) & 0x8080808080808080ULL)
+#endif
+/* Move over a balanced region without parsing it, and remember where
+ * it was so that it can be parsed later.  Brackets within quotes or
+ * C comments are not counted.  Unless the program has its own quotes,
+ * text between the bytes that matter is passed over a word at a time.
+ */
+YY_LOCAL(int) yyskipLazy(yycontext *yy, int rule, int open, int close)
+{
+  int pos= yy->_pos, p= pos, depth= 0, c;
+  yyStep(yy);
+  if (!yyAvail(yy, p) || yyByte(yy, p) != open)
+    {
+      yy->_pos= pos;
+      return 0;
+    }
+  for (;;)
+    {
+#ifdef YY_LAZY_WORDS
+      for (;  p + 8 <= yy->_limit;  p += 8)
+	{
+	  unsigned long long w;
+	  memcpy(&w, yy->_buf + p, 8);
+	  if (yyLazyHas(w, open) | yyLazyHas(w, close) | yyLazyHas(w, '"') | yyLazyHas(w, '\'') | yyLazyHas(w, '/'))
+	    break;
+	}
+#endif
+      while (p < yy->_limit && (c= yyByte(yy, p)) != open && c != close && !YY_LAZY_QUOTE(c) && '/' != c)
+	++p;
+      if (!yyAvail(yy, p))
+	{
+	  yy->_pos= pos;
+	  return 0;
+	}
+      c= yyByte(yy, p++);
+      if (c == open)
+	++depth;
+      else if (c == close)
+	{
+	  if (!--depth) break;
+	}
+      else if (YY_LAZY_QUOTE(c))
+	{
+	  int d;
+	  while (yyAvail(yy, p) && (d= yyByte(yy, p++)) != c)
+	    if ('\\' == d && yyAvail(yy, p)) ++p;
+	}
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '/' == yyByte(yy, p))
+	{
+	  while (yyAvail(yy, p) && '\n' != yyByte(yy, p)) ++p;
+	}
+      else if (YY_LAZY_COMMENTS && yyAvail(yy, p) && '*' == yyByte(yy, p))
+	{
+	  for (++p;  yyAvail(yy, p) && !('*' == yyByte(yy, p) && yyAvail(yy, p + 1) && '/' == yyByte(yy, p + 1));  ++p);
+	  if (yyAvail(yy, p)) p += 2;
+	}
+    }
+  yy->_pos= p;
+  yyrecordMaxPos(yy);
+  yyDo(yy, YY_LAZY + rule, pos, p);
+  return 1;
+}
+#endif
+
+
 #endif /* YY_PART */
 
 #define	YYACCEPT	yyAccept(yy, yythunkpos0)
 
-YY_RULE(int) yy_comment(yycontext *yy); /* 38 */
-YY_RULE(int) yy_space(yycontext *yy); /* 37 */
-YY_RULE(int) yy_braces(yycontext *yy); /* 36 */
-YY_RULE(int) yy_range(yycontext *yy); /* 35 */
-YY_RULE(int) yy_END(yycontext *yy); /* 34 */
-YY_RULE(int) yy_BEGIN(yycontext *yy); /* 33 */
-YY_RULE(int) yy_DOT(yycontext *yy); /* 32 */
-YY_RULE(int) yy_class(yycontext *yy); /* 31 */
-YY_RULE(int) yy_char(yycontext *yy); /* 30 */
-YY_RULE(int) yy_CLOSE(yycontext *yy); /* 29 */
-YY_RULE(int) yy_OPEN(yycontext *yy); /* 28 */
-YY_RULE(int) yy_COLON(yycontext *yy); /* 27 */
-YY_RULE(int) yy_PLUS(yycontext *yy); /* 26 */
-YY_RULE(int) yy_STAR(yycontext *yy); /* 25 */
-YY_RULE(int) yy_QUESTION(yycontext *yy); /* 24 */
-YY_RULE(int) yy_primary(yycontext *yy); /* 23 */
-YY_RULE(int) yy_NOT(yycontext *yy); /* 22 */
-YY_RULE(int) yy_suffix(yycontext *yy); /* 21 */
-YY_RULE(int) yy_AND(yycontext *yy); /* 20 */
-YY_RULE(int) yy_AT(yycontext *yy); /* 19 */
-YY_RULE(int) yy_action(yycontext *yy); /* 18 */
-YY_RULE(int) yy_TILDE(yycontext *yy); /* 17 */
-YY_RULE(int) yy_prefix(yycontext *yy); /* 16 */
-YY_RULE(int) yy_error(yycontext *yy); /* 15 */
-YY_RULE(int) yy_BAR(yycontext *yy); /* 14 */
-YY_RULE(int) yy_sequence(yycontext *yy); /* 13 */
-YY_RULE(int) yy_SEMICOLON(yycontext *yy); /* 12 */
-YY_RULE(int) yy_expression(yycontext *yy); /* 11 */
-YY_RULE(int) yy_EQUAL(yycontext *yy); /* 10 */
-YY_RULE(int) yy_identifier(yycontext *yy); /* 9 */
-YY_RULE(int) yy_RPERCENT(yycontext *yy); /* 8 */
-YY_RULE(int) yy_end_of_line(yycontext *yy); /* 7 */
-YY_RULE(int) yy_end_of_file(yycontext *yy); /* 6 */
-YY_RULE(int) yy_trailer(yycontext *yy); /* 5 */
-YY_RULE(int) yy_definition(yycontext *yy); /* 4 */
-YY_RULE(int) yy_declaration(yycontext *yy); /* 3 */
-YY_RULE(int) yy_(yycontext *yy); /* 2 */
-YY_RULE(int) yy_grammar(yycontext *yy); /* 1 */
-
-YY_ACTION(void) yy_1_end_of_line(yycontext *yy, char *yytext, int yyleng)
+YY_RULE(int) yyrcomment(yycontext *yy); /* 45 */
+YY_RULE(int) yyrspace(yycontext *yy); /* 44 */
+YY_RULE(int) yyrbraces(yycontext *yy); /* 43 */
+YY_RULE(int) yyrangles(yycontext *yy); /* 42 */
+YY_RULE(int) yyrrange(yycontext *yy); /* 41 */
+YY_RULE(int) yyrCUT(yycontext *yy); /* 40 */
+YY_RULE(int) yyrEND(yycontext *yy); /* 39 */
+YY_RULE(int) yyrBEGIN(yycontext *yy); /* 38 */
+YY_RULE(int) yyrDOT(yycontext *yy); /* 37 */
+YY_RULE(int) yyrchar(yycontext *yy); /* 36 */
+YY_RULE(int) yyrCLOSE(yycontext *yy); /* 35 */
+YY_RULE(int) yyrOPEN(yycontext *yy); /* 34 */
+YY_RULE(int) yyrCOLON(yycontext *yy); /* 33 */
+YY_RULE(int) yyrPLUS(yycontext *yy); /* 32 */
+YY_RULE(int) yyrSTAR(yycontext *yy); /* 31 */
+YY_RULE(int) yyrQUESTION(yycontext *yy); /* 30 */
+YY_RULE(int) yyrprimary(yycontext *yy); /* 29 */
+YY_RULE(int) yyrNOT(yycontext *yy); /* 28 */
+YY_RULE(int) yyrsuffix(yycontext *yy); /* 27 */
+YY_RULE(int) yyrAND(yycontext *yy); /* 26 */
+YY_RULE(int) yyrAT(yycontext *yy); /* 25 */
+YY_RULE(int) yyraction(yycontext *yy); /* 24 */
+YY_RULE(int) yyrTILDE(yycontext *yy); /* 23 */
+YY_RULE(int) yyrprefix(yycontext *yy); /* 22 */
+YY_RULE(int) yyrerror(yycontext *yy); /* 21 */
+YY_RULE(int) yyrBAR(yycontext *yy); /* 20 */
+YY_RULE(int) yyrsequence(yycontext *yy); /* 19 */
+YY_RULE(int) yyrSEMICOLON(yycontext *yy); /* 18 */
+YY_RULE(int) yyrexpression(yycontext *yy); /* 17 */
+YY_RULE(int) yyrclass(yycontext *yy); /* 16 */
+YY_RULE(int) yyrSTRUCTURAL(yycontext *yy); /* 15 */
+YY_RULE(int) yyrLAZY(yycontext *yy); /* 14 */
+YY_RULE(int) yyrTOKEN(yycontext *yy); /* 13 */
+YY_RULE(int) yyrEQUAL(yycontext *yy); /* 12 */
+YY_RULE(int) yyridentifier(yycontext *yy); /* 11 */
+YY_RULE(int) yyrtype(yycontext *yy); /* 10 */
+YY_RULE(int) yyrTYPE(yycontext *yy); /* 9 */
+YY_RULE(int) yyrRPERCENT(yycontext *yy); /* 8 */
+YY_RULE(int) yyrend_of_line(yycontext *yy); /* 7 */
+YY_RULE(int) yyrend_of_file(yycontext *yy); /* 6 */
+YY_RULE(int) yyrtrailer(yycontext *yy); /* 5 */
+YY_RULE(int) yyrdefinition(yycontext *yy); /* 4 */
+YY_RULE(int) yyrdeclaration(yycontext *yy); /* 3 */
+YY_RULE(int) yyr_(yycontext *yy); /* 2 */
+YY_RULE(int) yyrgrammar(yycontext *yy); /* 1 */
+
+enum {
+  yy_1_end_of_line= yyThunkActions + 35,
+  yy_1_action= yyThunkActions + 34,
+  yy_13_primary= yyThunkActions + 33,
+  yy_12_primary= yyThunkActions + 32,
+  yy_11_primary= yyThunkActions + 31,
+  yy_10_primary= yyThunkActions + 30,
+  yy_9_primary= yyThunkActions + 29,
+  yy_8_primary= yyThunkActions + 28,
+  yy_7_primary= yyThunkActions + 27,
+  yy_6_primary= yyThunkActions + 26,
+  yy_5_primary= yyThunkActions + 25,
+  yy_4_primary= yyThunkActions + 24,
+  yy_3_primary= yyThunkActions + 23,
+  yy_2_primary= yyThunkActions + 22,
+  yy_1_primary= yyThunkActions + 21,
+  yy_3_suffix= yyThunkActions + 20,
+  yy_2_suffix= yyThunkActions + 19,
+  yy_1_suffix= yyThunkActions + 18,
+  yy_4_prefix= yyThunkActions + 17,
+  yy_3_prefix= yyThunkActions + 16,
+  yy_2_prefix= yyThunkActions + 15,
+  yy_1_prefix= yyThunkActions + 14,
+  yy_1_error= yyThunkActions + 13,
+  yy_1_sequence= yyThunkActions + 12,
+  yy_1_expression= yyThunkActions + 11,
+  yy_2_definition= yyThunkActions + 10,
+  yy_1_definition= yyThunkActions + 9,
+  yy_2_trailer= yyThunkActions + 8,
+  yy_1_trailer= yyThunkActions + 7,
+  yy_7_declaration= yyThunkActions + 6,
+  yy_6_declaration= yyThunkActions + 5,
+  yy_5_declaration= yyThunkActions + 4,
+  yy_4_declaration= yyThunkActions + 3,
+  yy_3_declaration= yyThunkActions + 2,
+  yy_2_declaration= yyThunkActions + 1,
+  yy_1_declaration= yyThunkActions + 0,
+};
+
+YY_ACTION(void) yyDispatch(yycontext *yy, int yyaction, char *yytext, int yyleng)
 {
+  switch (yyaction)
+    {
+    case yyThunkPush:	yyPush(yy, yytext, yyleng);	break;
+    case yyThunkPop:	yyPop(yy, yytext, yyleng);	break;
+    case yyThunkSet:	yySet(yy, yytext, yyleng);	break;
+    case yy_1_end_of_line:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_end_of_line\n"));
   {
-#line 160
+#line 186
    ++lineNumber ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_action(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_action:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_action\n"));
   {
-#line 133
+#line 154
    actionLine= lineNumber ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_12_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_13_primary:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_13_primary\n"));
+  {
+#line 132
+   push(makeCut()); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_12_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_12_primary\n"));
   {
-#line 116
+#line 131
    push(makePredicate("YY_END")); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_11_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_11_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_11_primary\n"));
   {
-#line 115
+#line 130
    push(makePredicate("YY_BEGIN")); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_10_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_10_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_10_primary\n"));
   {
-#line 114
+#line 129
    push(makeAction(actionLine, yytext)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_9_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_9_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_9_primary\n"));
   {
-#line 113
+#line 128
    push(makeDot()); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_8_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_8_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_8_primary\n"));
   {
-#line 112
+#line 127
    push(makeClass(yytext)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_7_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_7_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_7_primary\n"));
   {
-#line 111
+#line 126
    push(makeString(yytext, 1, 0)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_6_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_6_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_6_primary\n"));
   {
-#line 110
+#line 125
    push(makeString(yytext, 0, 0)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_5_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_5_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_5_primary\n"));
   {
-#line 109
+#line 124
    push(makeString(yytext, 1, 1)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_4_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_4_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_4_primary\n"));
   {
-#line 108
+#line 123
    push(makeString(yytext, 0, 1)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_3_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_3_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_3_primary\n"));
   {
-#line 106
+#line 121
    push(makeName(findRule(yytext))); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_2_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_2_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_2_primary\n"));
   {
-#line 105
+#line 120
    Node *name= makeName(findRule(yytext));  name->name.variable= pop();  push(name); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_primary(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_primary:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_primary\n"));
   {
-#line 104
+#line 119
    push(makeVariable(yytext)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_3_suffix(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_3_suffix:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_3_suffix\n"));
   {
-#line 101
+#line 116
    push(makePlus (pop())); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_2_suffix(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_2_suffix:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_2_suffix\n"));
   {
-#line 100
+#line 115
    push(makeStar (pop())); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_suffix(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_suffix:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_suffix\n"));
   {
-#line 99
+#line 114
    push(makeQuery(pop())); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_4_prefix(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_4_prefix:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_4_prefix\n"));
   {
-#line 96
+#line 111
    push(makePeekNot(pop())); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_3_prefix(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_3_prefix:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_3_prefix\n"));
   {
-#line 95
+#line 110
    push(makePeekFor(pop())); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_2_prefix(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_2_prefix:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_2_prefix\n"));
   {
-#line 94
+#line 109
    push(makePredicate(yytext)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_prefix(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_prefix:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_prefix\n"));
   {
-#line 93
+#line 108
    push(makeInline(yytext)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_error(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_error:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_error\n"));
   {
-#line 90
+#line 105
    push(makeError(pop(), yytext)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_sequence(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_sequence:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_sequence\n"));
   {
-#line 87
+#line 102
    Node *f= pop();  push(Sequence_append(pop(), f)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_expression(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_expression:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_expression\n"));
   {
-#line 84
+#line 99
    Node *f= pop();  push(Alternate_append(pop(), f)); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_2_definition(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_2_definition:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_2_definition\n"));
   {
-#line 81
+#line 96
    Node *e= pop();  Rule_setExpression(pop(), e); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_definition(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_definition:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_definition\n"));
   {
-#line 79
+#line 94
    if (push(beginRule(findRule(yytext)))->rule.expression)
 							    fprintf(stderr, "rule '%s' redefined\n", yytext); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_2_trailer(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_2_trailer:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_2_trailer\n"));
   {
-#line 77
+#line 92
    makeTrailer(headerLine, yytext); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_trailer(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_trailer:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_trailer\n"));
   {
-#line 76
+#line 91
    headerLine= lineNumber ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_2_declaration(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_7_declaration:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_7_declaration\n"));
+  {
+#line 89
+   free(structuralClass);  structuralClass= strdup(yytext); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_6_declaration:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_6_declaration\n"));
+  {
+#line 87
+   Rule_beLazy(findRule(yytext)); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_5_declaration:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_5_declaration\n"));
+  {
+#line 84
+   Rule_beToken(findRule(yytext)); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_4_declaration:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_4_declaration\n"));
+  {
+#line 81
+   Rule_setType(findRule(yytext), typeName); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_3_declaration:
+      {
+#define y_ yy->_
+#define yypos yy->_pos
+#define yythunkpos yy->_thunkpos
+  yyprintf((stderr, "do yy_3_declaration\n"));
+  {
+#line 80
+   free(typeName);  typeName= strdup(yytext); ;
+  }
+#undef yythunkpos
+#undef yypos
+#undef y_
+      }
+      break;
+    case yy_2_declaration:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_2_declaration\n"));
   {
-#line 74
+#line 79
    makeHeader(headerLine, yytext); ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
-}
-YY_ACTION(void) yy_1_declaration(yycontext *yy, char *yytext, int yyleng)
-{
+#undef y_
+      }
+      break;
+    case yy_1_declaration:
+      {
 #define y_ yy->_
 #define yypos yy->_pos
 #define yythunkpos yy->_thunkpos
   yyprintf((stderr, "do yy_1_declaration\n"));
   {
-#line 72
+#line 77
    headerLine= lineNumber; ;
   }
 #undef yythunkpos
 #undef yypos
-#undef yy
+#undef y_
+      }
+      break;
+    }
 }
 
-YY_RULE(int) yy_comment(yycontext *yy)
-{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "comment"));  if (!yymatchChar(yy, '#')) goto l1;
-  l2:;	
-  {  int yypos3= yy->_pos, yythunkpos3= yy->_thunkpos;
-  {  int yypos4= yy->_pos, yythunkpos4= yy->_thunkpos;  int yymaxpos4= yy->_maxpos;  if (!yy_end_of_line(yy)) goto l4;  yy->_maxpos= yymaxpos4;  goto l3;
-  l4:;	  yy->_pos= yypos4; yy->_thunkpos= yythunkpos4;  yy->_maxpos= yymaxpos4;
-  }  if (!yymatchDot(yy)) goto l3;  goto l2;
-  l3:;	  yy->_pos= yypos3; yy->_thunkpos= yythunkpos3;
-  }  if (!yy_end_of_line(yy)) goto l1;
-  yyprintf((stderr, "  ok   %s @ %s\n", "comment", yy->_buf+yy->_pos));
-  return 1;
-  l1:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "comment", yy->_buf+yy->_pos));
-  return 0;
+
+YY_LOCAL(int) yyscan0(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq2= yyp, yym2= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 125) goto l2;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym2;  goto l1;
+  l2:;	  yyp= yyq2;  yym= yym2;  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l1:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan1(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq4= yyp, yym4= yym;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\000\120\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l4;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym4;  goto l3;
+  l4:;	  yyp= yyq4;  yym= yym4;  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l3:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan2(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq7= yyp;
+  { int yyq10= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l11;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l11;  ++yyp;  if (yyp > yym) yym= yyp;  goto l9;
+  l11:;	  yyp= yyq10;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l12;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l12;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l12;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l12;  ++yyp;  if (yyp > yym) yym= yyp;  goto l9;
+  l12:;	  yyp= yyq10;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l13;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l13;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l13;  ++yyp;  if (yyp > yym) yym= yyp;  goto l9;
+  l13:;	  yyp= yyq10;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l14;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l14;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l14;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l14;  ++yyp;  if (yyp > yym) yym= yyp;  goto l9;
+  l14:;	  yyp= yyq10;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l15;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l15;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq16= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l16;  ++yyp;  if (yyp > yym) yym= yyp;  goto l17;
+  l16:;	  yyp= yyq16;
+  l17:;	  }  goto l9;
+  l15:;	  yyp= yyq10;
+  { int yyq18= yyp, yym18= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l18;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym18;  goto l8;
+  l18:;	  yyp= yyq18;  yym= yym18;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l8;  ++yyp;  if (yyp > yym) yym= yyp;
+  l9:;	  }
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 45) goto l8;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq20= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l21;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l21;  ++yyp;  if (yyp > yym) yym= yyp;  goto l19;
+  l21:;	  yyp= yyq20;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l22;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l22;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l22;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l22;  ++yyp;  if (yyp > yym) yym= yyp;  goto l19;
+  l22:;	  yyp= yyq20;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l23;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l23;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l23;  ++yyp;  if (yyp > yym) yym= yyp;  goto l19;
+  l23:;	  yyp= yyq20;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l24;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l24;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l24;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l24;  ++yyp;  if (yyp > yym) yym= yyp;  goto l19;
+  l24:;	  yyp= yyq20;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l25;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l25;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq26= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l26;  ++yyp;  if (yyp > yym) yym= yyp;  goto l27;
+  l26:;	  yyp= yyq26;
+  l27:;	  }  goto l19;
+  l25:;	  yyp= yyq20;
+  { int yyq28= yyp, yym28= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l28;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym28;  goto l8;
+  l28:;	  yyp= yyq28;  yym= yym28;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l8;  ++yyp;  if (yyp > yym) yym= yyp;
+  l19:;	  }  goto l6;
+  l8:;	  yyp= yyq7;
+  { int yyq30= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l31;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l31;  ++yyp;  if (yyp > yym) yym= yyp;  goto l29;
+  l31:;	  yyp= yyq30;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l32;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l32;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l32;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l32;  ++yyp;  if (yyp > yym) yym= yyp;  goto l29;
+  l32:;	  yyp= yyq30;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l33;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l33;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l33;  ++yyp;  if (yyp > yym) yym= yyp;  goto l29;
+  l33:;	  yyp= yyq30;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l34;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l34;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l34;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l34;  ++yyp;  if (yyp > yym) yym= yyp;  goto l29;
+  l34:;	  yyp= yyq30;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l35;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l35;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq36= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l36;  ++yyp;  if (yyp > yym) yym= yyp;  goto l37;
+  l36:;	  yyp= yyq36;
+  l37:;	  }  goto l29;
+  l35:;	  yyp= yyq30;
+  { int yyq38= yyp, yym38= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l38;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym38;  goto l5;
+  l38:;	  yyp= yyq38;  yym= yym38;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l5;  ++yyp;  if (yyp > yym) yym= yyp;
+  l29:;	  }
+  l6:;	  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l5:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan3(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq41= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l42;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l42;  ++yyp;  if (yyp > yym) yym= yyp;  goto l40;
+  l42:;	  yyp= yyq41;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l43;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l43;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l43;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l43;  ++yyp;  if (yyp > yym) yym= yyp;  goto l40;
+  l43:;	  yyp= yyq41;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l44;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l44;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l44;  ++yyp;  if (yyp > yym) yym= yyp;  goto l40;
+  l44:;	  yyp= yyq41;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l45;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l45;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l45;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l45;  ++yyp;  if (yyp > yym) yym= yyp;  goto l40;
+  l45:;	  yyp= yyq41;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l46;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l46;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq47= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l47;  ++yyp;  if (yyp > yym) yym= yyp;  goto l48;
+  l47:;	  yyp= yyq47;
+  l48:;	  }  goto l40;
+  l46:;	  yyp= yyq41;
+  { int yyq49= yyp, yym49= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l49;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym49;  goto l39;
+  l49:;	  yyp= yyq49;  yym= yym49;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l39;  ++yyp;  if (yyp > yym) yym= yyp;
+  l40:;	  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l39:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan4(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l50;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l50;
+  { int yyq52;
+  l51:;	  yyPoll(yy);  yyq52= yyp;
+  { int yyq53= yyp, yym53= yym;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l53;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym53;  goto l52;
+  l53:;	  yyp= yyq53;  yym= yym53;  }
+  { int yyq55= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l56;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l56;  ++yyp;  if (yyp > yym) yym= yyp;  goto l54;
+  l56:;	  yyp= yyq55;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l57;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l57;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l57;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l57;  ++yyp;  if (yyp > yym) yym= yyp;  goto l54;
+  l57:;	  yyp= yyq55;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l58;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l58;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l58;  ++yyp;  if (yyp > yym) yym= yyp;  goto l54;
+  l58:;	  yyp= yyq55;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l59;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l59;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l59;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l59;  ++yyp;  if (yyp > yym) yym= yyp;  goto l54;
+  l59:;	  yyp= yyq55;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l60;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l60;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq61= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l61;  ++yyp;  if (yyp > yym) yym= yyp;  goto l62;
+  l61:;	  yyp= yyq61;
+  l62:;	  }  goto l54;
+  l60:;	  yyp= yyq55;
+  { int yyq63= yyp, yym63= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l63;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym63;  goto l52;
+  l63:;	  yyp= yyq63;  yym= yym63;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l52;  ++yyp;  if (yyp > yym) yym= yyp;
+  l54:;	  }  goto l51;
+  l52:;	  yyp= yyq52;  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l50;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l50;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l50;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l50:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan5(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l64;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l64;
+  { int yyq66;
+  l65:;	  yyPoll(yy);  yyq66= yyp;
+  { int yyq67= yyp, yym67= yym;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l67;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym67;  goto l66;
+  l67:;	  yyp= yyq67;  yym= yym67;  }
+  { int yyq69= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l70;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l70;  ++yyp;  if (yyp > yym) yym= yyp;  goto l68;
+  l70:;	  yyp= yyq69;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l71;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l71;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l71;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l71;  ++yyp;  if (yyp > yym) yym= yyp;  goto l68;
+  l71:;	  yyp= yyq69;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l72;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l72;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l72;  ++yyp;  if (yyp > yym) yym= yyp;  goto l68;
+  l72:;	  yyp= yyq69;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l73;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l73;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l73;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l73;  ++yyp;  if (yyp > yym) yym= yyp;  goto l68;
+  l73:;	  yyp= yyq69;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l74;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l74;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq75= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l75;  ++yyp;  if (yyp > yym) yym= yyp;  goto l76;
+  l75:;	  yyp= yyq75;
+  l76:;	  }  goto l68;
+  l74:;	  yyp= yyq69;
+  { int yyq77= yyp, yym77= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l77;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym77;  goto l66;
+  l77:;	  yyp= yyq77;  yym= yym77;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l66;  ++yyp;  if (yyp > yym) yym= yyp;
+  l68:;	  }  goto l65;
+  l66:;	  yyp= yyq66;  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l64;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l64;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l64;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l64:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan6(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l78;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l78;
+  { int yyq80;
+  l79:;	  yyPoll(yy);  yyq80= yyp;
+  { int yyq81= yyp, yym81= yym;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l81;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym81;  goto l80;
+  l81:;	  yyp= yyq81;  yym= yym81;  }
+  { int yyq83= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l84;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l84;  ++yyp;  if (yyp > yym) yym= yyp;  goto l82;
+  l84:;	  yyp= yyq83;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l85;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l85;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l85;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l85;  ++yyp;  if (yyp > yym) yym= yyp;  goto l82;
+  l85:;	  yyp= yyq83;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l86;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l86;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l86;  ++yyp;  if (yyp > yym) yym= yyp;  goto l82;
+  l86:;	  yyp= yyq83;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l87;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l87;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l87;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l87;  ++yyp;  if (yyp > yym) yym= yyp;  goto l82;
+  l87:;	  yyp= yyq83;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l88;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l88;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq89= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l89;  ++yyp;  if (yyp > yym) yym= yyp;  goto l90;
+  l89:;	  yyp= yyq89;
+  l90:;	  }  goto l82;
+  l88:;	  yyp= yyq83;
+  { int yyq91= yyp, yym91= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l91;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym91;  goto l80;
+  l91:;	  yyp= yyq91;  yym= yym91;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l80;  ++yyp;  if (yyp > yym) yym= yyp;
+  l82:;	  }  goto l79;
+  l80:;	  yyp= yyq80;  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l78;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l78;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l78:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan7(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l92;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l92;
+  { int yyq94;
+  l93:;	  yyPoll(yy);  yyq94= yyp;
+  { int yyq95= yyp, yym95= yym;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l95;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym95;  goto l94;
+  l95:;	  yyp= yyq95;  yym= yym95;  }
+  { int yyq97= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l98;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l98;  ++yyp;  if (yyp > yym) yym= yyp;  goto l96;
+  l98:;	  yyp= yyq97;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l99;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l99;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l99;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l99;  ++yyp;  if (yyp > yym) yym= yyp;  goto l96;
+  l99:;	  yyp= yyq97;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l100;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l100;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l100;  ++yyp;  if (yyp > yym) yym= yyp;  goto l96;
+  l100:;	  yyp= yyq97;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l101;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l101;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l101;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l101;  ++yyp;  if (yyp > yym) yym= yyp;  goto l96;
+  l101:;	  yyp= yyq97;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l102;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l102;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq103= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l103;  ++yyp;  if (yyp > yym) yym= yyp;  goto l104;
+  l103:;	  yyp= yyq103;
+  l104:;	  }  goto l96;
+  l102:;	  yyp= yyq97;
+  { int yyq105= yyp, yym105= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l105;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym105;  goto l94;
+  l105:;	  yyp= yyq105;  yym= yym105;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l94;  ++yyp;  if (yyp > yym) yym= yyp;
+  l96:;	  }  goto l93;
+  l94:;	  yyp= yyq94;  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l92;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l92;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l92:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
 }
-YY_RULE(int) yy_space(yycontext *yy)
+
+YY_LOCAL(int) yyscan8(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_END)) goto l106;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 125) goto l106;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l106:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan9(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 91) goto l107;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l107;
+  { int yyq109;
+  l108:;	  yyPoll(yy);  yyq109= yyp;
+  { int yyq110= yyp, yym110= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 93) goto l110;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym110;  goto l109;
+  l110:;	  yyp= yyq110;  yym= yym110;  }
+  { int yyq112= yyp;
+  { int yyq115= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l116;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l116;  ++yyp;  if (yyp > yym) yym= yyp;  goto l114;
+  l116:;	  yyp= yyq115;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l117;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l117;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l117;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l117;  ++yyp;  if (yyp > yym) yym= yyp;  goto l114;
+  l117:;	  yyp= yyq115;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l118;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l118;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l118;  ++yyp;  if (yyp > yym) yym= yyp;  goto l114;
+  l118:;	  yyp= yyq115;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l119;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l119;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l119;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l119;  ++yyp;  if (yyp > yym) yym= yyp;  goto l114;
+  l119:;	  yyp= yyq115;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l120;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l120;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq121= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l121;  ++yyp;  if (yyp > yym) yym= yyp;  goto l122;
+  l121:;	  yyp= yyq121;
+  l122:;	  }  goto l114;
+  l120:;	  yyp= yyq115;
+  { int yyq123= yyp, yym123= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l123;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym123;  goto l113;
+  l123:;	  yyp= yyq123;  yym= yym123;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l113;  ++yyp;  if (yyp > yym) yym= yyp;
+  l114:;	  }
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 45) goto l113;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq125= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l126;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l126;  ++yyp;  if (yyp > yym) yym= yyp;  goto l124;
+  l126:;	  yyp= yyq125;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l127;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l127;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l127;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l127;  ++yyp;  if (yyp > yym) yym= yyp;  goto l124;
+  l127:;	  yyp= yyq125;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l128;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l128;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l128;  ++yyp;  if (yyp > yym) yym= yyp;  goto l124;
+  l128:;	  yyp= yyq125;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l129;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l129;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l129;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l129;  ++yyp;  if (yyp > yym) yym= yyp;  goto l124;
+  l129:;	  yyp= yyq125;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l130;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l130;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq131= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l131;  ++yyp;  if (yyp > yym) yym= yyp;  goto l132;
+  l131:;	  yyp= yyq131;
+  l132:;	  }  goto l124;
+  l130:;	  yyp= yyq125;
+  { int yyq133= yyp, yym133= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l133;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym133;  goto l113;
+  l133:;	  yyp= yyq133;  yym= yym133;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l113;  ++yyp;  if (yyp > yym) yym= yyp;
+  l124:;	  }  goto l111;
+  l113:;	  yyp= yyq112;
+  { int yyq135= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l136;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l136;  ++yyp;  if (yyp > yym) yym= yyp;  goto l134;
+  l136:;	  yyp= yyq135;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l137;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l137;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l137;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l137;  ++yyp;  if (yyp > yym) yym= yyp;  goto l134;
+  l137:;	  yyp= yyq135;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l138;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 120) goto l138;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l138;  ++yyp;  if (yyp > yym) yym= yyp;  goto l134;
+  l138:;	  yyp= yyq135;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l139;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l139;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l139;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l139;  ++yyp;  if (yyp > yym) yym= yyp;  goto l134;
+  l139:;	  yyp= yyq135;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l140;  ++yyp;  if (yyp > yym) yym= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l140;  ++yyp;  if (yyp > yym) yym= yyp;
+  { int yyq141= yyp;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l141;  ++yyp;  if (yyp > yym) yym= yyp;  goto l142;
+  l141:;	  yyp= yyq141;
+  l142:;	  }  goto l134;
+  l140:;	  yyp= yyq135;
+  { int yyq143= yyp, yym143= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 92) goto l143;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym143;  goto l109;
+  l143:;	  yyp= yyq143;  yym= yym143;  }
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l109;  ++yyp;  if (yyp > yym) yym= yyp;
+  l134:;	  }
+  l111:;	  }  goto l108;
+  l109:;	  yyp= yyq109;  }
+  yy->_pos= yyp;  if (!(YY_END)) goto l107;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 93) goto l107;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l107:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan10(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l144;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) goto l144;  ++yyp;  if (yyp > yym) yym= yyp;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(yyInClass((const unsigned char *)"\000\000\000\000\000\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000", yyByte(yy, yyp)))) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_END)) goto l144;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l144:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan11(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 60) goto l145;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l145;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l145:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan12(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_END)) goto l146;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 62) goto l146;  ++yyp;  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l146:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan13(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq149= yyp;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l150;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l150;  ++yyp;  if (yyp > yym) yym= yyp;  goto l148;
+  l150:;	  yyp= yyq149;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 10) goto l151;  ++yyp;  if (yyp > yym) yym= yyp;  goto l148;
+  l151:;	  yyp= yyq149;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 13) goto l147;  ++yyp;  if (yyp > yym) yym= yyp;
+  l148:;	  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l147:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan14(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq153= yyp, yym153= yym;
+  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) goto l153;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym153;  goto l152;
+  l153:;	  yyp= yyq153;  yym= yym153;  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l152:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan15(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  yy->_pos= yyp;  if (!(YY_BEGIN)) goto l154;
+  for (;;) { yyPoll(yy);  yyStep(yy);  if (!yyAvail(yy, yyp) || !(1)) break;  ++yyp; }  if (yyp > yym) yym= yyp;
+  yy->_pos= yyp;  if (!(YY_END)) goto l154;
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l154:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_LOCAL(int) yyscan16(yycontext *yy)
+{
+  int yy0= yy->_pos, yyp= yy0, yym= yy->_maxpos;
+  { int yyq156= yyp, yym156= yym;
+  yyStep(yy);
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 37) goto l156;  ++yyp;
+  if (!yyAvail(yy, yyp) || yyByte(yy, yyp) != 125) goto l156;  ++yyp;  if (yyp > yym) yym= yyp;  yym= yym156;  goto l155;
+  l156:;	  yyp= yyq156;  yym= yym156;  }
+  yy->_pos= yyp;  yy->_maxpos= yym;  return 1;
+  l155:;	  yy->_pos= yy0;  yy->_maxpos= yym;  return 0;
+}
+
+YY_RULE(int) yyrcomment(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "comment"));  if (!yymatchChar(yy, '#')) goto l157;
+  l158:;	  yyPoll(yy);
+  {  int yypos159= yy->_pos, yythunkpos159= yy->_thunkpos;
+  {  int yypos160= yy->_pos, yythunkpos160= yy->_thunkpos;  int yymaxpos160= yy->_maxpos;  if (!yyrend_of_line(yy)) goto l160;  yy->_maxpos= yymaxpos160;  goto l159;
+  l160:;	  yy->_pos= yypos160; yy->_thunkpos= yythunkpos160;  yy->_maxpos= yymaxpos160;
+  }  if (!yymatchDot(yy)) goto l159;  goto l158;
+  l159:;	  yy->_pos= yypos159; yy->_thunkpos= yythunkpos159;
+  }  if (!yyrend_of_line(yy)) goto l157;
+  yyprintf((stderr, "  ok   %s @ %s\n", "comment", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l157:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "comment", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrspace(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "space"));
-  {  int yypos6= yy->_pos, yythunkpos6= yy->_thunkpos;  if (!yymatchChar(yy, ' ')) goto l7;  goto l6;
-  l7:;	  yy->_pos= yypos6; yy->_thunkpos= yythunkpos6;  if (!yymatchChar(yy, '\t')) goto l8;  goto l6;
-  l8:;	  yy->_pos= yypos6; yy->_thunkpos= yythunkpos6;  if (!yy_end_of_line(yy)) goto l5;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "space"));
+  {  int yypos162= yy->_pos, yythunkpos162= yy->_thunkpos;  if (!yymatchChar(yy, ' ')) goto l163;  goto l162;
+  l163:;	  yy->_pos= yypos162; yy->_thunkpos= yythunkpos162;  if (!yymatchChar(yy, '\t')) goto l164;  goto l162;
+  l164:;	  yy->_pos= yypos162; yy->_thunkpos= yythunkpos162;  if (!yyrend_of_line(yy)) goto l161;
   }
-  l6:;	
+  l162:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "space", yy->_buf+yy->_pos));
-  return 1;
-  l5:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l161:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "space", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_braces(yycontext *yy)
+YY_RULE(int) yyrbraces(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "braces"));
-  {  int yypos10= yy->_pos, yythunkpos10= yy->_thunkpos;  if (!yymatchChar(yy, '{')) goto l11;
-  l12:;	
-  {  int yypos13= yy->_pos, yythunkpos13= yy->_thunkpos;  if (!yy_braces(yy)) goto l13;  goto l12;
-  l13:;	  yy->_pos= yypos13; yy->_thunkpos= yythunkpos13;
-  }  if (!yymatchChar(yy, '}')) goto l11;  goto l10;
-  l11:;	  yy->_pos= yypos10; yy->_thunkpos= yythunkpos10;
-  {  int yypos14= yy->_pos, yythunkpos14= yy->_thunkpos;  int yymaxpos14= yy->_maxpos;  if (!yymatchChar(yy, '}')) goto l14;  yy->_maxpos= yymaxpos14;  goto l9;
-  l14:;	  yy->_pos= yypos14; yy->_thunkpos= yythunkpos14;  yy->_maxpos= yymaxpos14;
-  }
-  {  int yypos15= yy->_pos, yythunkpos15= yy->_thunkpos;  if (!yy_end_of_line(yy)) goto l16;  goto l15;
-  l16:;	  yy->_pos= yypos15; yy->_thunkpos= yythunkpos15;  if (!yymatchDot(yy)) goto l9;
-  }
-  l15:;	
-  }
-  l10:;	
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "braces"));
+  {  int yypos166= yy->_pos, yythunkpos166= yy->_thunkpos;  if (!yymatchChar(yy, '{')) goto l167;
+  l168:;	  yyPoll(yy);
+  {  int yypos169= yy->_pos, yythunkpos169= yy->_thunkpos;  if (!yyrbraces(yy)) goto l169;  goto l168;
+  l169:;	  yy->_pos= yypos169; yy->_thunkpos= yythunkpos169;
+  }  if (!yymatchChar(yy, '}')) goto l167;  goto l166;
+  l167:;	  yy->_pos= yypos166; yy->_thunkpos= yythunkpos166;  if (!yyscan0(yy)) goto l165;
+  {  int yypos170= yy->_pos, yythunkpos170= yy->_thunkpos;  if (!yyrend_of_line(yy)) goto l171;  goto l170;
+  l171:;	  yy->_pos= yypos170; yy->_thunkpos= yythunkpos170;  if (!yymatchDot(yy)) goto l165;
+  }
+  l170:;	
+  }
+  l166:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "braces", yy->_buf+yy->_pos));
-  return 1;
-  l9:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l165:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "braces", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_range(yycontext *yy)
+YY_RULE(int) yyrangles(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "range"));
-  {  int yypos18= yy->_pos, yythunkpos18= yy->_thunkpos;  if (!yy_char(yy)) goto l19;  if (!yymatchChar(yy, '-')) goto l19;  if (!yy_char(yy)) goto l19;  goto l18;
-  l19:;	  yy->_pos= yypos18; yy->_thunkpos= yythunkpos18;  if (!yy_char(yy)) goto l17;
-  }
-  l18:;	
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "angles"));
+  {  int yypos173= yy->_pos, yythunkpos173= yy->_thunkpos;  if (!yymatchChar(yy, '<')) goto l174;
+  l175:;	  yyPoll(yy);
+  {  int yypos176= yy->_pos, yythunkpos176= yy->_thunkpos;  if (!yyrangles(yy)) goto l176;  goto l175;
+  l176:;	  yy->_pos= yypos176; yy->_thunkpos= yythunkpos176;
+  }  if (!yymatchChar(yy, '>')) goto l174;  goto l173;
+  l174:;	  yy->_pos= yypos173; yy->_thunkpos= yythunkpos173;  if (!yyscan1(yy)) goto l172;
+  {  int yypos177= yy->_pos, yythunkpos177= yy->_thunkpos;  if (!yyrend_of_line(yy)) goto l178;  goto l177;
+  l178:;	  yy->_pos= yypos177; yy->_thunkpos= yythunkpos177;  if (!yymatchDot(yy)) goto l172;
+  }
+  l177:;	
+  }
+  l173:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "angles", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l172:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "angles", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) YY_UNUSED yyrrange(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "range"));  if (!yyscan2(yy)) goto l179;
   yyprintf((stderr, "  ok   %s @ %s\n", "range", yy->_buf+yy->_pos));
-  return 1;
-  l17:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l179:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "range", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_END(yycontext *yy)
+YY_RULE(int) yyrCUT(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "CUT"));  if (!yymatchChar(yy, '^')) goto l180;  if (!yyr_(yy)) goto l180;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CUT", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l180:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CUT", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrEND(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "END"));  if (!yymatchChar(yy, '>')) goto l20;  if (!yy_(yy)) goto l20;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "END"));  if (!yymatchChar(yy, '>')) goto l181;  if (!yyr_(yy)) goto l181;
   yyprintf((stderr, "  ok   %s @ %s\n", "END", yy->_buf+yy->_pos));
-  return 1;
-  l20:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l181:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "END", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_BEGIN(yycontext *yy)
+YY_RULE(int) yyrBEGIN(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "BEGIN"));  if (!yymatchChar(yy, '<')) goto l21;  if (!yy_(yy)) goto l21;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "BEGIN"));  if (!yymatchChar(yy, '<')) goto l182;  if (!yyr_(yy)) goto l182;
   yyprintf((stderr, "  ok   %s @ %s\n", "BEGIN", yy->_buf+yy->_pos));
-  return 1;
-  l21:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l182:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "BEGIN", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_DOT(yycontext *yy)
+YY_RULE(int) yyrDOT(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "DOT"));  if (!yymatchChar(yy, '.')) goto l22;  if (!yy_(yy)) goto l22;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "DOT"));  if (!yymatchChar(yy, '.')) goto l183;  if (!yyr_(yy)) goto l183;
   yyprintf((stderr, "  ok   %s @ %s\n", "DOT", yy->_buf+yy->_pos));
-  return 1;
-  l22:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l183:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "DOT", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_class(yycontext *yy)
+YY_RULE(int) YY_UNUSED yyrchar(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "class"));  if (!yymatchChar(yy, '[')) goto l23;  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l23;
-#undef yytext
-#undef yyleng
-  }
-  l24:;	
-  {  int yypos25= yy->_pos, yythunkpos25= yy->_thunkpos;
-  {  int yypos26= yy->_pos, yythunkpos26= yy->_thunkpos;  int yymaxpos26= yy->_maxpos;  if (!yymatchChar(yy, ']')) goto l26;  yy->_maxpos= yymaxpos26;  goto l25;
-  l26:;	  yy->_pos= yypos26; yy->_thunkpos= yythunkpos26;  yy->_maxpos= yymaxpos26;
-  }  if (!yy_range(yy)) goto l25;  goto l24;
-  l25:;	  yy->_pos= yypos25; yy->_thunkpos= yythunkpos25;
-  }  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_END)) goto l23;
-#undef yytext
-#undef yyleng
-  }  if (!yymatchChar(yy, ']')) goto l23;  if (!yy_(yy)) goto l23;
-  yyprintf((stderr, "  ok   %s @ %s\n", "class", yy->_buf+yy->_pos));
-  return 1;
-  l23:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "class", yy->_buf+yy->_pos));
-  return 0;
-}
-YY_RULE(int) yy_char(yycontext *yy)
-{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "char"));
-  {  int yypos28= yy->_pos, yythunkpos28= yy->_thunkpos;  if (!yymatchChar(yy, '\\')) goto l29;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\204\040\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l29;  goto l28;
-  l29:;	  yy->_pos= yypos28; yy->_thunkpos= yythunkpos28;  if (!yymatchChar(yy, '\\')) goto l30;  if (!yymatchChar(yy, 'x')) goto l30;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l30;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l30;  goto l28;
-  l30:;	  yy->_pos= yypos28; yy->_thunkpos= yythunkpos28;  if (!yymatchChar(yy, '\\')) goto l31;  if (!yymatchChar(yy, 'x')) goto l31;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l31;  goto l28;
-  l31:;	  yy->_pos= yypos28; yy->_thunkpos= yythunkpos28;  if (!yymatchChar(yy, '\\')) goto l32;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l32;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l32;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l32;  goto l28;
-  l32:;	  yy->_pos= yypos28; yy->_thunkpos= yythunkpos28;  if (!yymatchChar(yy, '\\')) goto l33;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l33;
-  {  int yypos34= yy->_pos, yythunkpos34= yy->_thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l34;  goto l35;
-  l34:;	  yy->_pos= yypos34; yy->_thunkpos= yythunkpos34;
-  }
-  l35:;	  goto l28;
-  l33:;	  yy->_pos= yypos28; yy->_thunkpos= yythunkpos28;
-  {  int yypos36= yy->_pos, yythunkpos36= yy->_thunkpos;  int yymaxpos36= yy->_maxpos;  if (!yymatchChar(yy, '\\')) goto l36;  yy->_maxpos= yymaxpos36;  goto l27;
-  l36:;	  yy->_pos= yypos36; yy->_thunkpos= yythunkpos36;  yy->_maxpos= yymaxpos36;
-  }  if (!yymatchDot(yy)) goto l27;
-  }
-  l28:;	
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "char"));  if (!yyscan3(yy)) goto l184;
   yyprintf((stderr, "  ok   %s @ %s\n", "char", yy->_buf+yy->_pos));
-  return 1;
-  l27:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l184:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "char", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_CLOSE(yycontext *yy)
+YY_RULE(int) yyrCLOSE(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(yy, ')')) goto l37;  if (!yy_(yy)) goto l37;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(yy, ')')) goto l185;  if (!yyr_(yy)) goto l185;
   yyprintf((stderr, "  ok   %s @ %s\n", "CLOSE", yy->_buf+yy->_pos));
-  return 1;
-  l37:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l185:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "CLOSE", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_OPEN(yycontext *yy)
+YY_RULE(int) yyrOPEN(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar(yy, '(')) goto l38;  if (!yy_(yy)) goto l38;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar(yy, '(')) goto l186;  if (!yyr_(yy)) goto l186;
   yyprintf((stderr, "  ok   %s @ %s\n", "OPEN", yy->_buf+yy->_pos));
-  return 1;
-  l38:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l186:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "OPEN", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_COLON(yycontext *yy)
+YY_RULE(int) yyrCOLON(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "COLON"));  if (!yymatchChar(yy, ':')) goto l39;  if (!yy_(yy)) goto l39;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "COLON"));  if (!yymatchChar(yy, ':')) goto l187;  if (!yyr_(yy)) goto l187;
   yyprintf((stderr, "  ok   %s @ %s\n", "COLON", yy->_buf+yy->_pos));
-  return 1;
-  l39:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l187:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "COLON", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_PLUS(yycontext *yy)
+YY_RULE(int) yyrPLUS(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar(yy, '+')) goto l40;  if (!yy_(yy)) goto l40;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar(yy, '+')) goto l188;  if (!yyr_(yy)) goto l188;
   yyprintf((stderr, "  ok   %s @ %s\n", "PLUS", yy->_buf+yy->_pos));
-  return 1;
-  l40:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l188:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "PLUS", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_STAR(yycontext *yy)
+YY_RULE(int) yyrSTAR(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "STAR"));  if (!yymatchChar(yy, '*')) goto l41;  if (!yy_(yy)) goto l41;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "STAR"));  if (!yymatchChar(yy, '*')) goto l189;  if (!yyr_(yy)) goto l189;
   yyprintf((stderr, "  ok   %s @ %s\n", "STAR", yy->_buf+yy->_pos));
-  return 1;
-  l41:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l189:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "STAR", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_QUESTION(yycontext *yy)
+YY_RULE(int) yyrQUESTION(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "QUESTION"));  if (!yymatchChar(yy, '?')) goto l42;  if (!yy_(yy)) goto l42;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "QUESTION"));  if (!yymatchChar(yy, '?')) goto l190;  if (!yyr_(yy)) goto l190;
   yyprintf((stderr, "  ok   %s @ %s\n", "QUESTION", yy->_buf+yy->_pos));
-  return 1;
-  l42:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l190:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "QUESTION", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_primary(yycontext *yy)
+YY_RULE(int) yyrprimary(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "primary"));
-  {  int yypos44= yy->_pos, yythunkpos44= yy->_thunkpos;  if (!yy_identifier(yy)) goto l45;  yyDo(yy, yy_1_primary, yy->_begin, yy->_end);  if (!yy_COLON(yy)) goto l45;  if (!yy_identifier(yy)) goto l45;
-  {  int yypos46= yy->_pos, yythunkpos46= yy->_thunkpos;  int yymaxpos46= yy->_maxpos;  if (!yy_EQUAL(yy)) goto l46;  yy->_maxpos= yymaxpos46;  goto l45;
-  l46:;	  yy->_pos= yypos46; yy->_thunkpos= yythunkpos46;  yy->_maxpos= yymaxpos46;
-  }  yyDo(yy, yy_2_primary, yy->_begin, yy->_end);  goto l44;
-  l45:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yy_identifier(yy)) goto l47;
-  {  int yypos48= yy->_pos, yythunkpos48= yy->_thunkpos;  int yymaxpos48= yy->_maxpos;  if (!yy_EQUAL(yy)) goto l48;  yy->_maxpos= yymaxpos48;  goto l47;
-  l48:;	  yy->_pos= yypos48; yy->_thunkpos= yythunkpos48;  yy->_maxpos= yymaxpos48;
-  }  yyDo(yy, yy_3_primary, yy->_begin, yy->_end);  goto l44;
-  l47:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yy_OPEN(yy)) goto l49;  if (!yy_expression(yy)) goto l49;  if (!yy_CLOSE(yy)) goto l49;  goto l44;
-  l49:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l50;  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l50;
-#undef yytext
-#undef yyleng
-  }
-  l51:;	
-  {  int yypos52= yy->_pos, yythunkpos52= yy->_thunkpos;
-  {  int yypos53= yy->_pos, yythunkpos53= yy->_thunkpos;  int yymaxpos53= yy->_maxpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l53;  yy->_maxpos= yymaxpos53;  goto l52;
-  l53:;	  yy->_pos= yypos53; yy->_thunkpos= yythunkpos53;  yy->_maxpos= yymaxpos53;
-  }  if (!yy_char(yy)) goto l52;  goto l51;
-  l52:;	  yy->_pos= yypos52; yy->_thunkpos= yythunkpos52;
-  }  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_END)) goto l50;
-#undef yytext
-#undef yyleng
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l50;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l50;  if (!yy_(yy)) goto l50;  yyDo(yy, yy_4_primary, yy->_begin, yy->_end);  goto l44;
-  l50:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l54;  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l54;
-#undef yytext
-#undef yyleng
-  }
-  l55:;	
-  {  int yypos56= yy->_pos, yythunkpos56= yy->_thunkpos;
-  {  int yypos57= yy->_pos, yythunkpos57= yy->_thunkpos;  int yymaxpos57= yy->_maxpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l57;  yy->_maxpos= yymaxpos57;  goto l56;
-  l57:;	  yy->_pos= yypos57; yy->_thunkpos= yythunkpos57;  yy->_maxpos= yymaxpos57;
-  }  if (!yy_char(yy)) goto l56;  goto l55;
-  l56:;	  yy->_pos= yypos56; yy->_thunkpos= yythunkpos56;
-  }  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_END)) goto l54;
-#undef yytext
-#undef yyleng
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l54;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l54;  if (!yy_(yy)) goto l54;  yyDo(yy, yy_5_primary, yy->_begin, yy->_end);  goto l44;
-  l54:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l58;  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l58;
-#undef yytext
-#undef yyleng
-  }
-  l59:;	
-  {  int yypos60= yy->_pos, yythunkpos60= yy->_thunkpos;
-  {  int yypos61= yy->_pos, yythunkpos61= yy->_thunkpos;  int yymaxpos61= yy->_maxpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l61;  yy->_maxpos= yymaxpos61;  goto l60;
-  l61:;	  yy->_pos= yypos61; yy->_thunkpos= yythunkpos61;  yy->_maxpos= yymaxpos61;
-  }  if (!yy_char(yy)) goto l60;  goto l59;
-  l60:;	  yy->_pos= yypos60; yy->_thunkpos= yythunkpos60;
-  }  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_END)) goto l58;
-#undef yytext
-#undef yyleng
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l58;  if (!yy_(yy)) goto l58;  yyDo(yy, yy_6_primary, yy->_begin, yy->_end);  goto l44;
-  l58:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l62;  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l62;
-#undef yytext
-#undef yyleng
-  }
-  l63:;	
-  {  int yypos64= yy->_pos, yythunkpos64= yy->_thunkpos;
-  {  int yypos65= yy->_pos, yythunkpos65= yy->_thunkpos;  int yymaxpos65= yy->_maxpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l65;  yy->_maxpos= yymaxpos65;  goto l64;
-  l65:;	  yy->_pos= yypos65; yy->_thunkpos= yythunkpos65;  yy->_maxpos= yymaxpos65;
-  }  if (!yy_char(yy)) goto l64;  goto l63;
-  l64:;	  yy->_pos= yypos64; yy->_thunkpos= yythunkpos64;
-  }  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_END)) goto l62;
-#undef yytext
-#undef yyleng
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l62;  if (!yy_(yy)) goto l62;  yyDo(yy, yy_7_primary, yy->_begin, yy->_end);  goto l44;
-  l62:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yy_class(yy)) goto l66;  yyDo(yy, yy_8_primary, yy->_begin, yy->_end);  goto l44;
-  l66:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yy_DOT(yy)) goto l67;  yyDo(yy, yy_9_primary, yy->_begin, yy->_end);  goto l44;
-  l67:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yy_action(yy)) goto l68;  yyDo(yy, yy_10_primary, yy->_begin, yy->_end);  goto l44;
-  l68:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yy_BEGIN(yy)) goto l69;  yyDo(yy, yy_11_primary, yy->_begin, yy->_end);  goto l44;
-  l69:;	  yy->_pos= yypos44; yy->_thunkpos= yythunkpos44;  if (!yy_END(yy)) goto l43;  yyDo(yy, yy_12_primary, yy->_begin, yy->_end);
-  }
-  l44:;	
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "primary"));
+  {  int yypos192= yy->_pos, yythunkpos192= yy->_thunkpos;  if (!yyridentifier(yy)) goto l193;  yyDo(yy, yy_1_primary, yy->_begin, yy->_end);  if (!yyrCOLON(yy)) goto l193;  if (!yyridentifier(yy)) goto l193;
+  {  int yypos194= yy->_pos, yythunkpos194= yy->_thunkpos;  int yymaxpos194= yy->_maxpos;  if (!yyrEQUAL(yy)) goto l194;  yy->_maxpos= yymaxpos194;  goto l193;
+  l194:;	  yy->_pos= yypos194; yy->_thunkpos= yythunkpos194;  yy->_maxpos= yymaxpos194;
+  }  yyDo(yy, yy_2_primary, yy->_begin, yy->_end);  goto l192;
+  l193:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyridentifier(yy)) goto l195;
+  {  int yypos196= yy->_pos, yythunkpos196= yy->_thunkpos;  int yymaxpos196= yy->_maxpos;  if (!yyrEQUAL(yy)) goto l196;  yy->_maxpos= yymaxpos196;  goto l195;
+  l196:;	  yy->_pos= yypos196; yy->_thunkpos= yythunkpos196;  yy->_maxpos= yymaxpos196;
+  }  yyDo(yy, yy_3_primary, yy->_begin, yy->_end);  goto l192;
+  l195:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyrOPEN(yy)) goto l197;  if (!yyrexpression(yy)) goto l197;  if (!yyrCLOSE(yy)) goto l197;  goto l192;
+  l197:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyscan4(yy)) goto l198;  if (!yyr_(yy)) goto l198;  yyDo(yy, yy_4_primary, yy->_begin, yy->_end);  goto l192;
+  l198:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyscan5(yy)) goto l199;  if (!yyr_(yy)) goto l199;  yyDo(yy, yy_5_primary, yy->_begin, yy->_end);  goto l192;
+  l199:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyscan6(yy)) goto l200;  if (!yyr_(yy)) goto l200;  yyDo(yy, yy_6_primary, yy->_begin, yy->_end);  goto l192;
+  l200:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyscan7(yy)) goto l201;  if (!yyr_(yy)) goto l201;  yyDo(yy, yy_7_primary, yy->_begin, yy->_end);  goto l192;
+  l201:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyrclass(yy)) goto l202;  yyDo(yy, yy_8_primary, yy->_begin, yy->_end);  goto l192;
+  l202:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyrDOT(yy)) goto l203;  yyDo(yy, yy_9_primary, yy->_begin, yy->_end);  goto l192;
+  l203:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyraction(yy)) goto l204;  yyDo(yy, yy_10_primary, yy->_begin, yy->_end);  goto l192;
+  l204:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyrBEGIN(yy)) goto l205;  yyDo(yy, yy_11_primary, yy->_begin, yy->_end);  goto l192;
+  l205:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyrEND(yy)) goto l206;  yyDo(yy, yy_12_primary, yy->_begin, yy->_end);  goto l192;
+  l206:;	  yy->_pos= yypos192; yy->_thunkpos= yythunkpos192;  if (!yyrCUT(yy)) goto l191;  yyDo(yy, yy_13_primary, yy->_begin, yy->_end);
+  }
+  l192:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "primary", yy->_buf+yy->_pos));
-  return 1;
-  l43:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l191:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "primary", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_NOT(yycontext *yy)
+YY_RULE(int) yyrNOT(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "NOT"));  if (!yymatchChar(yy, '!')) goto l70;  if (!yy_(yy)) goto l70;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "NOT"));  if (!yymatchChar(yy, '!')) goto l207;  if (!yyr_(yy)) goto l207;
   yyprintf((stderr, "  ok   %s @ %s\n", "NOT", yy->_buf+yy->_pos));
-  return 1;
-  l70:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l207:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "NOT", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_suffix(yycontext *yy)
+YY_RULE(int) yyrsuffix(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "suffix"));  if (!yy_primary(yy)) goto l71;
-  {  int yypos72= yy->_pos, yythunkpos72= yy->_thunkpos;
-  {  int yypos74= yy->_pos, yythunkpos74= yy->_thunkpos;  if (!yy_QUESTION(yy)) goto l75;  yyDo(yy, yy_1_suffix, yy->_begin, yy->_end);  goto l74;
-  l75:;	  yy->_pos= yypos74; yy->_thunkpos= yythunkpos74;  if (!yy_STAR(yy)) goto l76;  yyDo(yy, yy_2_suffix, yy->_begin, yy->_end);  goto l74;
-  l76:;	  yy->_pos= yypos74; yy->_thunkpos= yythunkpos74;  if (!yy_PLUS(yy)) goto l72;  yyDo(yy, yy_3_suffix, yy->_begin, yy->_end);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "suffix"));  if (!yyrprimary(yy)) goto l208;
+  {  int yypos209= yy->_pos, yythunkpos209= yy->_thunkpos;
+  {  int yypos211= yy->_pos, yythunkpos211= yy->_thunkpos;  if (!yyrQUESTION(yy)) goto l212;  yyDo(yy, yy_1_suffix, yy->_begin, yy->_end);  goto l211;
+  l212:;	  yy->_pos= yypos211; yy->_thunkpos= yythunkpos211;  if (!yyrSTAR(yy)) goto l213;  yyDo(yy, yy_2_suffix, yy->_begin, yy->_end);  goto l211;
+  l213:;	  yy->_pos= yypos211; yy->_thunkpos= yythunkpos211;  if (!yyrPLUS(yy)) goto l209;  yyDo(yy, yy_3_suffix, yy->_begin, yy->_end);
   }
-  l74:;	  goto l73;
-  l72:;	  yy->_pos= yypos72; yy->_thunkpos= yythunkpos72;
+  l211:;	  goto l210;
+  l209:;	  yy->_pos= yypos209; yy->_thunkpos= yythunkpos209;
   }
-  l73:;	
+  l210:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "suffix", yy->_buf+yy->_pos));
-  return 1;
-  l71:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l208:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "suffix", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_AND(yycontext *yy)
+YY_RULE(int) yyrAND(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "AND"));  if (!yymatchChar(yy, '&')) goto l77;  if (!yy_(yy)) goto l77;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "AND"));  if (!yymatchChar(yy, '&')) goto l214;  if (!yyr_(yy)) goto l214;
   yyprintf((stderr, "  ok   %s @ %s\n", "AND", yy->_buf+yy->_pos));
-  return 1;
-  l77:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l214:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "AND", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_AT(yycontext *yy)
+YY_RULE(int) yyrAT(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "AT"));  if (!yymatchChar(yy, '@')) goto l78;  if (!yy_(yy)) goto l78;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "AT"));  if (!yymatchChar(yy, '@')) goto l215;  if (!yyr_(yy)) goto l215;
   yyprintf((stderr, "  ok   %s @ %s\n", "AT", yy->_buf+yy->_pos));
-  return 1;
-  l78:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l215:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "AT", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_action(yycontext *yy)
+YY_RULE(int) yyraction(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "action"));  if (!yymatchChar(yy, '{')) goto l79;  yyDo(yy, yy_1_action, yy->_begin, yy->_end);  yyText(yy, yy->_begin, yy->_end);  {
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "action"));  if (!yymatchChar(yy, '{')) goto l216;  yyDo(yy, yy_1_action, yy->_begin, yy->_end);  yyText(yy, yy->_begin, yy->_end);  {
 #define yytext yy->_text
 #define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l79;
+if (!(YY_BEGIN)) goto l216;
 #undef yytext
 #undef yyleng
   }
-  l80:;	
-  {  int yypos81= yy->_pos, yythunkpos81= yy->_thunkpos;  if (!yy_braces(yy)) goto l81;  goto l80;
-  l81:;	  yy->_pos= yypos81; yy->_thunkpos= yythunkpos81;
-  }  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_END)) goto l79;
-#undef yytext
-#undef yyleng
-  }  if (!yymatchChar(yy, '}')) goto l79;  if (!yy_(yy)) goto l79;
+  l217:;	  yyPoll(yy);
+  {  int yypos218= yy->_pos, yythunkpos218= yy->_thunkpos;  if (!yyrbraces(yy)) goto l218;  goto l217;
+  l218:;	  yy->_pos= yypos218; yy->_thunkpos= yythunkpos218;
+  }  if (!yyscan8(yy)) goto l216;  if (!yyr_(yy)) goto l216;
   yyprintf((stderr, "  ok   %s @ %s\n", "action", yy->_buf+yy->_pos));
-  return 1;
-  l79:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l216:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "action", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_TILDE(yycontext *yy)
+YY_RULE(int) yyrTILDE(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "TILDE"));  if (!yymatchChar(yy, '~')) goto l82;  if (!yy_(yy)) goto l82;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "TILDE"));  if (!yymatchChar(yy, '~')) goto l219;  if (!yyr_(yy)) goto l219;
   yyprintf((stderr, "  ok   %s @ %s\n", "TILDE", yy->_buf+yy->_pos));
-  return 1;
-  l82:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l219:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "TILDE", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_prefix(yycontext *yy)
+YY_RULE(int) yyrprefix(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "prefix"));
-  {  int yypos84= yy->_pos, yythunkpos84= yy->_thunkpos;  if (!yy_AT(yy)) goto l85;  if (!yy_action(yy)) goto l85;  yyDo(yy, yy_1_prefix, yy->_begin, yy->_end);  goto l84;
-  l85:;	  yy->_pos= yypos84; yy->_thunkpos= yythunkpos84;  if (!yy_AND(yy)) goto l86;  if (!yy_action(yy)) goto l86;  yyDo(yy, yy_2_prefix, yy->_begin, yy->_end);  goto l84;
-  l86:;	  yy->_pos= yypos84; yy->_thunkpos= yythunkpos84;  if (!yy_AND(yy)) goto l87;  if (!yy_suffix(yy)) goto l87;  yyDo(yy, yy_3_prefix, yy->_begin, yy->_end);  goto l84;
-  l87:;	  yy->_pos= yypos84; yy->_thunkpos= yythunkpos84;  if (!yy_NOT(yy)) goto l88;  if (!yy_suffix(yy)) goto l88;  yyDo(yy, yy_4_prefix, yy->_begin, yy->_end);  goto l84;
-  l88:;	  yy->_pos= yypos84; yy->_thunkpos= yythunkpos84;  if (!yy_suffix(yy)) goto l83;
-  }
-  l84:;	
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "prefix"));
+  {  int yypos221= yy->_pos, yythunkpos221= yy->_thunkpos;  if (!yyrAT(yy)) goto l222;  if (!yyraction(yy)) goto l222;  yyDo(yy, yy_1_prefix, yy->_begin, yy->_end);  goto l221;
+  l222:;	  yy->_pos= yypos221; yy->_thunkpos= yythunkpos221;  if (!yyrAND(yy)) goto l223;  if (!yyraction(yy)) goto l223;  yyDo(yy, yy_2_prefix, yy->_begin, yy->_end);  goto l221;
+  l223:;	  yy->_pos= yypos221; yy->_thunkpos= yythunkpos221;  if (!yyrAND(yy)) goto l224;  if (!yyrsuffix(yy)) goto l224;  yyDo(yy, yy_3_prefix, yy->_begin, yy->_end);  goto l221;
+  l224:;	  yy->_pos= yypos221; yy->_thunkpos= yythunkpos221;  if (!yyrNOT(yy)) goto l225;  if (!yyrsuffix(yy)) goto l225;  yyDo(yy, yy_4_prefix, yy->_begin, yy->_end);  goto l221;
+  l225:;	  yy->_pos= yypos221; yy->_thunkpos= yythunkpos221;  if (!yyrsuffix(yy)) goto l220;
+  }
+  l221:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "prefix", yy->_buf+yy->_pos));
-  return 1;
-  l83:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l220:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "prefix", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_error(yycontext *yy)
+YY_RULE(int) yyrerror(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "error"));  if (!yy_prefix(yy)) goto l89;
-  {  int yypos90= yy->_pos, yythunkpos90= yy->_thunkpos;  if (!yy_TILDE(yy)) goto l90;  if (!yy_action(yy)) goto l90;  yyDo(yy, yy_1_error, yy->_begin, yy->_end);  goto l91;
-  l90:;	  yy->_pos= yypos90; yy->_thunkpos= yythunkpos90;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "error"));  if (!yyrprefix(yy)) goto l226;
+  {  int yypos227= yy->_pos, yythunkpos227= yy->_thunkpos;  if (!yyrTILDE(yy)) goto l227;  if (!yyraction(yy)) goto l227;  yyDo(yy, yy_1_error, yy->_begin, yy->_end);  goto l228;
+  l227:;	  yy->_pos= yypos227; yy->_thunkpos= yythunkpos227;
   }
-  l91:;	
+  l228:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "error", yy->_buf+yy->_pos));
-  return 1;
-  l89:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l226:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "error", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_BAR(yycontext *yy)
+YY_RULE(int) yyrBAR(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "BAR"));  if (!yymatchChar(yy, '|')) goto l92;  if (!yy_(yy)) goto l92;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "BAR"));  if (!yymatchChar(yy, '|')) goto l229;  if (!yyr_(yy)) goto l229;
   yyprintf((stderr, "  ok   %s @ %s\n", "BAR", yy->_buf+yy->_pos));
-  return 1;
-  l92:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l229:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "BAR", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_sequence(yycontext *yy)
+YY_RULE(int) yyrsequence(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "sequence"));  if (!yy_error(yy)) goto l93;
-  l94:;	
-  {  int yypos95= yy->_pos, yythunkpos95= yy->_thunkpos;  if (!yy_error(yy)) goto l95;  yyDo(yy, yy_1_sequence, yy->_begin, yy->_end);  goto l94;
-  l95:;	  yy->_pos= yypos95; yy->_thunkpos= yythunkpos95;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "sequence"));  if (!yyrerror(yy)) goto l230;
+  l231:;	  yyPoll(yy);
+  {  int yypos232= yy->_pos, yythunkpos232= yy->_thunkpos;  if (!yyrerror(yy)) goto l232;  yyDo(yy, yy_1_sequence, yy->_begin, yy->_end);  goto l231;
+  l232:;	  yy->_pos= yypos232; yy->_thunkpos= yythunkpos232;
   }
   yyprintf((stderr, "  ok   %s @ %s\n", "sequence", yy->_buf+yy->_pos));
-  return 1;
-  l93:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l230:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "sequence", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_SEMICOLON(yycontext *yy)
+YY_RULE(int) yyrSEMICOLON(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "SEMICOLON"));  if (!yymatchChar(yy, ';')) goto l96;  if (!yy_(yy)) goto l96;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "SEMICOLON"));  if (!yymatchChar(yy, ';')) goto l233;  if (!yyr_(yy)) goto l233;
   yyprintf((stderr, "  ok   %s @ %s\n", "SEMICOLON", yy->_buf+yy->_pos));
-  return 1;
-  l96:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l233:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "SEMICOLON", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_expression(yycontext *yy)
+YY_RULE(int) yyrexpression(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "expression"));  if (!yy_sequence(yy)) goto l97;
-  l98:;	
-  {  int yypos99= yy->_pos, yythunkpos99= yy->_thunkpos;  if (!yy_BAR(yy)) goto l99;  if (!yy_sequence(yy)) goto l99;  yyDo(yy, yy_1_expression, yy->_begin, yy->_end);  goto l98;
-  l99:;	  yy->_pos= yypos99; yy->_thunkpos= yythunkpos99;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "expression"));  if (!yyrsequence(yy)) goto l234;
+  l235:;	  yyPoll(yy);
+  {  int yypos236= yy->_pos, yythunkpos236= yy->_thunkpos;  if (!yyrBAR(yy)) goto l236;  if (!yyrsequence(yy)) goto l236;  yyDo(yy, yy_1_expression, yy->_begin, yy->_end);  goto l235;
+  l236:;	  yy->_pos= yypos236; yy->_thunkpos= yythunkpos236;
   }
   yyprintf((stderr, "  ok   %s @ %s\n", "expression", yy->_buf+yy->_pos));
-  return 1;
-  l97:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l234:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "expression", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_EQUAL(yycontext *yy)
+YY_RULE(int) yyrclass(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yymatchChar(yy, '=')) goto l100;  if (!yy_(yy)) goto l100;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "class"));  if (!yyscan9(yy)) goto l237;  if (!yyr_(yy)) goto l237;
+  yyprintf((stderr, "  ok   %s @ %s\n", "class", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l237:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "class", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrSTRUCTURAL(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "STRUCTURAL"));  if (!yymatchString(yy, "%structural")) goto l238;  if (!yyr_(yy)) goto l238;
+  yyprintf((stderr, "  ok   %s @ %s\n", "STRUCTURAL", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l238:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "STRUCTURAL", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrLAZY(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "LAZY"));  if (!yymatchString(yy, "%lazy")) goto l239;  if (!yyr_(yy)) goto l239;
+  yyprintf((stderr, "  ok   %s @ %s\n", "LAZY", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l239:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LAZY", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrTOKEN(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "TOKEN"));  if (!yymatchString(yy, "%token")) goto l240;  if (!yyr_(yy)) goto l240;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TOKEN", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l240:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TOKEN", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrEQUAL(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yymatchChar(yy, '=')) goto l241;  if (!yyr_(yy)) goto l241;
   yyprintf((stderr, "  ok   %s @ %s\n", "EQUAL", yy->_buf+yy->_pos));
-  return 1;
-  l100:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l241:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "EQUAL", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_identifier(yycontext *yy)
+YY_RULE(int) yyridentifier(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "identifier"));  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l101;
-#undef yytext
-#undef yyleng
-  }  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l101;
-  l102:;	
-  {  int yypos103= yy->_pos, yythunkpos103= yy->_thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l103;  goto l102;
-  l103:;	  yy->_pos= yypos103; yy->_thunkpos= yythunkpos103;
-  }  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_END)) goto l101;
-#undef yytext
-#undef yyleng
-  }  if (!yy_(yy)) goto l101;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "identifier"));  if (!yyscan10(yy)) goto l242;  if (!yyr_(yy)) goto l242;
   yyprintf((stderr, "  ok   %s @ %s\n", "identifier", yy->_buf+yy->_pos));
-  return 1;
-  l101:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l242:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "identifier", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_RPERCENT(yycontext *yy)
+YY_RULE(int) yyrtype(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "RPERCENT"));  if (!yymatchString(yy, "%}")) goto l104;  if (!yy_(yy)) goto l104;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "type"));  if (!yyscan11(yy)) goto l243;
+  l244:;	  yyPoll(yy);
+  {  int yypos245= yy->_pos, yythunkpos245= yy->_thunkpos;  if (!yyrangles(yy)) goto l245;  goto l244;
+  l245:;	  yy->_pos= yypos245; yy->_thunkpos= yythunkpos245;
+  }  if (!yyscan12(yy)) goto l243;  if (!yyr_(yy)) goto l243;
+  yyprintf((stderr, "  ok   %s @ %s\n", "type", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l243:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "type", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrTYPE(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "TYPE"));  if (!yymatchString(yy, "%type")) goto l246;  if (!yyr_(yy)) goto l246;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TYPE", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 1;
+  l246:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TYPE", yy->_buf+yy->_pos));
+  yyLeave(yy);  return 0;
+}
+YY_RULE(int) yyrRPERCENT(yycontext *yy)
+{  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "RPERCENT"));  if (!yymatchString(yy, "%}")) goto l247;  if (!yyr_(yy)) goto l247;
   yyprintf((stderr, "  ok   %s @ %s\n", "RPERCENT", yy->_buf+yy->_pos));
-  return 1;
-  l104:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l247:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "RPERCENT", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_end_of_line(yycontext *yy)
+YY_RULE(int) yyrend_of_line(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "end_of_line"));
-  {  int yypos106= yy->_pos, yythunkpos106= yy->_thunkpos;  if (!yymatchString(yy, "\r\n")) goto l107;  goto l106;
-  l107:;	  yy->_pos= yypos106; yy->_thunkpos= yythunkpos106;  if (!yymatchChar(yy, '\n')) goto l108;  goto l106;
-  l108:;	  yy->_pos= yypos106; yy->_thunkpos= yythunkpos106;  if (!yymatchChar(yy, '\r')) goto l105;
-  }
-  l106:;	  yyDo(yy, yy_1_end_of_line, yy->_begin, yy->_end);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "end_of_line"));  if (!yyscan13(yy)) goto l248;  yyDo(yy, yy_1_end_of_line, yy->_begin, yy->_end);
   yyprintf((stderr, "  ok   %s @ %s\n", "end_of_line", yy->_buf+yy->_pos));
-  return 1;
-  l105:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l248:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "end_of_line", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_end_of_file(yycontext *yy)
+YY_RULE(int) YY_UNUSED yyrend_of_file(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "end_of_file"));
-  {  int yypos110= yy->_pos, yythunkpos110= yy->_thunkpos;  int yymaxpos110= yy->_maxpos;  if (!yymatchDot(yy)) goto l110;  yy->_maxpos= yymaxpos110;  goto l109;
-  l110:;	  yy->_pos= yypos110; yy->_thunkpos= yythunkpos110;  yy->_maxpos= yymaxpos110;
-  }
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "end_of_file"));  if (!yyscan14(yy)) goto l249;
   yyprintf((stderr, "  ok   %s @ %s\n", "end_of_file", yy->_buf+yy->_pos));
-  return 1;
-  l109:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l249:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "end_of_file", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_trailer(yycontext *yy)
+YY_RULE(int) yyrtrailer(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "trailer"));  if (!yymatchString(yy, "%%")) goto l111;  yyDo(yy, yy_1_trailer, yy->_begin, yy->_end);  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l111;
-#undef yytext
-#undef yyleng
-  }
-  l112:;	
-  {  int yypos113= yy->_pos, yythunkpos113= yy->_thunkpos;  if (!yymatchDot(yy)) goto l113;  goto l112;
-  l113:;	  yy->_pos= yypos113; yy->_thunkpos= yythunkpos113;
-  }  yyText(yy, yy->_begin, yy->_end);  {
-#define yytext yy->_text
-#define yyleng yy->_textlen
-if (!(YY_END)) goto l111;
-#undef yytext
-#undef yyleng
-  }  yyDo(yy, yy_2_trailer, yy->_begin, yy->_end);
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "trailer"));  if (!yymatchString(yy, "%%")) goto l250;  yyDo(yy, yy_1_trailer, yy->_begin, yy->_end);  if (!yyscan15(yy)) goto l250;  yyDo(yy, yy_2_trailer, yy->_begin, yy->_end);
   yyprintf((stderr, "  ok   %s @ %s\n", "trailer", yy->_buf+yy->_pos));
-  return 1;
-  l111:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l250:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "trailer", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_definition(yycontext *yy)
+YY_RULE(int) yyrdefinition(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "definition"));  if (!yy_identifier(yy)) goto l114;  yyDo(yy, yy_1_definition, yy->_begin, yy->_end);  if (!yy_EQUAL(yy)) goto l114;  if (!yy_expression(yy)) goto l114;  yyDo(yy, yy_2_definition, yy->_begin, yy->_end);
-  {  int yypos115= yy->_pos, yythunkpos115= yy->_thunkpos;  if (!yy_SEMICOLON(yy)) goto l115;  goto l116;
-  l115:;	  yy->_pos= yypos115; yy->_thunkpos= yythunkpos115;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "definition"));  if (!yyridentifier(yy)) goto l251;  yyDo(yy, yy_1_definition, yy->_begin, yy->_end);  if (!yyrEQUAL(yy)) goto l251;  if (!yyrexpression(yy)) goto l251;  yyDo(yy, yy_2_definition, yy->_begin, yy->_end);
+  {  int yypos252= yy->_pos, yythunkpos252= yy->_thunkpos;  if (!yyrSEMICOLON(yy)) goto l252;  goto l253;
+  l252:;	  yy->_pos= yypos252; yy->_thunkpos= yythunkpos252;
   }
-  l116:;	
+  l253:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "definition", yy->_buf+yy->_pos));
-  return 1;
-  l114:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l251:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "definition", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_declaration(yycontext *yy)
+YY_RULE(int) yyrdeclaration(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "declaration"));  if (!yymatchString(yy, "%{")) goto l117;  yyDo(yy, yy_1_declaration, yy->_begin, yy->_end);  yyText(yy, yy->_begin, yy->_end);  {
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "declaration"));
+  {  int yypos255= yy->_pos, yythunkpos255= yy->_thunkpos;  if (!yymatchString(yy, "%{")) goto l256;  yyDo(yy, yy_1_declaration, yy->_begin, yy->_end);  yyText(yy, yy->_begin, yy->_end);  {
 #define yytext yy->_text
 #define yyleng yy->_textlen
-if (!(YY_BEGIN)) goto l117;
+if (!(YY_BEGIN)) goto l256;
 #undef yytext
 #undef yyleng
   }
-  l118:;	
-  {  int yypos119= yy->_pos, yythunkpos119= yy->_thunkpos;
-  {  int yypos120= yy->_pos, yythunkpos120= yy->_thunkpos;  int yymaxpos120= yy->_maxpos;  if (!yymatchString(yy, "%}")) goto l120;  yy->_maxpos= yymaxpos120;  goto l119;
-  l120:;	  yy->_pos= yypos120; yy->_thunkpos= yythunkpos120;  yy->_maxpos= yymaxpos120;
+  l257:;	  yyPoll(yy);
+  {  int yypos258= yy->_pos, yythunkpos258= yy->_thunkpos;  if (!yyscan16(yy)) goto l258;
+  {  int yypos259= yy->_pos, yythunkpos259= yy->_thunkpos;  if (!yyrend_of_line(yy)) goto l260;  goto l259;
+  l260:;	  yy->_pos= yypos259; yy->_thunkpos= yythunkpos259;  if (!yymatchDot(yy)) goto l258;
   }
-  {  int yypos121= yy->_pos, yythunkpos121= yy->_thunkpos;  if (!yy_end_of_line(yy)) goto l122;  goto l121;
-  l122:;	  yy->_pos= yypos121; yy->_thunkpos= yythunkpos121;  if (!yymatchDot(yy)) goto l119;
-  }
-  l121:;	  goto l118;
-  l119:;	  yy->_pos= yypos119; yy->_thunkpos= yythunkpos119;
+  l259:;	  goto l257;
+  l258:;	  yy->_pos= yypos258; yy->_thunkpos= yythunkpos258;
   }  yyText(yy, yy->_begin, yy->_end);  {
 #define yytext yy->_text
 #define yyleng yy->_textlen
-if (!(YY_END)) goto l117;
+if (!(YY_END)) goto l256;
 #undef yytext
 #undef yyleng
-  }  if (!yy_RPERCENT(yy)) goto l117;  yyDo(yy, yy_2_declaration, yy->_begin, yy->_end);
+  }  if (!yyrRPERCENT(yy)) goto l256;  yyDo(yy, yy_2_declaration, yy->_begin, yy->_end);  goto l255;
+  l256:;	  yy->_pos= yypos255; yy->_thunkpos= yythunkpos255;  if (!yyrTYPE(yy)) goto l261;  if (!yyrtype(yy)) goto l261;  yyDo(yy, yy_3_declaration, yy->_begin, yy->_end);  if (!yyridentifier(yy)) goto l261;
+  {  int yypos264= yy->_pos, yythunkpos264= yy->_thunkpos;  int yymaxpos264= yy->_maxpos;  if (!yyrEQUAL(yy)) goto l264;  yy->_maxpos= yymaxpos264;  goto l261;
+  l264:;	  yy->_pos= yypos264; yy->_thunkpos= yythunkpos264;  yy->_maxpos= yymaxpos264;
+  }  yyDo(yy, yy_4_declaration, yy->_begin, yy->_end);
+  l262:;	  yyPoll(yy);
+  {  int yypos263= yy->_pos, yythunkpos263= yy->_thunkpos;  if (!yyridentifier(yy)) goto l263;
+  {  int yypos265= yy->_pos, yythunkpos265= yy->_thunkpos;  int yymaxpos265= yy->_maxpos;  if (!yyrEQUAL(yy)) goto l265;  yy->_maxpos= yymaxpos265;  goto l263;
+  l265:;	  yy->_pos= yypos265; yy->_thunkpos= yythunkpos265;  yy->_maxpos= yymaxpos265;
+  }  yyDo(yy, yy_4_declaration, yy->_begin, yy->_end);  goto l262;
+  l263:;	  yy->_pos= yypos263; yy->_thunkpos= yythunkpos263;
+  }  goto l255;
+  l261:;	  yy->_pos= yypos255; yy->_thunkpos= yythunkpos255;  if (!yyrTOKEN(yy)) goto l266;  if (!yyridentifier(yy)) goto l266;
+  {  int yypos269= yy->_pos, yythunkpos269= yy->_thunkpos;  int yymaxpos269= yy->_maxpos;  if (!yyrEQUAL(yy)) goto l269;  yy->_maxpos= yymaxpos269;  goto l266;
+  l269:;	  yy->_pos= yypos269; yy->_thunkpos= yythunkpos269;  yy->_maxpos= yymaxpos269;
+  }  yyDo(yy, yy_5_declaration, yy->_begin, yy->_end);
+  l267:;	  yyPoll(yy);
+  {  int yypos268= yy->_pos, yythunkpos268= yy->_thunkpos;  if (!yyridentifier(yy)) goto l268;
+  {  int yypos270= yy->_pos, yythunkpos270= yy->_thunkpos;  int yymaxpos270= yy->_maxpos;  if (!yyrEQUAL(yy)) goto l270;  yy->_maxpos= yymaxpos270;  goto l268;
+  l270:;	  yy->_pos= yypos270; yy->_thunkpos= yythunkpos270;  yy->_maxpos= yymaxpos270;
+  }  yyDo(yy, yy_5_declaration, yy->_begin, yy->_end);  goto l267;
+  l268:;	  yy->_pos= yypos268; yy->_thunkpos= yythunkpos268;
+  }  goto l255;
+  l266:;	  yy->_pos= yypos255; yy->_thunkpos= yythunkpos255;  if (!yyrLAZY(yy)) goto l271;  if (!yyridentifier(yy)) goto l271;
+  {  int yypos274= yy->_pos, yythunkpos274= yy->_thunkpos;  int yymaxpos274= yy->_maxpos;  if (!yyrEQUAL(yy)) goto l274;  yy->_maxpos= yymaxpos274;  goto l271;
+  l274:;	  yy->_pos= yypos274; yy->_thunkpos= yythunkpos274;  yy->_maxpos= yymaxpos274;
+  }  yyDo(yy, yy_6_declaration, yy->_begin, yy->_end);
+  l272:;	  yyPoll(yy);
+  {  int yypos273= yy->_pos, yythunkpos273= yy->_thunkpos;  if (!yyridentifier(yy)) goto l273;
+  {  int yypos275= yy->_pos, yythunkpos275= yy->_thunkpos;  int yymaxpos275= yy->_maxpos;  if (!yyrEQUAL(yy)) goto l275;  yy->_maxpos= yymaxpos275;  goto l273;
+  l275:;	  yy->_pos= yypos275; yy->_thunkpos= yythunkpos275;  yy->_maxpos= yymaxpos275;
+  }  yyDo(yy, yy_6_declaration, yy->_begin, yy->_end);  goto l272;
+  l273:;	  yy->_pos= yypos273; yy->_thunkpos= yythunkpos273;
+  }  goto l255;
+  l271:;	  yy->_pos= yypos255; yy->_thunkpos= yythunkpos255;  if (!yyrSTRUCTURAL(yy)) goto l254;  if (!yyrclass(yy)) goto l254;  yyDo(yy, yy_7_declaration, yy->_begin, yy->_end);
+  }
+  l255:;	
   yyprintf((stderr, "  ok   %s @ %s\n", "declaration", yy->_buf+yy->_pos));
-  return 1;
-  l117:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l254:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "declaration", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
-YY_RULE(int) yy_(yycontext *yy)
+YY_RULE(int) yyr_(yycontext *yy)
 {
-  yyprintf((stderr, "%s\n", "_"));
-  l124:;	
-  {  int yypos125= yy->_pos, yythunkpos125= yy->_thunkpos;
-  {  int yypos126= yy->_pos, yythunkpos126= yy->_thunkpos;  if (!yy_space(yy)) goto l127;  goto l126;
-  l127:;	  yy->_pos= yypos126; yy->_thunkpos= yythunkpos126;  if (!yy_comment(yy)) goto l125;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "_"));
+  l277:;	  yyPoll(yy);
+  {  int yypos278= yy->_pos, yythunkpos278= yy->_thunkpos;
+  {  int yypos279= yy->_pos, yythunkpos279= yy->_thunkpos;  if (!yyrspace(yy)) goto l280;  goto l279;
+  l280:;	  yy->_pos= yypos279; yy->_thunkpos= yythunkpos279;  if (!yyrcomment(yy)) goto l278;
   }
-  l126:;	  goto l124;
-  l125:;	  yy->_pos= yypos125; yy->_thunkpos= yythunkpos125;
+  l279:;	  goto l277;
+  l278:;	  yy->_pos= yypos278; yy->_thunkpos= yythunkpos278;
   }
   yyprintf((stderr, "  ok   %s @ %s\n", "_", yy->_buf+yy->_pos));
-  return 1;
+  yyLeave(yy);  return 1;
 }
-YY_RULE(int) yy_grammar(yycontext *yy)
+YY_RULE(int) yyrgrammar(yycontext *yy)
 {  int yypos0= yy->_pos, yythunkpos0= yy->_thunkpos;
-  yyprintf((stderr, "%s\n", "grammar"));  if (!yy_(yy)) goto l128;
-  {  int yypos131= yy->_pos, yythunkpos131= yy->_thunkpos;  if (!yy_declaration(yy)) goto l132;  goto l131;
-  l132:;	  yy->_pos= yypos131; yy->_thunkpos= yythunkpos131;  if (!yy_definition(yy)) goto l128;
+  yyEnter(yy);  yyprintf((stderr, "%s\n", "grammar"));  if (!yyr_(yy)) goto l281;
+  {  int yypos284= yy->_pos, yythunkpos284= yy->_thunkpos;  if (!yyrdeclaration(yy)) goto l285;  goto l284;
+  l285:;	  yy->_pos= yypos284; yy->_thunkpos= yythunkpos284;  if (!yyrdefinition(yy)) goto l281;
   }
-  l131:;	
-  l129:;	
-  {  int yypos130= yy->_pos, yythunkpos130= yy->_thunkpos;
-  {  int yypos133= yy->_pos, yythunkpos133= yy->_thunkpos;  if (!yy_declaration(yy)) goto l134;  goto l133;
-  l134:;	  yy->_pos= yypos133; yy->_thunkpos= yythunkpos133;  if (!yy_definition(yy)) goto l130;
+  l284:;	
+  l282:;	  yyPoll(yy);
+  {  int yypos283= yy->_pos, yythunkpos283= yy->_thunkpos;
+  {  int yypos286= yy->_pos, yythunkpos286= yy->_thunkpos;  if (!yyrdeclaration(yy)) goto l287;  goto l286;
+  l287:;	  yy->_pos= yypos286; yy->_thunkpos= yythunkpos286;  if (!yyrdefinition(yy)) goto l283;
   }
-  l133:;	  goto l129;
-  l130:;	  yy->_pos= yypos130; yy->_thunkpos= yythunkpos130;
+  l286:;	  goto l282;
+  l283:;	  yy->_pos= yypos283; yy->_thunkpos= yythunkpos283;
   }
-  {  int yypos135= yy->_pos, yythunkpos135= yy->_thunkpos;  if (!yy_trailer(yy)) goto l135;  goto l136;
-  l135:;	  yy->_pos= yypos135; yy->_thunkpos= yythunkpos135;
+  {  int yypos288= yy->_pos, yythunkpos288= yy->_thunkpos;  if (!yyrtrailer(yy)) goto l288;  goto l289;
+  l288:;	  yy->_pos= yypos288; yy->_thunkpos= yythunkpos288;
   }
-  l136:;	  if (!yy_end_of_file(yy)) goto l128;
+  l289:;	  if (!yyrend_of_file(yy)) goto l281;
   yyprintf((stderr, "  ok   %s @ %s\n", "grammar", yy->_buf+yy->_pos));
-  return 1;
-  l128:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
+  yyLeave(yy);  return 1;
+  l281:;	  yy->_pos= yypos0; yy->_thunkpos= yythunkpos0;
   yyprintf((stderr, "  fail %s @ %s\n", "grammar", yy->_buf+yy->_pos));
-  return 0;
+  yyLeave(yy);  return 0;
 }
 
 #ifndef YY_PART
 
 typedef int (*yyrule)(yycontext *yy);
 
-YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+YY_LOCAL(void) yyInit(yycontext *yy)
 {
-  int yyok;
-  if (!yyctx->_buflen)
-    {
-      yyctx->_buflen= YY_BUFFER_SIZE;
-      yyctx->_buf= (char *)YY_MALLOC(yyctx, yyctx->_buflen);
-      yyctx->_textlen= YY_BUFFER_SIZE;
-      yyctx->_text= (char *)YY_MALLOC(yyctx, yyctx->_textlen);
-      yyctx->_thunkslen= YY_STACK_SIZE;
-      yyctx->_thunks= (yythunk *)YY_MALLOC(yyctx, sizeof(yythunk) * yyctx->_thunkslen);
+  yy->_buflen= YY_BUFFER_SIZE;
+  yy->_buf= (char *)YY_MALLOC(yy, yy->_buflen);
+  yy->_textlen= YY_BUFFER_SIZE;
+  yy->_text= (char *)YY_MALLOC(yy, yy->_textlen);
+  yy->_thunkslen= YY_STACK_SIZE;
+  yy->_thunks= (yythunk *)YY_MALLOC(yy, sizeof(yythunk) * yy->_thunkslen);
 #ifdef __cplusplus
-      yyctx->_vals = new std::vector<YYSTYPE>();
-      yyctx->_vals->reserve(YY_STACK_SIZE);
+  yy->_vals = new std::vector<YYSTYPE>();
+  yy->_vals->reserve(YY_STACK_SIZE);
 #else
-      yyctx->_valslen= YY_STACK_SIZE;
-      yyctx->_vals= (YYSTYPE *)YY_MALLOC(yyctx, sizeof(YYSTYPE) * yyctx->_valslen);
-      memset(yyctx->_vals, 0, sizeof(YYSTYPE) * yyctx->_valslen);
+  yy->_valslen= YY_STACK_SIZE;
+  yy->_vals= (YYSTYPE *)YY_MALLOC(yy, sizeof(YYSTYPE) * yy->_valslen);
+  memset(yy->_vals, 0, sizeof(YYSTYPE) * yy->_valslen);
 #endif
-      yyctx->_begin= yyctx->_end= yyctx->_pos= yyctx->_limit= yyctx->_maxpos= yyctx->_thunkpos= 0;
+  yy->_begin= yy->_end= yy->_pos= yy->_limit= yy->_maxpos= yy->_thunkpos= 0;
+}
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok, yystartthunk= 0;
+  size_t yyoffset;
+#ifdef YY_LIMITS
+  int yystartpos;
+#endif
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yyctx->_begin= yyctx->_end= -1;		/* no text yet */
+  yyctx->_thunkpos= yystartthunk;
+  yyctx->_choices= 0;
+  yyctx->_frametop= 0;
+  yyoffset= yyctx->_offset;
+#ifdef YY_STRUCTURAL
+  yyctx->_indexed= 0;
+#endif
+#ifdef YY_LIMITS
+  yyctx->_error= yyctx->_depth= 0;
+  yyctx->_stepcount= 0;
+  yystartpos= yyctx->_pos;
+  if (setjmp(yyctx->_abort))
+    {
+      if (YYLIMIT_CANCEL == yyctx->_error) yyctx->_cancel= 0;
+      yyctx->_pos= (yyctx->_offset != yyoffset) ? 0 : yystartpos;
+      yyctx->_thunkpos= yystartthunk;
+      yyCommit(yyctx);
+      return 0;
     }
-  yyctx->_begin= yyctx->_end= yyctx->_pos;
-  yyctx->_thunkpos= 0;
+#endif
 #ifdef __cplusplus
   yyctx->_vals->resize(1);
   yyctx->_val = &yyctx->_vals->back();
@@ -1506,13 +2665,190 @@ YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
 #endif
   yyok= yystart(yyctx);
   if (yyok) yyDone(yyctx);
+  else if (yyctx->_offset != yyoffset) yyctx->_pos= 0;	/* start of parse already discarded */
   yyCommit(yyctx);
   return yyok;
 }
 
 YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
 {
-  return YYPARSEFROM(YY_CTX_ARG_ yy_grammar);
+  return YYPARSEFROM(YY_CTX_ARG_ yyrgrammar);
+}
+
+#ifdef YY_LAZY
+
+/* Parse the text of a span that was skipped with the rule that it
+ * belongs to.  Spans within it are recorded with their offsets in the
+ * whole input.  Input that the parser has buffered is left alone.
+ */
+YY_PARSE(int) YYPARSESPAN(YY_CTX_PARAM_ const yyspan *yyspan, const char *yytext)
+{
+  char *yybuf;
+  int yybuflen, yypos, yylimit, yymaxpos, yyok;
+  size_t yyoffset;
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yybuf= yyctx->_buf;  yybuflen= yyctx->_buflen;  yypos= yyctx->_pos;  yylimit= yyctx->_limit;
+  yymaxpos= yyctx->_maxpos;  yyoffset= yyctx->_offset;
+  yyctx->_limit= yyspan->end - yyspan->begin;
+  yyctx->_buflen= yyctx->_limit + 1;
+  yyctx->_buf= (char *)YY_MALLOC(yyctx, yyctx->_buflen);
+  memcpy(yyctx->_buf, yytext, yyctx->_limit);
+  yyctx->_pos= yyctx->_maxpos= 0;
+  yyctx->_offset= yyspan->begin;
+  yyctx->_spanning= 1;
+  yyok= YYPARSEFROM(YY_CTX_ARG_ yylazyrules[yyspan->rule]) && !yyctx->_limit;
+  yyctx->_spanning= 0;
+  YY_FREE(yyctx, yyctx->_buf);
+  yyctx->_buf= yybuf;  yyctx->_buflen= yybuflen;  yyctx->_pos= yypos;  yyctx->_limit= yylimit;
+  yyctx->_maxpos= yymaxpos;  yyctx->_offset= yyoffset;
+  return yyok;
+}
+
+#endif
+
+
+#ifdef YY_COROUTINE
+
+/* The parser's stack.  Where anonymous mappings are available it sits
+ * above a page that cannot be touched, so that a parse recursing too
+ * deeply faults, as it would on the thread's own stack, instead of
+ * writing over the heap.
+ */
+#ifdef MAP_ANONYMOUS
+#define yyStackGuard()	((size_t)sysconf(_SC_PAGESIZE))
+#define yyStackSize()	((YY_COROUTINE_STACK_SIZE + yyStackGuard() - 1) / yyStackGuard() * yyStackGuard())
+
+YY_LOCAL(char *) yyStackAlloc(yycontext *yy)
+{
+  char *stack= (char *)mmap(0, yyStackGuard() + yyStackSize(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == stack) return 0;
+  if (mprotect(stack, yyStackGuard(), PROT_NONE))
+    {
+      munmap(stack, yyStackGuard() + yyStackSize());
+      return 0;
+    }
+  return stack;
+}
+
+#define yyStackFree(yy, stack)	munmap((stack), yyStackGuard() + yyStackSize())
+#else
+#define yyStackGuard()		0
+#define yyStackSize()		YY_COROUTINE_STACK_SIZE
+#define yyStackAlloc(yy)	(char *)YY_MALLOC((yy), YY_COROUTINE_STACK_SIZE)
+#define yyStackFree(yy, stack)	YY_FREE((yy), (stack))
+#endif
+
+static void yyCoroutine(unsigned int yyhi, unsigned int yylo)
+{
+  yycontext *yyctx= (yycontext *)((((uintptr_t)yyhi << 16) << 16) | (uintptr_t)yylo);
+  for (;;)
+    {
+      yyctx->_status= YYPARSEFROM(YY_CTX_ARG_ yyrgrammar) ? YYPARSE_ACCEPT : YYPARSE_REJECT;
+      swapcontext(&yyctx->_parser, &yyctx->_caller);
+    }
+}
+
+YY_LOCAL(int) yyResume(yycontext *yy)
+{
+  if (!yy->_stack)
+    {
+      uintptr_t yyarg= (uintptr_t)yy;
+      if (!(yy->_stack= yyStackAlloc(yy)))
+	return YYPARSE_REJECT;
+      getcontext(&yy->_parser);
+      yy->_parser.uc_stack.ss_sp= yy->_stack + yyStackGuard();
+      yy->_parser.uc_stack.ss_size= yyStackSize();
+      yy->_parser.uc_link= 0;
+      makecontext(&yy->_parser, (void (*)(void))yyCoroutine, 2, (unsigned int)((yyarg >> 16) >> 16), (unsigned int)yyarg);
+    }
+#ifdef YY_QUOTA
+  yy->_steps= yy->_quota;
+#endif
+  swapcontext(&yy->_caller, &yy->_parser);
+  return yy->_status;
+}
+
+#endif
+
+#ifdef YY_PUSH
+
+YY_PARSE(int) YYPUSH(YY_CTX_PARAM_ const char *yychunk, int yylen, int yyfinal)
+{
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+#ifdef YY_LIMITS
+  if (yyctx->_maxbuf && yyctx->_limit + yylen >= yyctx->_maxbuf)
+    {
+      yyctx->_error= YYLIMIT_BUFFER;
+      return YYPARSE_REJECT;
+    }
+#endif
+  while (yyctx->_buflen - yyctx->_limit <= yylen)
+    {
+      yyctx->_buflen *= 2;
+#ifdef YY_LIMITS
+      if (yyctx->_maxbuf && yyctx->_buflen > yyctx->_maxbuf)
+	yyctx->_buflen= yyctx->_maxbuf;
+#endif
+      yyctx->_buf= (char *)YY_REALLOC(yyctx, yyctx->_buf, yyctx->_buflen);
+    }
+  memcpy(yyctx->_buf + yyctx->_limit, yychunk, yylen);
+  yyctx->_limit += yylen;
+  yyctx->_final= yyfinal;
+  return yyResume(yyctx);
+}
+
+#endif
+
+#ifdef YY_LIMITS
+
+YY_PARSE(void) YYCANCEL(YY_CTX_PARAM)
+{
+#ifdef __GNUC__
+  __atomic_store_n(&yyctx->_cancel, 1, __ATOMIC_RELAXED);
+#else
+  *(volatile int *)&yyctx->_cancel= 1;
+#endif
+}
+
+#endif
+
+#ifdef YY_QUOTA
+
+YY_PARSE(int) YYPARSEQUOTA(YY_CTX_PARAM_ int yysteps)
+{
+  if (!yyctx->_buflen)
+    yyInit(yyctx);
+  yyctx->_quota= yysteps;
+  return yyResume(yyctx);
+}
+
+#endif
+
+/* Forget the last parse and any input left in the buffer, keeping the
+ * storage that the context has grown, so that the next parse starts
+ * afresh without allocating.
+ */
+YY_PARSE(void) YYRESET(YY_CTX_PARAM)
+{
+  yyctx->_begin= yyctx->_end= yyctx->_pos= yyctx->_limit= yyctx->_maxpos= yyctx->_thunkpos= yyctx->_choices= 0;
+  yyctx->_offset= 0;
+#ifdef YY_PUSH
+  yyctx->_final= 0;
+#endif
+#ifdef YY_LIMITS
+  yyctx->_error= yyctx->_cancel= 0;
+#endif
+#ifdef YY_TOKENS
+  yyctx->_tokencount= yyctx->_token= 0;
+#endif
+#ifdef YY_LAZY
+  yyctx->_spancount= 0;
+#endif
+#ifdef YY_STRUCTURAL
+  yyctx->_indexed= 0;
+#endif
 }
 
 YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)
@@ -1529,12 +2865,76 @@ YY_PARSE(yycontext *) YYRELEASE(yycontext *yyctx)
       YY_FREE(yyctx, yyctx->_vals);
 #endif
     }
+  if (yyctx->_frames)
+    {
+      YY_FREE(yyctx, yyctx->_frames);
+      yyctx->_frames= 0;
+      yyctx->_frameslen= 0;
+    }
+#ifdef YY_COROUTINE
+  if (yyctx->_stack)
+    {
+      yyStackFree(yyctx, yyctx->_stack);
+      yyctx->_stack= 0;
+    }
+#endif
+#ifdef YY_STRUCTURAL
+  if (yyctx->_index)
+    {
+      YY_FREE(yyctx, yyctx->_index);
+      yyctx->_index= 0;
+      yyctx->_indexlen= yyctx->_indexed= 0;
+    }
+#endif
+#ifdef YY_LAZY
+  if (yyctx->_spans)
+    {
+      YY_FREE(yyctx, yyctx->_spans);
+      yyctx->_spans= 0;
+      yyctx->_spanslen= yyctx->_spancount= 0;
+    }
+#endif
+#ifdef YY_TOKENS
+  if (yyctx->_tokens)
+    {
+      YY_FREE(yyctx, yyctx->_tokens);
+      yyctx->_tokens= 0;
+      yyctx->_tokenslen= yyctx->_tokencount= yyctx->_token= 0;
+    }
+#endif
   return yyctx;
 }
 
+
+
+
+
+
+
 #endif
-#line 163 "src/leg.leg"
+#line 189 "src/leg.leg"
+
+
+#ifdef PEG_LIBRARY
 
+/* Built into the library the reader reports errors to readGrammar()
+ * instead of exiting.
+ */
+static jmp_buf	 errorJump;
+static char	*errorMessage= 0;
+
+void yyerror(char *message)
+{
+  int length= strlen(message) + strlen(yyctx->_text) + 64;
+  errorMessage= (char *)malloc(length);
+  if (yyctx->_text[0])
+    snprintf(errorMessage, length, "%s:%d: %s near token '%s'", fileName, lineNumber, message, yyctx->_text);
+  else
+    snprintf(errorMessage, length, "%s:%d: %s", fileName, lineNumber, message);
+  longjmp(errorJump, 1);
+}
+
+#else
 
 void yyerror(char *message)
 {
@@ -1561,6 +2961,8 @@ void yyerror(char *message)
   exit(1);
 }
 
+#endif
+
 void makeHeader(int line, char *text)
 {
   Header *header= (Header *)malloc(sizeof(Header));
@@ -1576,6 +2978,48 @@ void makeTrailer(int line, char *text)
   trailer= strdup(text);
 }
 
+#ifdef PEG_LIBRARY
+
+/* Read a grammar from text into the tree.  Declarations and the trailer
+ * are discarded.  On failure return 0 and point *error at a message
+ * allocated with malloc().
+ */
+int readGrammar(const char *text, char **error)
+{
+  int ok= 0;
+
+  freeRules();
+  if (!(input= fmemopen((void *)text, strlen(text), "r")))
+    {
+      *error= strdup(strerror(errno));
+      return 0;
+    }
+  lineNumber= 1;
+  fileName= "<grammar>";
+  if (!setjmp(errorJump))
+    {
+      if (!yyparse())
+	yyerror("syntax error");
+      ok= 1;
+    }
+  else
+    *error= errorMessage;
+  yyrelease(yyctx);
+  fclose(input);
+  while (headers)
+    {
+      Header *next= headers->next;
+      free(headers->text);
+      free(headers);
+      headers= next;
+    }
+  free(trailer);
+  trailer= 0;
+  return ok;
+}
+
+#else
+
 static void version(char *name)
 {
   printf("%s version %d.%d.%d\n", name, PEG_MAJOR, PEG_MINOR, PEG_LEVEL);
@@ -1586,11 +3030,20 @@ static void usage(char *name)
   version(name);
   fprintf(stderr, "usage: %s [<option>...] [<file>...]\n", name);
   fprintf(stderr, "where <option> can be\n");
+  fprintf(stderr, "  -b          generate bytecode for a parsing machine instead of C rules\n");
+  fprintf(stderr, "  -C          generate a C++ parser class\n");
+  fprintf(stderr, "  -e          execute actions immediately where backtracking is impossible\n");
+  fprintf(stderr, "  -g          generate the whole parser as a single function\n");
   fprintf(stderr, "  -h          print this help information\n");
   fprintf(stderr, "  -o <ofile>  write output to <ofile>\n");
   fprintf(stderr, "  -P          do not generate #line directives\n");
+  fprintf(stderr, "  -r          generate a reentrant parser with no global state\n");
+  fprintf(stderr, "  -R          generate a constexpr C++20 recognizer\n");
+  fprintf(stderr, "  -s          discard matched input whenever no backtracking is possible\n");
   fprintf(stderr, "  -v          be verbose\n");
   fprintf(stderr, "  -V          print version number and exit\n");
+  fprintf(stderr, "  -x <name>   also generate the named driver: parallel, batch, pool,\n");
+  fprintf(stderr, "              records, events, readahead or segments\n");
   fprintf(stderr, "if no <file> is given, input is read from stdin\n");
   fprintf(stderr, "if no <ofile> is given, output is written to stdout\n");
   exit(1);
@@ -1606,7 +3059,7 @@ int main(int argc, char **argv)
   lineNumber= 1;
   fileName= "<stdin>";
 
-  while (-1 != (c= getopt(argc, argv, "PVho:v")))
+  while (-1 != (c= getopt(argc, argv, "CPRVbeghro:svx:")))
     {
       switch (c)
 	{
@@ -1614,6 +3067,26 @@ int main(int argc, char **argv)
 	  version(basename(argv[0]));
 	  exit(0);
 
+	case 'b':
+	  bytecodeFlag= 1;
+	  break;
+
+	case 'C':
+	  cppFlag= 1;
+	  break;
+
+	case 'R':
+	  constexprFlag= 1;
+	  break;
+
+	case 'e':
+	  eagerFlag= 1;
+	  break;
+
+	case 'g':
+	  gotoFlag= 1;
+	  break;
+
 	case 'h':
 	  usage(basename(argv[0]));
 	  break;
@@ -1630,10 +3103,27 @@ int main(int argc, char **argv)
 	  nolinesFlag= 1;
 	  break;
 
+	case 'r':
+	  reentrantFlag= 1;
+	  break;
+
+	case 's':
+	  streamFlag= 1;
+	  break;
+
 	case 'v':
 	  verboseFlag= 1;
 	  break;
 
+	case 'x':
+	  if (!driverFlag(optarg))
+	    {
+	      fprintf(stderr, "%s: unknown driver '%s'\n", argv[0], optarg);
+	      exit(1);
+	    }
+	  driverFlags |= driverFlag(optarg);
+	  break;
+
 	default:
 	  fprintf(stderr, "for usage try: %s -h\n", argv[0]);
 	  exit(1);
@@ -1695,3 +3185,5 @@ int main(int argc, char **argv)
   return 0;
 }
 
+#endif
+
@@ -0,0 +1,781 @@
+/* Matching input against grammars read at run time.  See libpeg.h.
+ *
+ * The grammar is read by leg's own reader (leg.c built with
+ * -DPEG_LIBRARY), lowered by Rule_compile_program() and then copied out
+ * of the tree so that the tree can be reused for the next grammar.
+ * peg_compile_native() also feeds the tree to Rule_compile_c() and
+ * loads the result with dlopen().
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "version.h"
+#include "tree.h"
+#include "libpeg.h"
+
+#ifndef PEG_STACK_LIMIT
+# define PEG_STACK_LIMIT	(1 << 24)	/* ints of backtracking stack, or captures */
+#endif
+
+struct peg_grammar
+{
+  int		 *code;
+  int		  start;
+  char		**strings;	int *lengths;	int stringCount;
+  unsigned char	**classes;	int classCount;
+  peg_capture	 *actions;	int actionCount;
+  void		 *module;
+  void		(*unload)(void);
+  long		(*native)(const char *buf, size_t len, void (*capture)(void *, int, size_t, size_t), void *user);
+};
+
+typedef struct Thunk { int action, begin, end; } Thunk;
+
+static char *message(const char *format, const char *name, const char *detail)
+{
+  int   length= strlen(format) + strlen(name) + strlen(detail);
+  char *text= (char *)malloc(length);
+  snprintf(text, length, format, name, detail);
+  return text;
+}
+
+/* Answer the kind of C code in node that a grammar without a compiler
+ * cannot run, or 0 if there is none.
+ */
+static const char *unsupported(Node *node)
+{
+  const char *kind;
+  switch (node->type)
+    {
+    case Predicate:
+      if (strcmp(node->predicate.text, "YY_BEGIN") && strcmp(node->predicate.text, "YY_END"))
+	return "predicates";
+      break;
+
+    case Inline:	return "inline code";
+    case Error:		return "error actions";
+
+    case Alternate:
+    case Sequence:
+      for (node= node->alternate.first;  node;  node= node->any.next)
+	if ((kind= unsupported(node)))
+	  return kind;
+      break;
+
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:
+      return unsupported(node->query.element);
+    }
+  return 0;
+}
+
+static peg_grammar *failed(char **error, char *text)
+{
+  freeRules();
+  if (error)
+    *error= text;
+  else
+    free(text);
+  return 0;
+}
+
+static void Grammar_compile_c(Program *p);
+
+/* Read and lower a grammar.  If source is not null, also write the
+ * grammar to it as C for peg_compile_native().
+ */
+static peg_grammar *compile(const char *text, char **error, FILE *source)
+{
+  peg_grammar *g;
+  Program     *p;
+  Node	      *n;
+  const char  *kind;
+  char	      *errorText= 0;
+  int	       i;
+
+  if (!readGrammar(text, &errorText))
+    return failed(error, errorText);
+  if (!start)
+    return failed(error, strdup("grammar has no rules"));
+  for (n= rules;  n;  n= n->rule.next)
+    {
+      if (!n->rule.expression)
+	return failed(error, message("rule '%s' %s", n->rule.name, "used but not defined"));
+      if ((kind= unsupported(n->rule.expression)))
+	return failed(error, message("rule '%s' uses %s, which need a C compiler", n->rule.name, kind));
+      n->rule.flags |= RuleUsed;	/* unused rules are harmless here */
+    }
+
+  p= Rule_compile_program(rules);
+  g= (peg_grammar *)calloc(1, sizeof(peg_grammar));
+  g->code= p->code;
+  g->start= p->rules[start->rule.id];
+  g->stringCount= p->stringCount;
+  g->strings= (char **)malloc(sizeof(char *) * (p->stringCount + 1));
+  g->lengths= (int *)malloc(sizeof(int) * (p->stringCount + 1));
+  for (i= 0;  i < p->stringCount;  ++i)
+    {
+      g->strings[i]= strdup(p->strings[i]);
+      g->lengths[i]= unescape(g->strings[i]);
+    }
+  g->classes= p->classes;
+  g->classCount= p->classCount;
+  g->actionCount= p->nodeCount;
+  g->actions= (peg_capture *)calloc(p->nodeCount + 1, sizeof(peg_capture));
+  for (i= 0;  i < p->nodeCount;  ++i)
+    {
+      g->actions[i].action= i;
+      g->actions[i].rule= strdup(p->nodes[i]->action.rule->rule.name);
+      g->actions[i].text= strdup(p->nodes[i]->action.text);
+    }
+  if (source)
+    {
+      output= source;
+      Grammar_compile_c(p);
+    }
+  free(p->strings);
+  free(p->nodes);
+  free(p->rules);
+  free(p);
+  freeRules();
+  return g;
+}
+
+peg_grammar *peg_compile(const char *text, char **error)
+{
+  return compile(text, error, 0);
+}
+
+void peg_free(peg_grammar *g)
+{
+  int i;
+  if (!g) return;
+  for (i= 0;  i < g->stringCount;  ++i)
+    free(g->strings[i]);
+  for (i= 0;  i < g->classCount;  ++i)
+    free(g->classes[i]);
+  for (i= 0;  i < g->actionCount;  ++i)
+    {
+      free((char *)g->actions[i].rule);
+      free((char *)g->actions[i].text);
+    }
+  free(g->code);
+  free(g->strings);
+  free(g->lengths);
+  free(g->classes);
+  free(g->actions);
+  if (g->unload)
+    g->unload();
+  if (g->module)
+    dlclose(g->module);
+  free(g);
+}
+
+/* A compiled grammar is a shared object exporting pegNativeABI,
+ * pegNativeMatch() and pegNativeUnload().  Its actions are replaced by
+ * calls to yyCapture(), which finds its thunk by searching forward from
+ * the last one reported, since yyDone() runs the thunks in order.  Input
+ * is copied into the parser's buffer in small pieces, since a match
+ * usually covers only a little of what it is offered, and each thread
+ * keeps one context between matches in a thread-specific key, which
+ * frees it when the thread exits.  pegNativeUnload() frees the calling
+ * thread's context before the object is closed; those of other threads
+ * still running are lost, since no destructor may run once it is gone.
+ */
+#define PEG_NATIVE_ABI	2
+
+static const char *nativeHeader= "\
+#include <pthread.h>\n\
+#define YY_CTX_LOCAL\n\
+#define YY_CTX_MEMBERS							\\\n\
+  const char *_input;  size_t _length, _read;  int _captured;		\\\n\
+  void (*_capture)(void *, int, size_t, size_t);  void *_user;\n\
+#define YY_INPUT(yy, buf, result, max_size)				\\\n\
+  {									\\\n\
+    size_t yyavail= yy->_length - yy->_read;			\\\n\
+    if (yyavail > (size_t)(max_size)) yyavail= (max_size);		\\\n\
+    if (yyavail > 64) yyavail= 64;					\\\n\
+    memcpy((buf), yy->_input + yy->_read, yyavail);		\\\n\
+    yy->_read += yyavail;						\\\n\
+    result= yyavail;						\\\n\
+  }\n\
+#define YY_PARSE(T)	static T\n\
+struct _yycontext;\n\
+static void yyCapture(struct _yycontext *yy, int action, int id);\n\
+";
+
+static const char *nativeFooter= "\
+\n\
+static void yyCapture(yycontext *yy, int action, int id)\n\
+{\n\
+  yythunk *thunk= yy->_thunks + yy->_captured;\n\
+  if (!yy->_capture) return;\n\
+  while (thunk->action != id) ++thunk;\n\
+  yy->_captured= thunk - yy->_thunks + 1;\n\
+  yy->_capture(yy->_user, action, thunk->begin, thunk->end < thunk->begin ? thunk->begin : thunk->end);\n\
+}\n\
+\n\
+const int pegNativeABI= %d;\n\
+\n\
+static pthread_key_t  yyspare;\n\
+static pthread_once_t yysparing= PTHREAD_ONCE_INIT;\n\
+\n\
+static void yyFreeSpare(void *yy)	{ free(yyrelease((yycontext *)yy)); }\n\
+static void yyMakeSpare(void)		{ pthread_key_create(&yyspare, yyFreeSpare); }\n\
+\n\
+long pegNativeMatch(const char *buf, size_t len, void (*capture)(void *, int, size_t, size_t), void *user)\n\
+{\n\
+  yycontext *yy;\n\
+  long	     result;\n\
+  pthread_once(&yysparing, yyMakeSpare);\n\
+  if ((yy= (yycontext *)pthread_getspecific(yyspare)))\n\
+    pthread_setspecific(yyspare, 0);\n\
+  else\n\
+    yy= (yycontext *)calloc(1, sizeof(yycontext));\n\
+  yy->_input= buf;\n\
+  yy->_length= len;\n\
+  yy->_read= 0;\n\
+  yy->_captured= 0;\n\
+  yy->_capture= capture;\n\
+  yy->_user= user;\n\
+  yy->_pos= yy->_limit= 0;\n\
+  yy->_offset= 0;\n\
+  result= yyparse(yy) ? (long)yy->_offset : -1;\n\
+  if (pthread_getspecific(yyspare))\n\
+    yyFreeSpare(yy);\n\
+  else\n\
+    pthread_setspecific(yyspare, yy);\n\
+  return result;\n\
+}\n\
+\n\
+void pegNativeUnload(void)\n\
+{\n\
+  yycontext *yy;\n\
+  pthread_once(&yysparing, yyMakeSpare);\n\
+  if ((yy= (yycontext *)pthread_getspecific(yyspare)))\n\
+    yyFreeSpare(yy);\n\
+  pthread_key_delete(yyspare);\n\
+}\n\
+";
+
+/* Detach the variables from node, since their values are never used.
+ */
+static void Node_forgetVariables(Node *node)
+{
+  switch (node->type)
+    {
+    case Name:		node->name.variable= 0;					break;
+    case Error:		Node_forgetVariables(node->error.element);		break;
+
+    case Alternate:
+    case Sequence:
+      for (node= node->alternate.first;  node;  node= node->any.next)
+	Node_forgetVariables(node);
+      break;
+
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		Node_forgetVariables(node->query.element);		break;
+    }
+}
+
+static void Grammar_compile_c(Program *p)
+{
+  Node **variables= (Node **)calloc(ruleCount + 1, sizeof(Node *));
+  Node  *n;
+  char	 text[64];
+  int	 i;
+  for (i= 0;  i < p->nodeCount;  ++i)
+    {
+      Node *action= p->nodes[i];
+      snprintf(text, sizeof(text), "yyCapture(yy, %d, yy%s)", i, action->action.name);
+      free(action->action.text);
+      action->action.text= strdup(text);
+    }
+  for (n= rules;  n;  n= n->rule.next)
+    {
+      Node_forgetVariables(n->rule.expression);
+      variables[n->rule.id]= n->rule.variables;
+      n->rule.variables= 0;
+    }
+  Rule_compile_c_header();
+  fprintf(output, "%s", nativeHeader);
+  Rule_compile_c(rules, 1);
+  fprintf(output, nativeFooter, PEG_NATIVE_ABI);
+  for (n= rules;  n;  n= n->rule.next)
+    n->rule.variables= variables[n->rule.id];
+  free(variables);
+}
+
+static char *nativeLoad(peg_grammar *g, const char *path)
+{
+  const int *abi;
+  if (!(g->module= dlopen(path, RTLD_NOW | RTLD_LOCAL)))
+    return strdup(dlerror());
+  abi= (const int *)dlsym(g->module, "pegNativeABI");
+  g->native= (long (*)(const char *, size_t, void (*)(void *, int, size_t, size_t), void *))dlsym(g->module, "pegNativeMatch");
+  if (!abi || *abi != PEG_NATIVE_ABI || !g->native)
+    return message("%s%s", path, ": not a compiled grammar for this version of libpeg");
+  g->unload= (void (*)(void))dlsym(g->module, "pegNativeUnload");
+  return 0;
+}
+
+/* SHA-256 over the grammar and everything else that affects the code
+ * generated for it, so that no chosen grammar can share the name of the
+ * object compiled for another.
+ */
+typedef struct Digest
+{
+  uint32_t	h[8];
+  unsigned char block[64];
+  uint64_t	length;
+} Digest;
+
+static const uint32_t rounds[64]= {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#define ROTR(X, N)	(((X) >> (N)) | ((X) << (32 - (N))))
+
+static void digestBlock(Digest *d)
+{
+  uint32_t w[64], a, b, c, e, f, g, h, k, t1, t2;
+  int	   i;
+  for (i= 0;  i < 16;  ++i)
+    w[i]= (uint32_t)d->block[4 * i] << 24 | (uint32_t)d->block[4 * i + 1] << 16 | (uint32_t)d->block[4 * i + 2] << 8 | d->block[4 * i + 3];
+  for (;  i < 64;  ++i)
+    w[i]= w[i - 16] + (ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3))
+	+ w[i - 7] + (ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10));
+  a= d->h[0];  b= d->h[1];  c= d->h[2];  k= d->h[3];
+  e= d->h[4];  f= d->h[5];  g= d->h[6];  h= d->h[7];
+  for (i= 0;  i < 64;  ++i)
+    {
+      t1= h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + rounds[i] + w[i];
+      t2= (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+      h= g;  g= f;  f= e;  e= k + t1;
+      k= c;  c= b;  b= a;  a= t1 + t2;
+    }
+  d->h[0] += a;  d->h[1] += b;  d->h[2] += c;  d->h[3] += k;
+  d->h[4] += e;  d->h[5] += f;  d->h[6] += g;  d->h[7] += h;
+}
+
+#undef ROTR
+
+static void digestInit(Digest *d)
+{
+  static const uint32_t h0[8]= {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+  };
+  memcpy(d->h, h0, sizeof(h0));
+  d->length= 0;
+}
+
+static void digestAdd(Digest *d, const void *data, size_t size)
+{
+  const unsigned char *p= (const unsigned char *)data;
+  while (size--)
+    {
+      d->block[d->length++ % 64]= *p++;
+      if (!(d->length % 64))
+	digestBlock(d);
+    }
+}
+
+/* Finish d and write its value into hex as 64 hexadecimal digits. */
+static void digestHex(Digest *d, char hex[65])
+{
+  uint64_t bits= d->length * 8;
+  int	   i;
+  digestAdd(d, "\x80", 1);
+  while (d->length % 64 != 56)
+    digestAdd(d, "", 1);
+  for (i= 56;  i >= 0;  i -= 8)
+    {
+      unsigned char byte= (unsigned char)(bits >> i);
+      digestAdd(d, &byte, 1);
+    }
+  for (i= 0;  i < 32;  ++i)
+    sprintf(hex + 2 * i, "%02x", (unsigned)(d->h[i / 4] >> (24 - 8 * (i % 4))) & 0xff);
+}
+
+/* Answer 0 if st describes a directory (or a regular file) that only
+ * the current user could have written, otherwise why it is not.
+ */
+static char *notPrivate(const char *name, const struct stat *st, int directory)
+{
+  if (directory ? !S_ISDIR(st->st_mode) : !S_ISREG(st->st_mode))
+    return message("%s%s", name, directory ? ": not a directory" : ": not a regular file");
+  if (st->st_uid != geteuid() || (st->st_mode & (S_IWGRP | S_IWOTH)))
+    return message("%s%s", name, ": writable by another user");
+  return 0;
+}
+
+static char *privateDirectory(const char *dir)
+{
+  struct stat st;
+  if (stat(dir, &st))
+    return message("%s: %s", dir, strerror(errno));
+  return notPrivate(dir, &st, 1);
+}
+
+/* Answer in dir the cache to use when the caller names none: peg-uid in
+ * $TMPDIR or /tmp, made if need be.  If someone else has taken that
+ * name, fall back to a directory from mkdtemp() that lasts as long as
+ * the process, so that nothing is shared with them.
+ */
+static char *defaultDirectory(char *dir, size_t size)
+{
+  static char  fallback[4096];
+  const char  *tmp= getenv("TMPDIR");
+  char	      *problem;
+
+  if (!tmp)
+    tmp= "/tmp";
+  snprintf(dir, size, "%s/peg-%d", tmp, (int)geteuid());
+  if (mkdir(dir, 0700) && EEXIST != errno)
+    return message("%s: %s", dir, strerror(errno));
+  if (!(problem= privateDirectory(dir)))
+    return 0;
+  free(problem);
+  if (!*fallback)
+    {
+      snprintf(fallback, sizeof(fallback), "%s/peg-XXXXXX", tmp);
+      if (!mkdtemp(fallback))
+	{
+	  problem= message("%s: %s", fallback, strerror(errno));
+	  *fallback= 0;
+	  return problem;
+	}
+    }
+  snprintf(dir, size, "%s", fallback);
+  return 0;
+}
+
+/* Run cc, which may carry options of its own as $CC often does, to
+ * compile source into the shared object, without going through a shell.
+ */
+static int compileObject(const char *cc, const char *object, const char *source)
+{
+  char *words= strdup(cc), *argv[64], *word;
+  int	argc= 0, status= 0;
+  pid_t pid;
+
+  for (word= strtok(words, " \t");  word && argc < 54;  word= strtok(0, " \t"))
+    argv[argc++]= word;
+  argv[argc++]= "-shared";
+  argv[argc++]= "-fPIC";
+  argv[argc++]= "-pthread";
+  argv[argc++]= "-O2";
+  argv[argc++]= "-w";
+  argv[argc++]= "-o";
+  argv[argc++]= (char *)object;
+  argv[argc++]= (char *)source;
+  argv[argc]= 0;
+  if (argc > 8 && (pid= fork()) >= 0)
+    {
+      if (!pid)
+	{
+	  execvp(argv[0], argv);
+	  _exit(127);
+	}
+      while (waitpid(pid, &status, 0) < 0)
+	if (EINTR != errno)
+	  {
+	    status= -1;
+	    break;
+	  }
+    }
+  else
+    status= -1;
+  free(words);
+  return WIFEXITED(status) && !WEXITSTATUS(status);
+}
+
+peg_grammar *peg_compile_native(const char *text, const char *cacheDir, char **error)
+{
+  char	       version[64], key[65], dir[4096], path[4096], source[4096], object[4096], *problem;
+  const char  *cc= getenv("CC");
+  Digest       digest;
+  peg_grammar *g;
+  struct stat  st;
+  FILE	      *file;
+  int	       fd;
+
+  if (!cc)
+    cc= "cc";
+  if (cacheDir)
+    snprintf(dir, sizeof(dir), "%s", cacheDir);
+  if ((problem= cacheDir ? privateDirectory(dir) : defaultDirectory(dir, sizeof(dir))))
+    return failed(error, problem);
+  snprintf(version, sizeof(version), "peg %d.%d.%d abi %d", PEG_MAJOR, PEG_MINOR, PEG_LEVEL, PEG_NATIVE_ABI);
+  digestInit(&digest);
+  digestAdd(&digest, version, strlen(version) + 1);
+  digestAdd(&digest, text, strlen(text));
+  digestHex(&digest, key);
+  snprintf(path, sizeof(path), "%s/peg-%s.so", dir, key);
+
+  if ((fd= open(path, O_RDONLY | O_NOFOLLOW)) >= 0)
+    {
+      problem= fstat(fd, &st) ? message("%s: %s", path, strerror(errno)) : notPrivate(path, &st, 0);
+      close(fd);
+      if (problem)
+	return failed(error, problem);
+      if (!(g= compile(text, error, 0)))
+	return 0;
+    }
+  else
+    {
+      snprintf(source, sizeof(source), "%s/peg-%s-%d.c", dir, key, (int)getpid());
+      snprintf(object, sizeof(object), "%s/peg-%s-%d.so", dir, key, (int)getpid());
+      if ((fd= open(source, O_WRONLY | O_CREAT | O_EXCL, 0600)) < 0 || !(file= fdopen(fd, "w")))
+	{
+	  problem= message("%s: %s", source, strerror(errno));
+	  if (fd >= 0)
+	    close(fd);
+	  return failed(error, problem);
+	}
+      g= compile(text, error, file);
+      fclose(file);
+      if (!g)
+	{
+	  unlink(source);
+	  return 0;
+	}
+      if (!compileObject(cc, object, source) || rename(object, path))
+	{
+	  unlink(source);
+	  unlink(object);
+	  peg_free(g);
+	  return failed(error, message("%s%s", cc, ": could not compile the grammar"));
+	}
+      unlink(source);
+    }
+
+  if ((problem= nativeLoad(g, path)))
+    {
+      peg_free(g);
+      return failed(error, problem);
+    }
+  return g;
+}
+
+/* Double the size of items, freeing them and answering 0 if that would
+ * pass the limit or there is no memory.
+ */
+static void *grow(void *items, int *count, size_t size)
+{
+  void *grown= 0;
+  if (*count < PEG_STACK_LIMIT)
+    grown= realloc(items, size * (*count *= 2));
+  if (!grown)
+    free(items);
+  return grown;
+}
+
+typedef struct Capturing
+{
+  const peg_grammar   *grammar;
+  const peg_callbacks *callbacks;
+  void		      *user;
+} Capturing;
+
+static void nativeCapture(void *closure, int action, size_t begin, size_t end)
+{
+  Capturing  *c= (Capturing *)closure;
+  peg_capture capture= c->grammar->actions[action];
+  capture.begin= begin;
+  capture.end= end;
+  c->callbacks->capture(c->user, &capture);
+}
+
+static long nativeMatch(const peg_grammar *g, const char *input, size_t len, const peg_callbacks *callbacks, void *user)
+{
+  Capturing c= { g, callbacks, user };
+  if (callbacks && callbacks->capture)
+    return g->native(input, len, nativeCapture, &c);
+  return g->native(input, len, 0, 0);
+}
+
+#ifdef __GNUC__
+# define CASE(OP)	L##OP:
+# define NEXT		goto *ops[code[pc]]
+#else
+# define CASE(OP)	case OP:
+# define NEXT		goto next
+#endif
+
+#define PUSH(PC, POS, TP)									\
+  if (sp + 3 > stackSize && !(stack= (int *)grow(stack, &stackSize, sizeof(int)))) goto done;	\
+  stack[sp]= (PC);  stack[sp + 1]= (POS);  stack[sp + 2]= (TP);  sp += 3
+
+/* The machine of leg -b, without semantic values and without the calls
+ * into generated code.  The stack holds three ints per entry: a choice
+ * point is {pc, pos, thunkpos} and a call is {-2 - return pc, pos,
+ * thunkpos}.  The outermost call has -1 in place of its return pc.
+ */
+long peg_match(const peg_grammar *g, const char *input, size_t len, const peg_callbacks *callbacks, void *user)
+{
+  const unsigned char *buf= (const unsigned char *)input;
+  const int	      *code= g->code;
+  int		       pc= g->start, pos= 0, limit, begin= 0, end= 0;
+  int		      *stack, sp= 3, stackSize= 3 * 64;
+  Thunk		      *thunks, *t;
+  int		       thunkpos= 0, thunkSize= 64;
+  long		       result= -1;
+#ifdef __GNUC__
+  static void *ops[]= {
+    &&LOpChar, &&LOpString, &&LOpIString, &&LOpClass, &&LOpSpan, &&LOpAny,
+    &&LOpChoice, &&LOpNotChoice, &&LOpCommit, &&LOpBackCommit, &&LOpFail, &&LOpFailTwice,
+    &&LOpCut, &&LOpCall, &&LOpReturn, &&LOpJump, &&LOpBegin, &&LOpEnd,
+    &&LOpPush, &&LOpPop, &&LOpAssign, &&LOpAction, &&LOpEager, &&LOpPredicate, &&LOpCode,
+    &&LOpStream,
+  };
+#endif
+
+  if (len > INT_MAX)
+    return -1;
+  if (g->native)
+    return nativeMatch(g, input, len, callbacks, user);
+  limit= len;
+  stack= (int *)malloc(sizeof(int) * stackSize);
+  thunks= (Thunk *)malloc(sizeof(Thunk) * thunkSize);
+  if (!stack || !thunks)
+    goto done;
+  stack[0]= -1;  stack[1]= 0;  stack[2]= 0;
+
+#ifdef __GNUC__
+  NEXT;
+#else
+ next:
+  switch (code[pc])
+    {
+#endif
+    CASE(OpChar)
+      if (pos >= limit || buf[pos] != code[pc + 1]) goto fail;
+      ++pos;  pc += 2;  NEXT;
+    CASE(OpString)
+      {
+	int n= code[pc + 1], length= g->lengths[n];
+	if (limit - pos < length || memcmp(buf + pos, g->strings[n], length)) goto fail;
+	pos += length;  pc += 2;  NEXT;
+      }
+    CASE(OpIString)
+      {
+	int n= code[pc + 1], length= g->lengths[n], i;
+	if (limit - pos < length) goto fail;
+	for (i= 0;  i < length;  ++i)
+	  if (tolower(buf[pos + i]) != (unsigned char)g->strings[n][i]) goto fail;
+	pos += length;  pc += 2;  NEXT;
+      }
+    CASE(OpClass)
+      {
+	const unsigned char *bits= g->classes[code[pc + 1]];
+	if (pos >= limit || !(bits[buf[pos] >> 3] & (1 << (buf[pos] & 7)))) goto fail;
+	++pos;  pc += 2;  NEXT;
+      }
+    CASE(OpSpan)
+      {
+	const unsigned char *bits= g->classes[code[pc + 1]];
+	while (pos < limit && (bits[buf[pos] >> 3] & (1 << (buf[pos] & 7)))) ++pos;
+	pc += 2;  NEXT;
+      }
+    CASE(OpAny)
+      if (pos >= limit) goto fail;
+      ++pos;  pc += 1;  NEXT;
+    CASE(OpChoice)
+    CASE(OpNotChoice)
+      PUSH(code[pc + 1], pos, thunkpos);  pc += 2;  NEXT;
+    CASE(OpCommit)	sp -= 3;  pc= code[pc + 1];  NEXT;
+    CASE(OpBackCommit)
+      sp -= 3;
+      pos= stack[sp + 1];
+      thunkpos= stack[sp + 2];
+      pc= code[pc + 1];
+      NEXT;
+    CASE(OpFail)	goto fail;
+    CASE(OpFailTwice)	sp -= 3;  goto fail;
+    CASE(OpCut)		sp -= 3;  pc += 1;  NEXT;
+    CASE(OpCall)	PUSH(-2 - (pc + 2), pos, thunkpos);  pc= code[pc + 1];  NEXT;
+    CASE(OpReturn)
+      sp -= 3;
+      if (stack[sp] == -1)
+	{
+	  result= pos;
+	  goto done;
+	}
+      pc= -2 - stack[sp];
+      NEXT;
+    CASE(OpJump)	pc= code[pc + 1];  NEXT;
+    CASE(OpBegin)	begin= pos;  pc += 1;  NEXT;
+    CASE(OpEnd)		end= pos;  pc += 1;  NEXT;
+    CASE(OpPush)
+    CASE(OpPop)
+    CASE(OpAssign)	pc += 2;  NEXT;
+    CASE(OpAction)
+      if (thunkpos == thunkSize && !(thunks= (Thunk *)grow(thunks, &thunkSize, sizeof(Thunk)))) goto done;
+      thunks[thunkpos].action= code[pc + 1];
+      thunks[thunkpos].begin= begin;
+      thunks[thunkpos].end= end;
+      ++thunkpos;
+      pc += 2;
+      NEXT;
+    CASE(OpEager)
+    CASE(OpPredicate)
+    CASE(OpCode)
+    CASE(OpStream)
+      goto done;	/* never compiled for a library grammar */
+#ifndef __GNUC__
+    }
+#endif
+
+ fail:
+  do
+    sp -= 3;
+  while (stack[sp] < -1);
+  if (stack[sp] == -1)
+    goto done;
+  pc= stack[sp];
+  pos= stack[sp + 1];
+  thunkpos= stack[sp + 2];
+  NEXT;
+
+ done:
+  if (result >= 0 && callbacks && callbacks->capture)
+    for (t= thunks;  t < thunks + thunkpos;  ++t)
+      {
+	peg_capture capture= g->actions[t->action];
+	capture.begin= t->begin;
+	capture.end= t->end < t->begin ? t->begin : t->end;
+	callbacks->capture(user, &capture);
+      }
+  free(stack);
+  free(thunks);
+  return result;
+}
+
+#undef PUSH
+#undef NEXT
+#undef CASE
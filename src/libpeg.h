@@ -0,0 +1,70 @@
+/* Matching input against grammars read at run time.
+ *
+ * A grammar is written in leg syntax and compiled in memory to a program
+ * for the same parsing machine as leg -b.  Actions are not executed:
+ * each action that survives a successful match is reported as a capture
+ * whose span is the text between the most recent < and > (the text that
+ * yytext would hold).  Variables are accepted and ignored.  Predicates,
+ * inline code and error actions are C and cannot be run, so a grammar
+ * that uses them is rejected.  Declarations and the trailer are ignored.
+ *
+ * peg_compile() uses the global state of the grammar reader and must not
+ * be called from two threads at once.  A compiled grammar is read-only;
+ * any number of threads may call peg_match() with it concurrently.
+ */
+
+#ifndef LIBPEG_H
+#define LIBPEG_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct peg_grammar peg_grammar;
+
+typedef struct peg_capture
+{
+  int		 action;	/* distinct for each action in the grammar, from 0 */
+  const char	*rule;		/* the rule containing the action */
+  const char	*text;		/* the text of the action, without its braces */
+  size_t	 begin;		/* the span of the capture in the input */
+  size_t	 end;
+} peg_capture;
+
+typedef struct peg_callbacks
+{
+  void	(*capture)(void *user, const peg_capture *capture);
+} peg_callbacks;
+
+/* Compile grammar text.  The start rule is the rule called start, or
+ * else the first rule.  On failure return 0 and, if error is not null,
+ * point it at a message that the caller must free().
+ */
+peg_grammar *peg_compile(const char *text, char **error);
+
+/* As peg_compile(), but also translate the grammar to C, compile it
+ * with $CC (or cc) and load it, so that peg_match() runs generated code.
+ * The shared object is cached in cacheDir under a SHA-256 hash of the
+ * grammar and the version of peg, and later calls with the same grammar
+ * load it from there without compiling.  cacheDir and the object must
+ * belong to the caller and be writable by no one else.  If cacheDir is
+ * null it is peg-<uid> in $TMPDIR or /tmp, made with mode 0700 if need
+ * be.
+ */
+peg_grammar *peg_compile_native(const char *text, const char *cacheDir, char **error);
+
+/* Match the start rule against a prefix of buf.  On success report the
+ * captures in order and return the length of the prefix, otherwise
+ * return -1.
+ */
+long peg_match(const peg_grammar *grammar, const char *buf, size_t len, const peg_callbacks *callbacks, void *user);
+
+void peg_free(peg_grammar *grammar);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
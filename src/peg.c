@@ -83,11 +83,20 @@ static void usage(char *name)
   version(name);
   fprintf(stderr, "usage: %s [<option>...] [<file>...]\n", name);
   fprintf(stderr, "where <option> can be\n");
+  fprintf(stderr, "  -b          generate bytecode for a parsing machine instead of C rules\n");
+  fprintf(stderr, "  -C          generate a C++ parser class\n");
+  fprintf(stderr, "  -e          execute actions immediately where backtracking is impossible\n");
+  fprintf(stderr, "  -g          generate the whole parser as a single function\n");
   fprintf(stderr, "  -h          print this help information\n");
   fprintf(stderr, "  -o <ofile>  write output to <ofile>\n");
   fprintf(stderr, "  -P          do not generate #line directives\n");
+  fprintf(stderr, "  -r          generate a reentrant parser with no global state\n");
+  fprintf(stderr, "  -R          generate a constexpr C++20 recognizer\n");
+  fprintf(stderr, "  -s          discard matched input whenever no backtracking is possible\n");
   fprintf(stderr, "  -v          be verbose\n");
   fprintf(stderr, "  -V          print version number and exit\n");
+  fprintf(stderr, "  -x <name>   also generate the named driver: parallel, batch, pool,\n");
+  fprintf(stderr, "              records, events, readahead or segments\n");
   fprintf(stderr, "if no <file> is given, input is read from stdin\n");
   fprintf(stderr, "if no <ofile> is given, output is written to stdout\n");
   exit(1);
@@ -103,7 +112,7 @@ int main(int argc, char **argv)
   lineNumber= 1;
   fileName= "<stdin>";
 
-  while (-1 != (c= getopt(argc, argv, "PVho:v")))
+  while (-1 != (c= getopt(argc, argv, "CPRVbeghro:svx:")))
     {
       switch (c)
 	{
@@ -111,6 +120,26 @@ int main(int argc, char **argv)
 	  version(basename(argv[0]));
 	  exit(0);
 
+	case 'b':
+	  bytecodeFlag= 1;
+	  break;
+
+	case 'C':
+	  cppFlag= 1;
+	  break;
+
+	case 'R':
+	  constexprFlag= 1;
+	  break;
+
+	case 'e':
+	  eagerFlag= 1;
+	  break;
+
+	case 'g':
+	  gotoFlag= 1;
+	  break;
+
 	case 'h':
 	  usage(basename(argv[0]));
 	  break;
@@ -127,10 +156,27 @@ int main(int argc, char **argv)
 	  nolinesFlag= 1;
 	  break;
 
+	case 'r':
+	  reentrantFlag= 1;
+	  break;
+
+	case 's':
+	  streamFlag= 1;
+	  break;
+
 	case 'v':
 	  verboseFlag= 1;
 	  break;
 
+	case 'x':
+	  if (!driverFlag(optarg))
+	    {
+	      fprintf(stderr, "%s: unknown driver '%s'\n", argv[0], optarg);
+	      exit(1);
+	    }
+	  driverFlags |= driverFlag(optarg);
+	  break;
+
 	default:
 	  fprintf(stderr, "for usage try: %s -h\n", argv[0]);
 	  exit(1);
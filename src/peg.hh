@@ -0,0 +1,661 @@
+/* Parsing expression grammars written directly in C++.
+ *
+ * Expressions are built from literals, classes and other expressions
+ * with operators that mirror leg's:
+ *
+ *	leg		C++
+ *	'c'  "str"	'c'  "str"	(in an expression with another operand)
+ *	"str"i		peg::istr("str")
+ *	[a-z]		peg::cls("a-z")
+ *	.		peg::dot
+ *	e1 e2		e1 >> e2
+ *	e1 | e2		e1 | e2
+ *	e*  e+  e?	*e  +e  -e
+ *	&e  !e		&e  !e
+ *	< e >		peg::capture(e)
+ *	e { action }	e[action]
+ *	&{ pred }	peg::pred(pred)
+ *
+ * The precedence of the operators is that of C++, which for these is the
+ * same as in leg except that e[action] binds most tightly of all.  (Peg's
+ * '/' for choice would bind more tightly than sequence in C++, so choice
+ * is written '|'.)
+ *
+ * Each operator yields a distinct type whose match() calls the yymatch*
+ * primitives of yymatcher, which leg -C copies into the parsers it
+ * generates, so a grammar is inlined by the compiler into a single
+ * matcher.  A peg::rule names an expression; rules may refer to each
+ * other, and to themselves, before they are defined.
+ *
+ * As in generated parsers, actions are deferred: a match records a thunk
+ * holding the action and the span of the most recent capture, the thunks
+ * of failed alternatives are discarded by backtracking, and the survivors
+ * are run in order when parse() succeeds.  An action is called with the
+ * text of the capture and its length, like yytext and yyleng.
+ *
+ * The input policies yymemory and yystream are those of leg -C.
+ */
+
+#ifndef PEG_HH
+#define PEG_HH
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef YY_STACK_SIZE
+#define YY_STACK_SIZE 128
+#endif
+#ifndef YY_BUFFER_SIZE
+#define YY_BUFFER_SIZE 1024
+#endif
+
+#ifndef YY_CPP_RUNTIME
+#define YY_CPP_RUNTIME
+
+struct yythunk { int begin, end;  unsigned short action; };
+
+enum { yyThunkPush= 0, yyThunkPop, yyThunkSet, yyThunkActions };
+
+/* Input policy for text that is already in memory.  The parser reads it
+ * in place and never asks for more.
+ */
+struct yymemory
+{
+  const char *_buf;
+  int	      _limit;
+
+  yymemory(const char *text, size_t length) : _buf(text), _limit((int)length) {}
+  explicit yymemory(const char *text) : _buf(text), _limit((int)strlen(text)) {}
+
+  bool refill()		{ return false; }
+  void discard(int n)	{ _buf += n;  _limit -= n; }
+};
+
+/* Input policy for text that arrives a piece at a time.  source(buf, size)
+ * stores at most size bytes in buf and answers how many, or 0 at the end
+ * of the input.
+ */
+template <class Source>
+struct yystream
+{
+  char  *_buf;
+  int	 _buflen;
+  int	 _limit;
+  Source _source;
+
+  explicit yystream(Source source)
+    : _buf((char *)malloc(YY_BUFFER_SIZE)), _buflen(YY_BUFFER_SIZE), _limit(0), _source(source) {}
+  ~yystream()	{ free(_buf); }
+  yystream(const yystream &)= delete;
+  yystream &operator=(const yystream &)= delete;
+
+  bool refill()
+  {
+    int n;
+    while (_buflen - _limit < 512)
+      _buf= (char *)realloc(_buf, _buflen *= 2);
+    if ((n= _source(_buf + _limit, _buflen - _limit)) <= 0)
+      return false;
+    _limit += n;
+    return true;
+  }
+
+  void discard(int n)	{ memmove(_buf, _buf + n, _limit -= n); }
+};
+
+#ifndef yyprintf
+# ifdef YY_DEBUG
+#  define yyprintf(args)	fprintf args
+# else
+#  define yyprintf(args)
+# endif
+#endif
+
+/* The primitives that matching is made of, for a Context that is also
+ * an input policy.  The parsers of leg -C and peg::parser derive from
+ * this, and leg copies everything from YY_CPP_RUNTIME to here into each
+ * parser it writes with -C.
+ */
+template <class Context>
+struct yymatcher
+{
+  typedef Context yycontext;
+
+  static void yyrecordMaxPos(yycontext *yy)
+  {
+    if (yy->_pos > yy->_maxpos)
+      yy->_maxpos= yy->_pos;
+  }
+
+  static int yymatchDot(yycontext *yy)
+  {
+    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+    ++yy->_pos;
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static int yymatchChar(yycontext *yy, int c)
+  {
+    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+    if ((unsigned char)yy->_buf[yy->_pos] == c)
+      {
+	++yy->_pos;
+	yyrecordMaxPos(yy);
+	yyprintf((stderr, "  ok   yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+	return 1;
+      }
+    yyprintf((stderr, "  fail yymatchChar(yy, %c) @ %s\n", c, yy->_buf+yy->_pos));
+    return 0;
+  }
+
+  static int yymatchString(yycontext *yy, const char *s)
+  {
+    int yysav= yy->_pos;
+    while (*s)
+      {
+	if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+	if (yy->_buf[yy->_pos] != *s)
+	  {
+	    yy->_pos= yysav;
+	    return 0;
+	  }
+	++s;
+	++yy->_pos;
+      }
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static int yymatchIString(yycontext *yy, const char *s)
+  {
+    int yysav= yy->_pos;
+    while (*s)
+      {
+	if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+	if (tolower(yy->_buf[yy->_pos]) != *s)
+	  {
+	    yy->_pos= yysav;
+	    return 0;
+	  }
+	++s;
+	++yy->_pos;
+      }
+    yyrecordMaxPos(yy);
+    return 1;
+  }
+
+  static int yymatchClass(yycontext *yy, const unsigned char *bits)
+  {
+    int c;
+    if (yy->_pos >= yy->_limit && !yy->refill()) return 0;
+    c= (unsigned char)yy->_buf[yy->_pos];
+    if (bits[c >> 3] & (1 << (c & 7)))
+      {
+	++yy->_pos;
+	yyrecordMaxPos(yy);
+	yyprintf((stderr, "  ok   yymatchClass @ %s\n", yy->_buf+yy->_pos));
+	return 1;
+      }
+    yyprintf((stderr, "  fail yymatchClass @ %s\n", yy->_buf+yy->_pos));
+    return 0;
+  }
+
+  static int yyText(yycontext *yy, int begin, int end)
+  {
+    int yyleng= end - begin;
+    if (yyleng < 0)
+      yyleng= 0;
+    if (yy->_textlen < yyleng + 1)
+      {
+	while (yy->_textlen < yyleng + 1)
+	  yy->_textlen= yy->_textlen ? 2 * yy->_textlen : YY_BUFFER_SIZE;
+	yy->_text= (char *)realloc(yy->_text, yy->_textlen);
+      }
+    memcpy(yy->_text, yy->_buf + begin, yyleng);
+    yy->_text[yyleng]= '\0';
+    return yyleng;
+  }
+
+  static void yyCommit(yycontext *yy)
+  {
+    yy->discard(yy->_pos);
+    yy->_begin -= yy->_pos;
+    yy->_end -= yy->_pos;
+    yy->_offset += yy->_pos;
+    yy->_pos= yy->_thunkpos= 0;
+  }
+};
+
+#define YY_MATCHER(C)					\
+  using yymatcher<C>::yyrecordMaxPos;			\
+  using yymatcher<C>::yymatchDot;			\
+  using yymatcher<C>::yymatchChar;			\
+  using yymatcher<C>::yymatchString;			\
+  using yymatcher<C>::yymatchIString;			\
+  using yymatcher<C>::yymatchClass;			\
+  using yymatcher<C>::yyText;				\
+  using yymatcher<C>::yyCommit
+
+#endif /* YY_CPP_RUNTIME */
+
+namespace peg {
+
+/* A deferred action: the span of text it will be given, and the action
+ * itself as an object and a function to call it with.
+ */
+struct thunk
+{
+  int	      begin, end;
+  const void *action;
+  void	    (*run)(const void *action, const char *yytext, int yyleng);
+};
+
+template <class Input>
+class parser : public Input, public yymatcher<parser<Input> >
+{
+public:
+  typedef parser yycontext;
+  YY_MATCHER(parser);
+
+  template <class... Args>
+  explicit parser(Args &&... args) : Input(std::forward<Args>(args)...) {}
+  ~parser()	{ free(_text); }
+  parser(const parser &)= delete;
+  parser &operator=(const parser &)= delete;
+
+  /* Match e against the input following the previous match, run its
+   * actions, and answer whether it matched.
+   */
+  template <class E>
+  bool parse(const E &e);
+
+  /* The offset in the input of the text following the previous match. */
+  size_t offset() const	{ return _offset; }
+
+  int	   _pos= 0;
+  int	   _maxpos= 0;
+  char	  *_text= 0;
+  int	   _textlen= 0;
+  int	   _begin= 0;
+  int	   _end= 0;
+  size_t   _offset= 0;
+  std::vector<thunk> _thunks;
+  int	   _thunkpos= 0;
+
+  static void yyDo(yycontext *yy, const void *action, void (*run)(const void *, const char *, int), int begin, int end)
+  {
+    if (yy->_thunkpos >= (int)yy->_thunks.size())
+      yy->_thunks.resize(yy->_thunks.empty() ? YY_STACK_SIZE : 2 * yy->_thunks.size());
+    thunk &t= yy->_thunks[yy->_thunkpos++];
+    t.begin=  begin;
+    t.end=    end;
+    t.action= action;
+    t.run=    run;
+  }
+
+  static void yyDone(yycontext *yy)
+  {
+    int pos;
+    for (pos= 0;  pos < yy->_thunkpos;  ++pos)
+      {
+	thunk *t= &yy->_thunks[pos];
+	int yyleng= yyText(yy, t->begin, t->end);
+	t->run(t->action, yy->_text, yyleng);
+      }
+    yy->_thunkpos= 0;
+  }
+};
+
+/* The type an operand is stored as within an expression: literals become
+ * matchers, and rules are referred to rather than copied.
+ */
+template <class T, class= void> struct lift {};
+
+template <class T> using lift_t= typename lift<typename std::decay<T>::type>::type;
+
+template <class A, class F> struct action;
+
+/* Every expression derives from expr, which lets the operators below
+ * recognise their operands and gives it e[f] to attach an action.
+ */
+template <class T>
+struct expr
+{
+  template <class F, class E= T>
+  action<lift_t<E>, F> operator[](const F &f) const	{ return action<lift_t<E>, F>(static_cast<const E &>(*this), f); }
+};
+
+template <class T> struct is_expr : std::is_base_of<expr<T>, T> {};
+
+template <class Input> class rule;
+
+struct chr;
+struct str;
+template <class Input> struct call;
+
+template <class T> struct is_rule : std::false_type {};
+template <class Input> struct is_rule<rule<Input> > : std::true_type {};
+
+template <class T> struct lift<T, typename std::enable_if<is_expr<T>::value && !is_rule<T>::value>::type> { typedef T type; };
+template <> struct lift<char>								{ typedef chr type; };
+template <> struct lift<const char *>							{ typedef str type; };
+template <> struct lift<char *>								{ typedef str type; };
+template <size_t N> struct lift<char[N]>						{ typedef str type; };
+template <size_t N> struct lift<const char[N]>						{ typedef str type; };
+template <class Input> struct lift<rule<Input> >					{ typedef call<Input> type; };
+
+struct chr : expr<chr>
+{
+  int c;
+  chr(char c) : c((unsigned char)c) {}
+  template <class P> bool match(P *yy) const	{ return P::yymatchChar(yy, c); }
+};
+
+struct str : expr<str>
+{
+  const char *s;
+  str(const char *s) : s(s) {}
+  template <class P> bool match(P *yy) const	{ return P::yymatchString(yy, s); }
+};
+
+/* A case-insensitive string, written in lower case. */
+struct istr : expr<istr>
+{
+  const char *s;
+  explicit istr(const char *s) : s(s) {}
+  template <class P> bool match(P *yy) const	{ return P::yymatchIString(yy, s); }
+};
+
+/* A character class, written as between [ and ] in a grammar. */
+struct cls : expr<cls>
+{
+  unsigned char bits[32];
+
+  explicit cls(const char *spec)
+  {
+    int	 prev= -1, c;
+    bool negate= ('^' == *spec);
+    memset(bits, 0, sizeof(bits));
+    if (negate) ++spec;
+    while ((c= next(&spec)) >= 0)
+      if ('-' == c && prev >= 0 && *spec)
+	{
+	  for (c= next(&spec);  prev <= c;  ++prev)
+	    bits[prev >> 3] |= 1 << (prev & 7);
+	  prev= -1;
+	}
+      else
+	{
+	  bits[c >> 3] |= 1 << (c & 7);
+	  prev= c;
+	}
+    if (negate)
+      for (c= 0;  c < 32;  ++c)
+	bits[c] ^= 255;
+  }
+
+  template <class P> bool match(P *yy) const	{ return P::yymatchClass(yy, bits); }
+
+private:
+  static int next(const char **spec)
+  {
+    int c= (unsigned char)*(*spec)++;
+    if (!c)
+      {
+	--*spec;
+	return -1;
+      }
+    if ('\\' == c && **spec)
+      switch (c= (unsigned char)*(*spec)++)
+	{
+	case 'n':  return '\n';
+	case 'r':  return '\r';
+	case 't':  return '\t';
+	}
+    return c;
+  }
+};
+
+struct dot_ : expr<dot_>
+{
+  template <class P> bool match(P *yy) const	{ return P::yymatchDot(yy); }
+};
+
+static const dot_ dot= dot_();
+
+template <class A, class B>
+struct seq : expr<seq<A, B> >
+{
+  A a;  B b;
+  seq(const A &a, const B &b) : a(a), b(b) {}
+  template <class P> bool match(P *yy) const	{ return a.match(yy) && b.match(yy); }
+};
+
+template <class A, class B>
+struct alt : expr<alt<A, B> >
+{
+  A a;  B b;
+  alt(const A &a, const B &b) : a(a), b(b) {}
+  template <class P> bool match(P *yy) const
+  {
+    int yypos= yy->_pos, yythunkpos= yy->_thunkpos;
+    if (a.match(yy)) return true;
+    yy->_pos= yypos;  yy->_thunkpos= yythunkpos;
+    return b.match(yy);
+  }
+};
+
+template <class A>
+struct star : expr<star<A> >
+{
+  A a;
+  explicit star(const A &a) : a(a) {}
+  template <class P> bool match(P *yy) const
+  {
+    for (;;)
+      {
+	int yypos= yy->_pos, yythunkpos= yy->_thunkpos;
+	if (!a.match(yy))
+	  {
+	    yy->_pos= yypos;  yy->_thunkpos= yythunkpos;
+	    return true;
+	  }
+      }
+  }
+};
+
+template <class A>
+struct plus : expr<plus<A> >
+{
+  star<A> a;
+  explicit plus(const A &a) : a(a) {}
+  template <class P> bool match(P *yy) const	{ return a.a.match(yy) && a.match(yy); }
+};
+
+template <class A>
+struct query : expr<query<A> >
+{
+  A a;
+  explicit query(const A &a) : a(a) {}
+  template <class P> bool match(P *yy) const
+  {
+    int yypos= yy->_pos, yythunkpos= yy->_thunkpos;
+    if (!a.match(yy))
+      {
+	yy->_pos= yypos;  yy->_thunkpos= yythunkpos;
+      }
+    return true;
+  }
+};
+
+template <class A>
+struct peek_for : expr<peek_for<A> >
+{
+  A a;
+  explicit peek_for(const A &a) : a(a) {}
+  template <class P> bool match(P *yy) const
+  {
+    int yypos= yy->_pos, yythunkpos= yy->_thunkpos;
+    bool yyok= a.match(yy);
+    yy->_pos= yypos;  yy->_thunkpos= yythunkpos;
+    return yyok;
+  }
+};
+
+template <class A>
+struct peek_not : expr<peek_not<A> >
+{
+  A a;
+  explicit peek_not(const A &a) : a(a) {}
+  template <class P> bool match(P *yy) const
+  {
+    int yypos= yy->_pos, yythunkpos= yy->_thunkpos, yymaxpos= yy->_maxpos;
+    bool yyok= a.match(yy);
+    yy->_pos= yypos;  yy->_thunkpos= yythunkpos;  yy->_maxpos= yymaxpos;
+    return !yyok;
+  }
+};
+
+template <class A>
+struct capture_ : expr<capture_<A> >
+{
+  A a;
+  explicit capture_(const A &a) : a(a) {}
+  template <class P> bool match(P *yy) const
+  {
+    yy->_begin= yy->_pos;
+    if (!a.match(yy)) return false;
+    yy->_end= yy->_pos;
+    return true;
+  }
+};
+
+template <class A, class F>
+struct action : expr<action<A, F> >
+{
+  A a;  F f;
+  action(const A &a, const F &f) : a(a), f(f) {}
+  static void run(const void *f, const char *yytext, int yyleng)	{ (*(const F *)f)(yytext, yyleng); }
+  template <class P> bool match(P *yy) const
+  {
+    if (!a.match(yy)) return false;
+    P::yyDo(yy, &f, run, yy->_begin, yy->_end);
+    return true;
+  }
+};
+
+template <class F>
+struct predicate : expr<predicate<F> >
+{
+  F f;
+  explicit predicate(const F &f) : f(f) {}
+  template <class P> bool match(P *yy) const
+  {
+    int yyleng= P::yyText(yy, yy->_begin, yy->_end);
+    return f((const char *)yy->_text, yyleng);
+  }
+};
+
+/* A named expression, matched by a virtual call so that rules can refer
+ * to each other.  Like a generated rule it consumes nothing if it fails.
+ */
+template <class Input>
+class rule : public expr<rule<Input> >
+{
+public:
+  rule() {}
+  rule(const rule &)= delete;
+
+  template <class E>
+  rule &operator=(const E &e)
+  {
+    _body.reset(new body<lift_t<E> >(e));
+    return *this;
+  }
+
+  bool match(parser<Input> *yy) const
+  {
+    int yypos= yy->_pos, yythunkpos= yy->_thunkpos;
+    if (_body->match(yy)) return true;
+    yy->_pos= yypos;  yy->_thunkpos= yythunkpos;
+    return false;
+  }
+
+private:
+  struct matcher
+  {
+    virtual ~matcher() {}
+    virtual bool match(parser<Input> *yy) const= 0;
+  };
+
+  template <class E>
+  struct body : matcher
+  {
+    E e;
+    explicit body(const E &e) : e(e) {}
+    bool match(parser<Input> *yy) const	{ return e.match(yy); }
+  };
+
+  std::unique_ptr<matcher> _body;
+};
+
+template <class Input>
+struct call : expr<call<Input> >
+{
+  const rule<Input> *r;
+  call(const rule<Input> &r) : r(std::addressof(r)) {}
+  bool match(parser<Input> *yy) const	{ return r->match(yy); }
+};
+
+template <class Input>
+template <class E>
+bool parser<Input>::parse(const E &e)
+{
+  lift_t<E> yystart(e);
+  int	    yypos= _pos;
+  bool	    yyok;
+  _begin= _end= _pos;
+  _thunkpos= 0;
+  if ((yyok= yystart.match(this)))
+    yyDone(this);
+  else
+    _pos= yypos;
+  yyCommit(this);
+  return yyok;
+}
+
+/* Operators apply when either operand is an expression or a rule. */
+template <class A, class B>
+struct either : std::integral_constant<bool, is_expr<typename std::decay<A>::type>::value || is_expr<typename std::decay<B>::type>::value> {};
+
+template <class A, class B>
+typename std::enable_if<either<A, B>::value, seq<lift_t<A>, lift_t<B> > >::type operator>>(const A &a, const B &b)
+{
+  return seq<lift_t<A>, lift_t<B> >(a, b);
+}
+
+template <class A, class B>
+typename std::enable_if<either<A, B>::value, alt<lift_t<A>, lift_t<B> > >::type operator|(const A &a, const B &b)
+{
+  return alt<lift_t<A>, lift_t<B> >(a, b);
+}
+
+template <class A> star<lift_t<A> >	operator*(const expr<A> &a)	{ return star<lift_t<A> >(static_cast<const A &>(a)); }
+template <class A> plus<lift_t<A> >	operator+(const expr<A> &a)	{ return plus<lift_t<A> >(static_cast<const A &>(a)); }
+template <class A> query<lift_t<A> >	operator-(const expr<A> &a)	{ return query<lift_t<A> >(static_cast<const A &>(a)); }
+template <class A> peek_for<lift_t<A> >	operator&(const expr<A> &a)	{ return peek_for<lift_t<A> >(static_cast<const A &>(a)); }
+template <class A> peek_not<lift_t<A> >	operator!(const expr<A> &a)	{ return peek_not<lift_t<A> >(static_cast<const A &>(a)); }
+
+template <class A> capture_<lift_t<A> >	capture(const A &a)		{ return capture_<lift_t<A> >(a); }
+template <class F> predicate<F>		pred(const F &f)		{ return predicate<F>(f); }
+
+} /* namespace peg */
+
+#endif
@@ -38,7 +38,9 @@ FILE *output= 0;
 
 int actionCount= 0;
 int ruleCount= 0;
-int lastToken= -1;
+int lastToken= 0;
+int lastLazy= 0;
+char *structuralClass= 0;
 
 static inline Node *_newNode(int type, int size)
 {
@@ -47,7 +49,7 @@ static inline Node *_newNode(int type, int size)
   return node;
 }
 
-#define newNode(T)	_newNode(T, sizeof(struct T))
+#define newNode(T)	_newNode(T, sizeof(Node))
 
 Node *makeRule(char *name)
 {
@@ -92,6 +94,37 @@ void Rule_setExpression(Node *node, Node *expression)
     start= node;
 }
 
+/* Make a rule a token declared with %token, numbered from 1 in order
+ * of declaration.
+ */
+Node *Rule_beToken(Node *node)
+{
+  assert(Rule == node->type);
+  if (!node->rule.token)
+    node->rule.token= ++lastToken;
+  return node;
+}
+
+/* Make a rule lazy, as declared with %lazy, numbered from 1 in order
+ * of declaration.
+ */
+Node *Rule_beLazy(Node *node)
+{
+  assert(Rule == node->type);
+  if (!node->rule.lazy)
+    node->rule.lazy= ++lastLazy;
+  return node;
+}
+
+/* Declare the type of the semantic value of a rule, used with -C.
+ */
+void Rule_setType(Node *node, char *type)
+{
+  assert(Rule == node->type);
+  free(node->rule.valueType);
+  node->rule.valueType= strdup(type);
+}
+
 Node *makeVariable(char *name)
 {
   Node *node;
@@ -300,6 +333,11 @@ Node *makePlus(Node *e)
   return node;
 }
 
+Node *makeCut(void)
+{
+  return newNode(Cut);
+}
+
 
 static Node  *stack[1024];
 static Node **stackPointer= stack;
@@ -383,12 +421,73 @@ static void Node_fprint(FILE *stream, Node *node)
     case Query:		Node_fprint(stream, node->query.element);  fprintf(stream, "?");	break;
     case Star:		Node_fprint(stream, node->query.element);  fprintf(stream, "*");	break;
     case Plus:		Node_fprint(stream, node->query.element);  fprintf(stream, "+");	break;
+    case Cut:		fprintf(stream, " ^");							break;
     default:
       fprintf(stream, "\nunknown node type %d\n", node->type);
       exit(1);
     }
 }
 
+static void Node_free(Node *node)
+{
+  Node *n, *next;
+  switch (node->type)
+    {
+    case Rule:		free(node->rule.name);
+			free(node->rule.valueType);
+			for (n= node->rule.variables;  n;  n= next)
+			  {
+			    next= n->any.next;
+			    Node_free(n);
+			  }
+			if (node->rule.expression)
+			  Node_free(node->rule.expression);
+			break;
+    case Variable:	free(node->variable.name);						break;
+    case Character:	free(node->character.value);						break;
+    case String:	free(node->string.value);						break;
+    case Class:		free(node->cclass.value);						break;
+    case Action:	free(node->action.text);  free(node->action.name);			break;
+    case Inline:	free(node->inLine.text);						break;
+    case Predicate:	free(node->predicate.text);						break;
+    case Error:		Node_free(node->error.element);  free(node->error.text);		break;
+
+    case Alternate:
+    case Sequence:	for (n= node->alternate.first;  n;  n= next)
+			  {
+			    next= n->any.next;
+			    Node_free(n);
+			  }
+			break;
+
+    case PeekFor:
+    case PeekNot:
+    case Query:
+    case Star:
+    case Plus:		Node_free(node->query.element);						break;
+    }
+  free(node);
+}
+
+/* Free every rule and forget the grammar read so far, so that another
+ * one can be read into the same tree.
+ */
+void freeRules(void)
+{
+  Node *n, *next;
+  for (n= rules;  n;  n= next)
+    {
+      next= n->rule.next;
+      Node_free(n);
+    }
+  actions= rules= thisRule= start= 0;
+  actionCount= ruleCount= 0;
+  lastToken= lastLazy= 0;
+  free(structuralClass);
+  structuralClass= 0;
+  stackPointer= stack;
+}
+
 void Node_print(Node *node)	{ Node_fprint(stderr, node); }
 
 static void Rule_fprint(FILE *stream, Node *node)
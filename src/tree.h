@@ -18,23 +18,27 @@
 
 #include <stdio.h>
 
-enum { Unknown= 0, Rule, Variable, Name, Dot, Character, String, Class, Action, Inline, Predicate, Error, Alternate, Sequence, PeekFor, PeekNot, Query, Star, Plus };
+enum { Unknown= 0, Rule, Variable, Name, Dot, Character, String, Class, Action, Inline, Predicate, Error, Alternate, Sequence, PeekFor, PeekNot, Query, Star, Plus, Cut };
 
 enum {
   RuleUsed	= 1<<0,
   RuleReached	= 1<<1,
+  RuleNoRetry	= 1<<2,		/* no caller backtracks when the rule fails */
+  RuleNoUndo	= 1<<3,		/* no caller backtracks once the rule succeeds */
+  RuleRegular	= 1<<4,		/* the rule is a regular expression without actions */
+  RuleIrregular	= 1<<5,
 };
 
 typedef union Node Node;
 
-struct Rule	 { int type;  Node *next;   char *name;	 Node *variables;  Node *expression;  int id;  int flags;	};
-struct Variable	 { int type;  Node *next;   char *name;  Node *value;  int offset;					};
+struct Rule	 { int type;  Node *next;   char *name;	 Node *variables;  Node *expression;  int id;  int flags;  int frame;  char *valueType;  int token;  int lazy;	};
+struct Variable	 { int type;  Node *next;   char *name;  Node *value;  int offset;  char *valueType;			};
 struct Name	 { int type;  Node *next;   Node *rule;  Node *variable;						};
 struct Dot	 { int type;  Node *next;										};
 struct Character { int type;  Node *next;   char *value;								};
 struct String	 { int type;  Node *next;   char *value; int casefold;								};
 struct Class	 { int type;  Node *next;   unsigned char *value;							};
-struct Action	 { int type;  Node *next;   char *text;	  Node *list;  char *name;  Node *rule;  int line;		};
+struct Action	 { int type;  Node *next;   char *text;	  Node *list;  char *name;  Node *rule;  int line;  int eager;	};
 struct Inline    { int type;  Node *next;   char *text;									};
 struct Predicate { int type;  Node *next;   char *text;									};
 struct Error	 { int type;  Node *next;   Node *element;  char *text;							};
@@ -45,6 +49,7 @@ struct PeekNot	 { int type;  Node *next;   Node *element;								};
 struct Query	 { int type;  Node *next;   Node *element;								};
 struct Star	 { int type;  Node *next;   Node *element;								};
 struct Plus	 { int type;  Node *next;   Node *element;								};
+struct Cut	 { int type;  Node *next;										};
 struct Any	 { int type;  Node *next;										};
 
 union Node
@@ -68,22 +73,55 @@ union Node
   struct Query		query;
   struct Star		star;
   struct Plus		plus;
+  struct Cut		cut;
   struct Any		any;
 };
 
+enum {
+  OpChar= 0, OpString, OpIString, OpClass, OpSpan, OpAny,
+  OpChoice, OpNotChoice, OpCommit, OpBackCommit, OpFail, OpFailTwice,
+  OpCut, OpCall, OpReturn, OpJump, OpBegin, OpEnd,
+  OpPush, OpPop, OpAssign, OpAction, OpEager, OpPredicate, OpCode,
+  OpStream,
+};
+
+typedef struct Program Program;
+
+struct Program {
+  int		 *code;		int codeCount;
+  char		**strings;	int stringCount;	/* as written in the grammar */
+  unsigned char	**classes;	int classCount;		/* 32-byte bitmaps */
+  Node		**nodes;	int nodeCount;		/* actions, predicates, inline and error code */
+  int		 *rules;				/* address of each rule, indexed by id */
+};
+
 extern Node *actions;
 extern Node *rules;
 extern Node *start;
 
 extern int   ruleCount;
+extern int   lastToken;
+extern int   lastLazy;
+extern char *structuralClass;
 
 extern FILE *output;
 
+extern int   eagerFlag;
+extern int   streamFlag;
+extern int   gotoFlag;
+extern int   bytecodeFlag;
+extern int   cppFlag;
+extern int   constexprFlag;
+extern int   reentrantFlag;
+extern int   driverFlags;
+
 extern Node *makeRule(char *name);
 extern Node *findRule(char *name);
 extern Node *beginRule(Node *rule);
 extern void  Rule_setExpression(Node *rule, Node *expression);
+extern void  Rule_setType(Node *rule, char *type);
 extern Node *Rule_beToken(Node *rule);
+extern Node *Rule_beLazy(Node *rule);
 extern Node *makeVariable(char *name);
 extern Node *makeName(Node *rule);
 extern Node *makeDot(void);
@@ -103,12 +141,19 @@ extern Node *makePeekNot(Node *e);
 extern Node *makeQuery(Node *e);
 extern Node *makeStar(Node *e);
 extern Node *makePlus(Node *e);
+extern Node *makeCut(void);
 extern Node *push(Node *node);
 extern Node *top(void);
 extern Node *pop(void);
+extern void  freeRules(void);
 
+extern int   unescape(char *string);
+extern Program *Rule_compile_program(Node *rules);
 extern void  Rule_compile_c_header(void);
 extern void  Rule_compile_c(Node *node, int nolines);
+extern int   driverFlag(char *name);
+
+extern int   readGrammar(const char *text, char **error);	/* in leg.c built with -DPEG_LIBRARY */
 
 extern void  Node_print(Node *node);
 extern void  Rule_print(Node *node);